@@ -0,0 +1,99 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Benchmark and check of the domain decomposition. The
+        case of "DomainCase.h", two elastic cubes moving towards
+        and past each other, is run on processes connected by
+        "Transport_Socket", in slabs along x, and by a single
+        process. Particles cross the slabs as the cubes move
+        and the final particles of all ranks are gathered to
+        rank 0 and compared with the single process by their
+        IDs. The time of both runs, the particles
+        migrated and the largest difference of positions,
+        velocities and stresses are reported, with the
+        difference of the single process run on the particles
+        in reverse order as the level of round-off, since the
+        sums of node values are in another order on each rank.
+    Usage: MPM3D_DomainBenchmark [processes] [particles per edge] [steps]
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "DomainCase.h"
+#include "../parallel/Transport_Socket.h"
+
+int main(int argc, char* argv[])
+{
+    int process_number = argc > 1 ? atoi(argv[1]) : 4;
+    int particle_edge = argc > 2 ? atoi(argv[2]) : 16;
+    int steps = argc > 3 ? atoi(argv[3]) : 100;
+    if (process_number <= 0 || particle_edge < 2 || steps <= 0)
+    {
+        cout << "Usage: " << argv[0] << " [processes] [particles per edge] [steps]" << endl;
+        return 1;
+    }
+
+    //!> Processes are forked before anything else, only rank 0 prints
+    Transport_Socket transport;
+    if (!transport.Initialize(process_number))
+        return 1;
+    int edge = particle_edge/2;
+    int division[3] = {process_number, 1, 1};
+    vector<MPM_FLOAT> state, all;
+    MPM_STATS migrated = 0;
+    uint64_t time_ns = 0;
+    if (!DomainCase_Simulate(&transport, division, edge, steps, false, state, migrated, time_ns) ||
+        !DomainCase_Gather(&transport, state, all))
+        return 1;
+    MPM_FLOAT total_migrated = (MPM_FLOAT)migrated;
+    MPM_FLOAT particle_number = (MPM_FLOAT)state.size()/(1 + DomainCase_StateNumber);
+    if (!transport.AllReduceSum(total_migrated) || !transport.AllReduceSum(particle_number))
+        return 1;
+    if (transport.GetRank() != 0)
+        return transport.Finalize() ? 0 : 1;
+
+    //!> Single process, in the order of the decomposed run and in reverse order
+    vector<MPM_FLOAT> reference, reversed;
+    uint64_t reference_ns = 0;
+    const int single[3] = {1, 1, 1};
+    for (vector<MPM_FLOAT>* result : {&reference, &reversed})
+    {
+        vector<MPM_FLOAT> reference_state;
+        MPM_STATS reference_migrated = 0;
+        uint64_t run_ns = 0;
+        if (!DomainCase_Simulate(nullptr, single, edge, steps, result == &reversed, reference_state,
+            reference_migrated, run_ns))
+            return 1;
+        DomainCase_SortByID(reference_state, *result);
+        if (result == &reference)
+            reference_ns = run_ns;
+    }
+    MPM_FLOAT difference = DomainCase_Difference(all, reference);
+    MPM_FLOAT round_off = DomainCase_Difference(reversed, reference);
+
+    bool finalized = transport.Finalize();
+    cout << "Transport: " << transport.GetName() << ", processes: " << process_number << ", particles: " 
+         << reference.size()/DomainCase_StateNumber << ", steps: " << steps << endl;
+    cout << "Single process: " << reference_ns*1e-6 << " ms" << endl;
+    cout << "Decomposed: " << time_ns*1e-6 << " ms (rank 0), particles: " << (MPM_STATS)particle_number 
+         << ", migrated: " << (MPM_STATS)total_migrated << endl;
+    if (all.size() != reference.size() || (size_t)particle_number != reference.size()/DomainCase_StateNumber)
+    {
+        cout << "Particles of the decomposed run differ from the single process" << endl;
+        return 1;
+    }
+    cout << "Largest relative difference: " << difference << ", in reverse order: " << round_off << endl;
+    return finalized ? 0 : 1;
+}
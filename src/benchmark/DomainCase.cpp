@@ -0,0 +1,196 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of the domain decomposition case
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "DomainCase.h"
+#include "../solver/step/Step_USL.h"
+#include "../utility/Profiler.h"
+#include <cstring>
+
+//!> Velocity gradients in the cubes, 1/s: stretching along x and shearing of y along z
+const MPM_FLOAT DomainCase_Stretch = 2000.0;
+const MPM_FLOAT DomainCase_Shear = 5000.0;
+
+bool DomainCase_Simulate(Transport_Base* transport, const int (&division)[3], int edge, int steps, bool reverse,
+    vector<MPM_FLOAT>& state, MPM_STATS& migrated, uint64_t& time_ns)
+{
+    string strength_name = "IsoElastic", eos_name = "";
+    map<string, MPM_FLOAT> strength_para = {{"Young", 2e11}, {"Poisson", 0.3}}, eos_para;
+    map<string, MPM_FLOAT> extra_para = {{"ReferenceDensity", 7830.0}};
+    vector<string> failure_name;
+    vector< map<string, MPM_FLOAT> > failure_para;
+    MaterialFactory material;
+    if (!material.Initialize(strength_name, strength_para, eos_name, eos_para, failure_name, failure_para, extra_para))
+        return false;
+    vector<MPM::ExtraParticleProperty> extra_property;
+    DataTransfer transfer;
+    if (!material.AddExtraParticleProperty(extra_property, transfer))
+        return false;
+
+    //!> Cubes of "edge" cells, one cell apart along x, at 200 m/s towards each other and past each other in
+    //!>    y and z, stretched along x and sheared in y so that the stresses are well above round-off
+    const MPM_FLOAT cell_size = 1e-2;
+    const MPM_FLOAT density = 7830.0;
+    MPM_STATS cube_number = 8*(MPM_STATS)edge*edge*edge;
+    ParticleStore store;
+    if (!store.Initialize(2*cube_number, extra_property))
+        return false;
+    for (MPM_STATS p = 0; p < 2*cube_number; p++)
+    {
+        int cube = (int)(p/cube_number);
+        MPM_STATS cell = p % cube_number/8;
+        int corner = (int)(p % 8);
+        int index[3] = {(int)(cell % edge), (int)(cell/edge % edge), (int)(cell/edge/edge)};
+        for (int k = 0; k < 3; k++)
+        {
+            MPM_FLOAT x = index[k] + 0.25 + 0.5*((corner >> k) & 1);
+            store.GetPosition(k)[p] = (x + (k == 0 ? cube*(edge + 1) : 0))*cell_size;
+        }
+        MPM_FLOAT center = (0.5*edge + cube*(edge + 1))*cell_size;
+        MPM_FLOAT speed = cube == 0 ? 200.0 : -200.0;
+        store.GetVelocity(0)[p] = speed + DomainCase_Stretch*(store.GetPosition(0)[p] - center);
+        store.GetVelocity(1)[p] = speed + DomainCase_Shear*(store.GetPosition(2)[p] - 0.5*edge*cell_size);
+        store.GetVelocity(2)[p] = speed;
+        store.GetVolume()[p] = cell_size*cell_size*cell_size/8.0;
+        store.GetMass()[p] = density*store.GetVolume()[p];
+        store.GetDensity()[p] = density;
+    }
+    if (reverse)
+    {
+        vector<MPM_STATS> order(2*cube_number);
+        for (MPM_STATS p = 0; p < 2*cube_number; p++)
+            order[p] = 2*cube_number - 1 - p;
+        if (!store.Permute(order.data(), 2*cube_number))
+            return false;
+    }
+
+    SparseGrid grid;
+    Array3D origin = {0.0, 0.0, 0.0};
+    Array3D gravity = {0.0, 0.0, 0.0};
+    ShapeFunction shape;
+    ParticleToGrid particle_to_grid;
+    if (!grid.Initialize(origin, cell_size) || !shape.Initialize(MPM::CubicBSpline) || 
+        !particle_to_grid.Initialize(ParticleToGrid::Serial, nullptr))
+        return false;
+
+    Step_USL step;
+    DomainDecomposition domain;
+    if (transport)
+    {
+        //!> Every rank creates all particles and keeps its own
+        Array3D low = {0.0, 0.0, 0.0};
+        Array3D high = {(MPM_FLOAT)((2*edge + 1 - 0.5)*cell_size), (MPM_FLOAT)((edge - 0.5)*cell_size),
+            (MPM_FLOAT)((edge - 0.5)*cell_size)};
+        if (!domain.Initialize(transport, &grid, low, high, division) || !domain.Distribute(store))
+            return false;
+        step.SetDomain(&domain);
+    }
+
+    uint64_t start = Profiler::Now();
+    if (!step.Initialize(&store, &material, &grid, &shape, &particle_to_grid, gravity))
+        return false;
+    migrated = 0;
+    for (int s = 0; s < steps; s++)
+    {
+        if (!step.Solve(cout))
+            return false;
+        migrated += domain.GetMigrated();
+    }
+    time_ns = Profiler::Now() - start;
+
+    state.clear();
+    for (MPM_STATS p = 0; p < store.GetActiveNumber(); p++)
+    {
+        state.push_back((MPM_FLOAT)store.GetParticleID()[p]);
+        for (int k = 0; k < 3; k++)
+            state.push_back(store.GetPosition(k)[p]);
+        for (int k = 0; k < 3; k++)
+            state.push_back(store.GetVelocity(k)[p]);
+        state.push_back(store.GetMeanStress()[p]);
+        for (int k = 0; k < 6; k++)
+            state.push_back(store.GetDeviatoricStress(k)[p]);
+    }
+    return true;
+}
+
+void DomainCase_SortByID(const vector<MPM_FLOAT>& state, vector<MPM_FLOAT>& sorted)
+{
+    sorted.clear();
+    for (size_t offset = 0; offset < state.size(); offset += 1 + DomainCase_StateNumber)
+    {
+        size_t id = (size_t)state[offset];
+        if (sorted.size() < (id + 1)*DomainCase_StateNumber)
+            sorted.resize((id + 1)*DomainCase_StateNumber, 0.0);
+        copy(state.begin() + offset + 1, state.begin() + offset + 1 + DomainCase_StateNumber,
+            sorted.begin() + id*DomainCase_StateNumber);
+    }
+}
+
+MPM_FLOAT DomainCase_Difference(const vector<MPM_FLOAT>& value, const vector<MPM_FLOAT>& reference)
+{
+    MPM_FLOAT difference = 0.0;
+    const int field_begin[3] = {0, 3, 6}, field_end[3] = {3, 6, DomainCase_StateNumber};
+    for (int f = 0; f < 3 && value.size() == reference.size(); f++)
+    {
+        MPM_FLOAT field_difference = 0.0, scale = 0.0;
+        for (size_t i = 0; i < reference.size(); i += DomainCase_StateNumber)
+            for (int k = field_begin[f]; k < field_end[f]; k++)
+            {
+                field_difference = max(field_difference, fabs(value[i + k] - reference[i + k]));
+                scale = max(scale, fabs(reference[i + k]));
+            }
+        difference = max(difference, scale > 0.0 ? field_difference/scale : field_difference);
+    }
+    return difference;
+}
+
+bool DomainCase_Gather(Transport_Base* transport, const vector<MPM_FLOAT>& state, vector<MPM_FLOAT>& all)
+{
+    vector<int> ranks;
+    vector< vector<char> > send, receive;
+    vector<char> buffer(state.size()*sizeof(MPM_FLOAT));
+    if (!state.empty())
+        memcpy(buffer.data(), state.data(), buffer.size());
+    if (transport->GetRank() == 0)
+    {
+        for (int r = 1; r < transport->GetSize(); r++)
+            ranks.push_back(r);
+        send.assign(ranks.size(), vector<char>());
+    }
+    else
+    {
+        ranks.push_back(0);
+        send.push_back(buffer);
+    }
+    if (!transport->Exchange(ranks, send, receive))
+        return false;
+    if (transport->GetRank() != 0)
+        return true;
+
+    vector<MPM_FLOAT> gathered = state;
+    for (auto& message : receive)
+    {
+        size_t offset = gathered.size();
+        gathered.resize(offset + message.size()/sizeof(MPM_FLOAT));
+        if (!message.empty())
+            memcpy(gathered.data() + offset, message.data(), message.size());
+    }
+    DomainCase_SortByID(gathered, all);
+    return true;
+}
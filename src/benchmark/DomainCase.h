@@ -0,0 +1,52 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Case of the domain decomposition shared by
+        MPM3D_DomainBenchmark and MPM3D_DomainTest. Two elastic
+        cubes (8 particles per cell) moving towards and past
+        each other, stretched and sheared, are run by the USL
+        scheme on the subdomain of a rank or on a single
+        process, and the final particles are compared by their
+        IDs after gathering them to rank 0.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _DOMAINCASE_H_
+#define _DOMAINCASE_H_
+
+#include "../parallel/Transport_Base.h"
+#include <cstdint>
+
+//!> Fields of a particle compared: position, velocity, mean stress and deviatoric stress
+const int DomainCase_StateNumber = 13;
+
+//!> Run the two cubes of "edge" cells for "steps" steps, on the subdomain of the rank of "transport" in
+//!>    "division" or on a single process for nullptr
+//!> Particles are in reverse order if "reverse"
+//!> "state" receives the ID and the fields of each active particle of this rank, "time_ns" the time of the steps
+bool DomainCase_Simulate(Transport_Base* transport, const int (&division)[3], int edge, int steps, bool reverse,
+    vector<MPM_FLOAT>& state, MPM_STATS& migrated, uint64_t& time_ns);
+
+//!> Fields of the particles of "state" at their IDs, DomainCase_StateNumber for each ID
+void DomainCase_SortByID(const vector<MPM_FLOAT>& state, vector<MPM_FLOAT>& sorted);
+
+//!> Largest difference of position, velocity and stress, each relative to its largest reference value
+MPM_FLOAT DomainCase_Difference(const vector<MPM_FLOAT>& value, const vector<MPM_FLOAT>& reference);
+
+//!> Particle states of all ranks on rank 0, ordered by particle ID
+bool DomainCase_Gather(Transport_Base* transport, const vector<MPM_FLOAT>& state, vector<MPM_FLOAT>& all);
+
+#endif
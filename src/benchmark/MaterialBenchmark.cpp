@@ -0,0 +1,450 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Microbenchmark of the material library. Every
+        Strength, EOS and Failure model is driven through
+        MaterialFactory on synthetic particle populations
+        (elastic, yielding, failing, detonating), by the
+        scalar path "UpdateStress", which calls the virtual
+        model functions one particle at a time, and the batch
+        path "UpdateStressBatch". Throughput is reported in
+        particles/second, ns/particle and cycles/particle, and
+        the speedup of the batch path over the scalar one.
+    Usage: MPM3D_Benchmark [particle number] [steps] [repeat]
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "../material/MaterialFactory.h"
+#include "../body/ExtraPropertyArena.h"
+#include "../utility/MathFunctionList.h"
+#include "../utility/Profiler.h"
+#include "../utility/SIMD.h"
+#include <iomanip>
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define MPM_BENCHMARK_TSC
+#elif defined(_M_X64) || defined(_M_IX86)
+    #include <intrin.h>
+    #define MPM_BENCHMARK_TSC
+#endif
+
+//!> Synthetic particle populations
+enum BenchmarkPopulation
+{
+    Elastic,        //!< small strain increments, the particles stay elastic
+    Yielding,       //!< strain increments beyond the yield strain in a few steps
+    Failing,        //!< tension until the failure model is triggered during the run
+    Detonating      //!< explosive with light times spread over the run
+};
+
+struct BenchmarkCase
+{
+    string name;
+    BenchmarkPopulation population;
+    string strength_name;
+    map<string, MPM_FLOAT> strength_para;
+    string eos_name;
+    map<string, MPM_FLOAT> eos_para;
+    vector<string> failure_name_list;
+    vector< map<string, MPM_FLOAT> > failure_para_list;
+    map<string, MPM_FLOAT> extra_para;
+};
+
+struct BenchmarkResult
+{
+    double ns_per_particle;
+    double cycles_per_particle;     //!< time stamp counter, 0 if not available
+    MPM_STATS failed_number;        //!< failed particles at the end of the run
+};
+
+inline uint64_t BenchmarkCycles()
+{
+#ifdef MPM_BENCHMARK_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+//!> Material parameters in SI units: steel, soil, water and TNT
+static void SteelParameter(BenchmarkCase& bc, string strength_name)
+{
+    bc.strength_name = strength_name;
+    bc.strength_para["Young"] = 2.0e11;
+    bc.strength_para["Poisson"] = 0.3;
+    if (strength_name != "IsoElastic")
+        bc.strength_para["Yield0"] = 7.92e8;
+    if (strength_name == "IsoHarden")
+        bc.strength_para["TangMod"] = 2.0e9;
+    if (strength_name == "JohnsonCook" || strength_name == "SimJohnsonCook")
+    {
+        bc.strength_para["B"] = 5.1e8;
+        bc.strength_para["n"] = 0.26;
+        bc.strength_para["C"] = 0.014;
+    }
+    if (strength_name == "JohnsonCook")
+    {
+        bc.strength_para["m"] = 1.03;
+        bc.strength_para["melt"] = 1793.0;
+        bc.strength_para["SpecHeat"] = 477.0;
+        bc.strength_para["roomt"] = 294.0;
+    }
+    bc.extra_para["ReferenceDensity"] = 7830.0;
+}
+
+static void GruneisenParameter(BenchmarkCase& bc, string eos_name)
+{
+    bc.eos_name = eos_name;
+    bc.eos_para["C0"] = 4570.0;
+    bc.eos_para["S1"] = 1.49;
+    bc.eos_para["gamma0"] = 1.93;
+}
+
+static void TNTParameter(BenchmarkCase& bc, string eos_name)
+{
+    bc.strength_name = "Null";
+    bc.eos_name = eos_name;
+    bc.eos_para["A"] = 3.712e11;
+    bc.eos_para["B"] = 3.231e9;
+    bc.eos_para["R1"] = 4.15;
+    bc.eos_para["R2"] = 0.95;
+    bc.eos_para["w"] = 0.3;
+    bc.eos_para["E0"] = 7.0e9;
+    if (eos_name == "HighExpBurn")
+    {
+        bc.eos_para["D"] = 6930.0;
+        bc.eos_para["PCJ"] = 2.1e10;
+        bc.eos_para["h"] = 0.01;
+    }
+    bc.extra_para["ReferenceDensity"] = 1630.0;
+}
+
+static void AddFailure(BenchmarkCase& bc, string failure_name, map<string, MPM_FLOAT> failure_para)
+{
+    bc.failure_name_list.push_back(failure_name);
+    bc.failure_para_list.push_back(failure_para);
+}
+
+static vector<BenchmarkCase> CreateBenchmarkCases()
+{
+    vector<BenchmarkCase> cases;
+    BenchmarkCase bc;
+
+    //!> Strength models
+    const char* strength_list[] = {"IsoElastic", "ElaPlastic", "IsoHarden", "JohnsonCook", "SimJohnsonCook"};
+    for (const char* strength_name : strength_list)
+    {
+        bc = BenchmarkCase();
+        bc.name = strength_name;
+        bc.population = bc.name == "IsoElastic" ? Elastic : Yielding;
+        SteelParameter(bc, strength_name);
+        cases.push_back(bc);
+    }
+
+    bc = BenchmarkCase();
+    bc.name = "JohnsonCook(FastMath)";
+    bc.population = Yielding;
+    SteelParameter(bc, "JohnsonCook");
+    bc.extra_para["FastMath"] = 1.0;
+    cases.push_back(bc);
+
+    bc = BenchmarkCase();
+    bc.name = "DruckerPrager";
+    bc.population = Yielding;
+    bc.strength_name = "DruckerPrager";
+    bc.strength_para["Young"] = 1.0e8;
+    bc.strength_para["Poisson"] = 0.3;
+    bc.strength_para["qfai"] = 0.5;
+    bc.strength_para["kfai"] = 1.0e5;
+    bc.strength_para["qpsi"] = 0.1;
+    bc.strength_para["tenf"] = 0.0;
+    bc.extra_para["ReferenceDensity"] = 2000.0;
+    cases.push_back(bc);
+
+    //!> EOS models
+    bc = BenchmarkCase();
+    bc.name = "JohnsonCook+Gruneisen";
+    bc.population = Yielding;
+    SteelParameter(bc, "JohnsonCook");
+    GruneisenParameter(bc, "Gruneisen");
+    cases.push_back(bc);
+
+    bc = BenchmarkCase();
+    bc.name = "ElaPlastic+SimGruneisen";
+    bc.population = Yielding;
+    SteelParameter(bc, "ElaPlastic");
+    GruneisenParameter(bc, "SimGruneisen");
+    cases.push_back(bc);
+
+    bc = BenchmarkCase();
+    bc.name = "Null+Polynomial";
+    bc.population = Elastic;
+    bc.strength_name = "Null";
+    bc.strength_para["mu"] = 1.0e-3;
+    bc.eos_name = "Polynomial";
+    bc.eos_para["c1"] = 2.2e9;
+    bc.eos_para["c2"] = 9.54e9;
+    bc.eos_para["c3"] = 1.457e10;
+    bc.eos_para["c4"] = 0.28;
+    bc.eos_para["c5"] = 0.28;
+    bc.extra_para["ReferenceDensity"] = 1000.0;
+    cases.push_back(bc);
+
+    bc = BenchmarkCase();
+    bc.name = "Null+JWL";
+    bc.population = Detonating;
+    TNTParameter(bc, "JWL");
+    cases.push_back(bc);
+
+    bc = BenchmarkCase();
+    bc.name = "Null+HighExpBurn";
+    bc.population = Detonating;
+    TNTParameter(bc, "HighExpBurn");
+    cases.push_back(bc);
+
+    //!> Failure models
+    map<string, MPM_FLOAT> failure_para;
+    bc = BenchmarkCase();
+    bc.name = "ElaPlastic+PlaStrain";
+    bc.population = Failing;
+    SteelParameter(bc, "ElaPlastic");
+    failure_para["epmax"] = 0.1;
+    AddFailure(bc, "PlaStrain", failure_para);
+    cases.push_back(bc);
+
+    bc = BenchmarkCase();
+    bc.name = "IsoElastic+PriStrain";
+    bc.population = Failing;
+    SteelParameter(bc, "IsoElastic");
+    failure_para.clear();
+    failure_para["PriStrainMin"] = -0.05;
+    failure_para["PriStrainMax"] = 0.1;
+    failure_para["ShearStrainMax"] = 0.05;
+    AddFailure(bc, "PriStrain", failure_para);
+    cases.push_back(bc);
+
+    bc = BenchmarkCase();
+    bc.name = "IsoElastic+PriStress";
+    bc.population = Failing;
+    SteelParameter(bc, "IsoElastic");
+    failure_para.clear();
+    failure_para["PriStressMin"] = -5.0e9;
+    failure_para["PriStressMax"] = 1.0e10;
+    failure_para["ShearStressMax"] = 3.0e9;
+    AddFailure(bc, "PriStress", failure_para);
+    cases.push_back(bc);
+
+    bc = BenchmarkCase();
+    bc.name = "JohnsonCook+Gruneisen+JCDamage";
+    bc.population = Failing;
+    SteelParameter(bc, "JohnsonCook");
+    GruneisenParameter(bc, "Gruneisen");
+    failure_para.clear();
+    failure_para["D1"] = 0.015;     //!< brittle, the damage approaches 1 during the run
+    failure_para["D2"] = 0.015;
+    failure_para["D3"] = 0.0;
+    failure_para["D4"] = 0.002;
+    failure_para["D5"] = 0.61;
+    AddFailure(bc, "JohnsonCookDamage", failure_para);
+    cases.push_back(bc);
+
+    return cases;
+}
+
+//!> Strain increment of one step, mostly uniaxial tension/compression with some shear
+//!>    spread over the particles, so that the particles reach the yield or failure at different steps
+static void BenchmarkStrain(BenchmarkPopulation population, MPM_STATS i, SymTensor& de, SymTensor& dv)
+{
+    MPM_FLOAT scale = 0.0;
+    switch (population)
+    {
+    case Elastic:
+        scale = 1.0e-6;
+        break;
+    case Yielding:
+        scale = 1.0e-3;
+        break;
+    case Failing:
+        scale = 1.0e-2;
+        break;
+    case Detonating:
+        scale = 1.0e-4;
+        break;
+    }
+
+    MPM_FLOAT spread = 0.5 + (i%97)/96.0;
+    MPM_FLOAT sign = population == Failing ? 1.0 : (i%2 ? 1.0 : -1.0);
+    de[0] = sign*scale*spread;
+    de[1] = -0.3*sign*scale*spread;
+    de[2] = -0.3*sign*scale*spread;
+    de[3] = 0.2*scale*((i%7) - 3)/3.0;
+    de[4] = 0.2*scale*((i%5) - 2)/2.0;
+    de[5] = 0.2*scale*((i%3) - 1);
+    dv.fill(0.0);
+    dv[0] = 0.1*scale*((i%11) - 5)/5.0;
+}
+
+//!> Reset the particles to the initial state of the population
+static void BenchmarkPopulate(BenchmarkPopulation population, DataTransfer& transfer, MPM_FLOAT density,
+    vector<PhysicalProperty>& pp, ExtraPropertyArena& arena)
+{
+    MPM_STATS number = pp.size();
+    vector<PhysicalProperty>(number).swap(pp);
+    arena.Reset();
+    arena.Allocate(pp.data(), number);
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+
+        MPM_FLOAT volume = 1.0e-9;
+        pp[i].SetMass(density*volume);
+        pp[i].SetVolume(volume);
+        pp[i].UpdateDensity();
+
+        if (pp[i].HasExtraParticleProperty(MPM::kelvin))
+            pp[i][MPM::kelvin] = transfer.roomt;
+        if (pp[i].HasExtraParticleProperty(MPM::sigma_y))
+            pp[i][MPM::sigma_y] = transfer.sigma_y;
+        if (pp[i].HasExtraParticleProperty(MPM::LT) && population == Detonating)
+            pp[i][MPM::LT] = 1.0e-6*(i%101)/100.0;  //!< detonation front through 7 mm
+    }
+}
+
+//!> Run "steps" stress updates of "number" particles, the best of "repeat" runs
+//!> The scalar path (batch = false) is the reference of the speedup
+static bool BenchmarkRun(BenchmarkCase& bc, MPM_STATS number, int steps, int repeat, bool batch,
+    BenchmarkResult& result)
+{
+    MaterialFactory material;
+    if (!material.Initialize(bc.strength_name, bc.strength_para, bc.eos_name, bc.eos_para,
+        bc.failure_name_list, bc.failure_para_list, bc.extra_para))
+        return false;
+
+    vector<MPM::ExtraParticleProperty> extra_list;
+    DataTransfer transfer;
+    if (!material.AddExtraParticleProperty(extra_list, transfer))
+        return false;
+
+    vector<PhysicalProperty> pp(number);
+    ExtraPropertyArena arena;
+    if (!arena.Initialize(number, extra_list))
+        return false;
+    vector<SymTensor> delta_strain(number), delta_vortex(number);
+    vector<MPM_FLOAT> volume_old(number);
+    for (MPM_STATS i = 0; i < number; i++)
+        BenchmarkStrain(bc.population, i, delta_strain[i], delta_vortex[i]);
+
+    MPM_FLOAT dt = 1.0e-8;
+    SimulationContext context;
+    context.SetTimeStep(dt);
+    result.ns_per_particle = DBL_MAX;
+    result.cycles_per_particle = DBL_MAX;
+    for (int r = 0; r < repeat; r++)
+    {
+        BenchmarkPopulate(bc.population, transfer, material.GetReferenceDensity(), pp, arena);
+
+        uint64_t time_ns = 0, cycles = 0;
+        for (int step = 0; step < steps; step++)
+        {
+            context.SetCurrentTime(dt*(step + 1)*10.0);
+
+            //!> Volume is updated by the solver before the stress
+            for (MPM_STATS i = 0; i < number; i++)
+            {
+                SymTensor& de = delta_strain[i];
+                volume_old[i] = pp[i].GetVolume();
+                pp[i].SetVolume(volume_old[i]*(1.0 + de[0] + de[1] + de[2]));
+                pp[i].UpdateDensity();
+            }
+
+            uint64_t start_ns = Profiler::Now();
+            uint64_t start_cycles = BenchmarkCycles();
+            if (batch)
+                material.UpdateStressBatch(pp.data(), delta_strain.data(), delta_vortex.data(),
+                    volume_old.data(), number, context);
+            else
+                for (MPM_STATS i = 0; i < number; i++)
+                    material.UpdateStress(&pp[i], delta_strain[i], delta_vortex[i], volume_old[i], context);
+            cycles += BenchmarkCycles() - start_cycles;
+            time_ns += Profiler::Now() - start_ns;
+        }
+
+        MPM_STATS particle_updates = number*(MPM_STATS)steps;
+        result.ns_per_particle = min(result.ns_per_particle, (double)time_ns/particle_updates);
+        result.cycles_per_particle = min(result.cycles_per_particle, (double)cycles/particle_updates);
+    }
+
+    result.failed_number = 0;
+    for (MPM_STATS i = 0; i < number; i++)
+        if (pp[i].is_Failed())
+            result.failed_number++;
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    MPM_STATS number = argc > 1 ? atol(argv[1]) : 16384;
+    int steps = argc > 2 ? atoi(argv[2]) : 20;
+    int repeat = argc > 3 ? atoi(argv[3]) : 5;
+    if (number <= 0 || steps <= 0 || repeat <= 0)
+    {
+        cout << "Usage: " << argv[0] << " [particle number] [steps] [repeat]" << endl;
+        return 1;
+    }
+
+    FastMathError fast_math_error = FastMath_SampleError();
+    cout << "OpenMPM3D material benchmark" << endl;
+    cout << "Particles: " << number << ", steps: " << steps << ", best of " << repeat << " runs" << endl;
+    cout << "Batch kernels: " << SIMD_InstructionSet() << endl;
+    cout << "FastMath relative error: log " << fast_math_error.log << ", exp " << fast_math_error.exp
+         << ", pow " << fast_math_error.pow << endl;
+#ifndef MPM_BENCHMARK_TSC
+    cout << "Cycles are not available on this CPU" << endl;
+#endif
+    cout << endl;
+
+    cout << left << setw(34) << "Case" << setw(12) << "Population" << setw(8) << "Path" << right
+         << setw(14) << "Particles/s" << setw(12) << "ns/particle" << setw(16) << "cycles/particle"
+         << setw(10) << "Failed" << setw(10) << "Speedup" << endl;
+
+    const char* population_name[] = {"Elastic", "Yielding", "Failing", "Detonating"};
+    vector<BenchmarkCase> cases = CreateBenchmarkCases();
+    for (auto& bc : cases)
+    {
+        double scalar_ns = 0.0;
+        for (int batch = 0; batch < 2; batch++)
+        {
+            BenchmarkResult result{};
+            if (!BenchmarkRun(bc, number, steps, repeat, batch == 1, result))
+            {
+                cout << "*** Error *** Failed to initialize the benchmark case " << bc.name << endl;
+                return 1;
+            }
+
+            cout << left << setw(34) << bc.name << setw(12) << population_name[bc.population]
+                 << setw(8) << (batch ? "Batch" : "Scalar") << right << fixed
+                 << setw(14) << setprecision(3) << scientific << 1.0e9/result.ns_per_particle << fixed
+                 << setw(12) << setprecision(2) << result.ns_per_particle
+                 << setw(16) << setprecision(1) << result.cycles_per_particle
+                 << setw(10) << result.failed_number;
+            if (batch)
+                cout << setw(10) << setprecision(2) << scalar_ns/result.ns_per_particle;
+            else
+                scalar_ns = result.ns_per_particle;
+            cout << endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,165 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Benchmark of the particle-to-grid transfer. A cube of
+        particles (8 per cell) with random velocity and stress
+        is scattered to the sparse grid with every shape
+        function in every mode of ParticleToGrid, on one
+        ThreadPool with the default backend and the given
+        schedule. The time to fill the shape function cache and
+        its size are reported for each shape function, the best
+        time of the repeats and the largest difference to the
+        serial results for each mode, and the profile summary
+        with the scheduler counters at the end.
+    Usage: MPM3D_TransferBenchmark [particle number] [threads] [repeat] [schedule]
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "../grid/ParticleToGrid.h"
+#include "../utility/Profiler.h"
+#include <iomanip>
+#include <random>
+
+//!> Largest difference of node values to the reference, relative to the largest reference value
+static MPM_FLOAT RelativeDifference(const vector<MPM_FLOAT>& value, const vector<MPM_FLOAT>& reference)
+{
+    MPM_FLOAT difference = 0.0, scale = 0.0;
+    for (size_t i = 0; i < value.size(); i++)
+    {
+        difference = max(difference, fabs(value[i] - reference[i]));
+        scale = max(scale, fabs(reference[i]));
+    }
+    return scale > 0.0 ? difference/scale : difference;
+}
+
+//!> Mass, momentum and force of all nodes in one array
+static void CollectNodeValues(SparseGrid& grid, vector<MPM_FLOAT>& value)
+{
+    MPM_STATS node_number = grid.GetNodeNumber();
+    value.resize(7*(size_t)node_number);
+    MPM_FLOAT* arrays[7] = {grid.GetMass(), grid.GetMomentum(0), grid.GetMomentum(1), grid.GetMomentum(2),
+        grid.GetForce(0), grid.GetForce(1), grid.GetForce(2)};
+    for (int k = 0; k < 7; k++)
+        copy(arrays[k], arrays[k] + node_number, value.begin() + (size_t)k*node_number);
+}
+
+int main(int argc, char* argv[])
+{
+    MPM_STATS particle_number = argc > 1 ? atoi(argv[1]) : 1000000;
+    int thread_number = argc > 2 ? atoi(argv[2]) : 0;
+    int repeat = argc > 3 ? atoi(argv[3]) : 5;
+    ThreadPool::Schedule schedule = ThreadPool::Static;
+    if (particle_number <= 0 || thread_number < 0 || repeat <= 0 || 
+        (argc > 4 && !ThreadPool::ParseSchedule(argv[4], schedule)))
+    {
+        cout << "Usage: " << argv[0] << " [particle number] [threads] [repeat] [schedule]" << endl;
+        return 1;
+    }
+
+    //!> Particles in a cube of cells, 8 per cell at random positions
+    const MPM_FLOAT cell_size = 1e-3;
+    const MPM_FLOAT density = 7800.0;
+    int cell_edge = max(1, (int)ceil(cbrt(particle_number/8.0)));
+    vector<MPM::ExtraParticleProperty> extra_property;
+    ParticleStore store;
+    if (!store.Initialize(particle_number, extra_property))
+        return 1;
+
+    mt19937_64 generator(20261016);
+    uniform_real_distribution<MPM_FLOAT> unit(0.0, 1.0);
+    for (MPM_STATS p = 0; p < particle_number; p++)
+    {
+        MPM_STATS cell = p/8;
+        int index[3] = {(int)(cell % cell_edge), (int)(cell/cell_edge % cell_edge), (int)(cell/cell_edge/cell_edge)};
+        for (int k = 0; k < 3; k++)
+        {
+            store.GetPosition(k)[p] = (index[k] + unit(generator))*cell_size;
+            store.GetVelocity(k)[p] = 100.0*(unit(generator) - 0.5);
+        }
+        store.GetVolume()[p] = cell_size*cell_size*cell_size/8.0;
+        store.GetMass()[p] = density*store.GetVolume()[p];
+        store.GetMeanStress()[p] = 1e8*(unit(generator) - 0.5);
+        store.GetBulkViscosity()[p] = 0.0;
+        for (int k = 0; k < 6; k++)
+            store.GetDeviatoricStress(k)[p] = 1e8*(unit(generator) - 0.5);
+    }
+
+    SparseGrid grid;
+    Array3D origin = {0.0, 0.0, 0.0};
+    Array3D gravity = {0.0, 0.0, -9.8};
+    if (!grid.Initialize(origin, cell_size))
+        return 1;
+
+    ThreadPool pool;
+    if (!pool.Initialize(thread_number))
+        return 1;
+    pool.SetSchedule(schedule);
+    Profiler::SetEnabled(true);
+
+    vector<MPM_FLOAT> reference, value;
+    for (MPM::ShapeFunctionType type : {MPM::LinearShape, MPM::GIMPShape, MPM::QuadraticBSpline, MPM::CubicBSpline})
+    {
+        ShapeFunction shape;
+        if (!shape.Initialize(type) || !grid.Rebuild(store, shape.GetStencilLow(), shape.GetStencilHigh()))
+            return 1;
+
+        uint64_t best = UINT64_MAX;
+        for (int r = 0; r < repeat; r++)
+        {
+            uint64_t start = Profiler::Now();
+            if (!shape.Update(store, grid, &pool))
+                return 1;
+            best = min(best, Profiler::Now() - start);
+        }
+        cout << endl << "Shape function: " << ShapeFunction::TypeName(type) << ", particles: " << particle_number
+             << ", blocks: " << grid.GetBlockNumber() << ", nodes: " << grid.GetNodeNumber() << endl;
+        cout << "Cache update: " << best*1e-6 << " ms, cache size: " 
+             << shape.GetMemoryBytes()/(1024.0*1024.0) << " MB" << endl;
+
+        cout << setw(10) << "Mode" << setw(10) << "Threads" << setw(14) << "Time (ms)"
+             << setw(16) << "Particles/s" << setw(14) << "Difference" << endl;
+        for (ParticleToGrid::TransferMode mode : {ParticleToGrid::Serial, ParticleToGrid::Atomic, 
+            ParticleToGrid::Colored})
+        {
+            ParticleToGrid transfer;
+            if (!transfer.Initialize(mode, &pool))
+                return 1;
+
+            best = UINT64_MAX;
+            for (int r = 0; r < repeat; r++)
+            {
+                grid.ResetNodes();
+                uint64_t start = Profiler::Now();
+                if (!transfer.Transfer(store, grid, shape, gravity))
+                    return 1;
+                best = min(best, Profiler::Now() - start);
+            }
+
+            CollectNodeValues(grid, value);
+            if (mode == ParticleToGrid::Serial)
+                reference = value;
+            double milliseconds = best*1e-6;
+            cout << setw(10) << ParticleToGrid::ModeName(mode) << setw(10) << transfer.GetThreadNumber()
+                 << setw(14) << fixed << setprecision(3) << milliseconds
+                 << setw(16) << scientific << setprecision(3) << particle_number/max(milliseconds*1e-3, 1e-12)
+                 << setw(14) << RelativeDifference(value, reference) << endl;
+            cout.unsetf(ios::floatfield);
+        }
+    }
+    cout << endl;
+    Profiler::WriteSummary(cout);
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of class 'ExtraPropertyArena'
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "ExtraPropertyArena.h"
+#include "../utility/AlignedMemory.h"
+
+ExtraPropertyArena::ExtraPropertyArena()
+{
+    _data = nullptr;
+    _capacity = 0;
+    _allocated_number = 0;
+    _stride = 0;
+    for (int i = 0; i < MPM::ExtraParticlePropertySum; i++)
+        _positions[i] = -1;
+}
+
+ExtraPropertyArena::~ExtraPropertyArena()
+{
+    Clear();
+}
+
+bool ExtraPropertyArena::Initialize(MPM_STATS number, vector<MPM::ExtraParticleProperty>& extra_property)
+{
+    Clear();
+
+    //!> The same property may be required by several models
+    for (auto prop : extra_property)
+    {
+        if (_positions[prop] < 0)
+            _positions[prop] = _stride++;
+    }
+
+    if (number > 0 && _stride > 0)
+    {
+        _data = AlignedAllocate<MPM_FLOAT>(number*_stride);
+        if (!_data)
+        {
+            string error_msg = "*** Error *** Failed to allocate extra particle properties for " + 
+                to_string(number) + " particles.";
+            MPM3D_ErrorMessage(__FILE__, __LINE__, error_msg);
+            Clear();
+            return false;
+        }
+    }
+    _capacity = number;
+    return true;
+}
+
+bool ExtraPropertyArena::Allocate(PhysicalProperty* pp, MPM_STATS number)
+{
+    if (number > _capacity - _allocated_number)
+    {
+        string error_msg = "*** Error *** The extra property arena of " + to_string(_capacity) + 
+            " particles is full.";
+        MPM3D_ErrorMessage(__FILE__, __LINE__, error_msg);
+        return false;
+    }
+
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        MPM_FLOAT* row = _data ? _data + (size_t)(_allocated_number + i)*_stride : nullptr;
+        pp[i].BindExtraParticleProperty(row, _positions);
+    }
+    _allocated_number += number;
+    return true;
+}
+
+void ExtraPropertyArena::Reset()
+{
+    if (_data)
+        fill(_data, _data + (size_t)_capacity*_stride, 0.0);
+    _allocated_number = 0;
+}
+
+void ExtraPropertyArena::Clear()
+{
+    AlignedFree(_data);
+    _capacity = 0;
+    _allocated_number = 0;
+    _stride = 0;
+    for (int i = 0; i < MPM::ExtraParticlePropertySum; i++)
+        _positions[i] = -1;
+}
@@ -0,0 +1,67 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Arena of extra particle properties. The properties
+        of all particles of a body are taken from one aligned
+        block, each particle owns a row of "stride" values,
+        stride being the number of enabled properties, so a
+        body costs one allocation and the history variables
+        of neighbouring particles are neighbours in memory.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _EXTRAPROPERTYARENA_H_
+#define _EXTRAPROPERTYARENA_H_
+
+#include "../main/MPM3D_MACRO.h"
+#include "PhysicalProperty.h"
+
+class ExtraPropertyArena
+{
+public:
+    ExtraPropertyArena();
+    ~ExtraPropertyArena();
+
+    ExtraPropertyArena(const ExtraPropertyArena&) = delete;
+    ExtraPropertyArena& operator=(const ExtraPropertyArena&) = delete;
+
+    //!> Allocate the block for "number" particles with the enabled extra particle properties
+    bool Initialize(MPM_STATS number, vector<MPM::ExtraParticleProperty>& extra_property);
+
+    //!> Bind the next "number" rows to the particles, return false if the arena is full
+    bool Allocate(PhysicalProperty* pp, MPM_STATS number);
+
+    //!> Set all values to zero and release all rows, particles bound before should be bound again
+    void Reset();
+private:
+    //!> Release the block
+    void Clear();
+private:
+    MPM_FLOAT* _data;
+    MPM_STATS _capacity;                                //!< number of rows of "_data"
+    MPM_STATS _allocated_number;                        //!< rows [0, _allocated_number) are bound to particles
+    int _stride;                                        //!< number of enabled extra properties
+    int _positions[MPM::ExtraParticlePropertySum];      //!< position in a row, -1 if not enabled
+
+public:
+    inline MPM_FLOAT* GetData() {return _data;}
+    inline MPM_STATS GetCapacity() {return _capacity;}
+    inline MPM_STATS GetAllocatedNumber() {return _allocated_number;}
+    inline int GetStride() {return _stride;}
+    inline int* GetPositions() {return _positions;}
+};
+
+#endif
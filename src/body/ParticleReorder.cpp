@@ -0,0 +1,188 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of class 'ParticleReorder'
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "ParticleReorder.h"
+#include "../utility/Profiler.h"
+
+ParticleReorder::ParticleReorder()
+{
+    _origin.fill(0.0);
+    _inverse_cell_size = 1.0;
+    _max_cell = (MPM_FLOAT)((1 << 21) - 1);
+    _interval = 0;
+    _check_interval = 0;
+    _tolerance = 0.0;
+
+    _last_step = 0;
+    _locality = 0.0;
+    _locality_reordered = 0.0;
+    _reorder_number = 0;
+
+    _profile_reorder = Profiler::Register("ParticleStore/Reorder");
+    _profile_locality = Profiler::Register("ParticleStore/Locality");
+}
+
+ParticleReorder::~ParticleReorder()
+{
+}
+
+bool ParticleReorder::Initialize(const Array3D& origin, MPM_FLOAT cell_size, int interval, int check_interval, 
+    MPM_FLOAT tolerance)
+{
+    if (cell_size <= MPM_EPSILON)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** INPUT ERROR *** cell size of reordering should be positive.");
+        return false;
+    }
+
+    if (interval < 0 || check_interval < 0 || tolerance < 0.0)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, 
+            "*** INPUT ERROR *** intervals and tolerance of reordering should not be negative.");
+        return false;
+    }
+
+    _origin = origin;
+    _inverse_cell_size = 1.0/cell_size;
+    _interval = interval;
+    _check_interval = check_interval;
+    _tolerance = tolerance;
+    _last_step = 0;
+    _locality = 0.0;
+    _locality_reordered = 0.0;
+    _reorder_number = 0;
+    return true;
+}
+
+bool ParticleReorder::Update(ParticleStore& store, int step, ostream& log)
+{
+    streamsize precision = log.precision(4);
+    bool reorder = _interval > 0 && step - _last_step >= _interval;
+    if (_check_interval > 0 && step%_check_interval == 0)
+    {
+        _locality = Locality(store);
+        log << "Step " << step << ": particle locality " << _locality 
+            << " (" << _locality_reordered << " after the last reorder)" << endl;
+        reorder = reorder || _locality > _locality_reordered + _tolerance;
+    }
+
+    bool reordered = reorder && Reorder(store);
+    if (reordered)
+    {
+        _last_step = step;
+        if (_check_interval > 0)
+        {
+            _locality_reordered = Locality(store);
+            _locality = _locality_reordered;
+            log << "Step " << step << ": particles are reordered, locality " << _locality_reordered << endl;
+        }
+    }
+    log.precision(precision);
+    return reordered;
+}
+
+bool ParticleReorder::Reorder(ParticleStore& store)
+{
+    MPM_STATS number = store.GetActiveNumber();
+    ProfileScope profile(_profile_reorder, number);
+    if (number < 2)
+        return true;
+
+    _key.resize(number);
+    _key_buffer.resize(number);
+    _order.resize(number);
+    _order_buffer.resize(number);
+
+    uint64_t max_key = 0;
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        uint32_t cell[3];
+        _Cell(store, i, cell);
+        _key[i] = MortonIndex(cell[0], cell[1], cell[2]);
+        _order[i] = i;
+        max_key = max(max_key, _key[i]);
+    }
+
+    //!> Stable LSD radix sort on the bytes in use, particles in one cell keep their order
+    for (int shift = 0; shift < 64 && (max_key >> shift) > 0; shift += 8)
+    {
+        MPM_STATS count[257] = {0};
+        for (MPM_STATS i = 0; i < number; i++)
+            count[((_key[i] >> shift) & 0xFF) + 1]++;
+        for (int b = 0; b < 256; b++)
+            count[b + 1] += count[b];
+        
+        for (MPM_STATS i = 0; i < number; i++)
+        {
+            MPM_STATS& position = count[(_key[i] >> shift) & 0xFF];
+            _key_buffer[position] = _key[i];
+            _order_buffer[position] = _order[i];
+            position++;
+        }
+        _key.swap(_key_buffer);
+        _order.swap(_order_buffer);
+    }
+
+    if (!store.Permute(_order.data(), number))
+        return false;
+    
+    _reorder_number++;
+    return true;
+}
+
+MPM_FLOAT ParticleReorder::Locality(ParticleStore& store)
+{
+    MPM_STATS number = store.GetActiveNumber();
+    ProfileScope profile(_profile_locality, number);
+    if (number < 2)
+        return 0.0;
+
+    MPM_STATS far_number = 0;
+    uint32_t last[3], cell[3];
+    _Cell(store, 0, last);
+    for (MPM_STATS i = 1; i < number; i++)
+    {
+        _Cell(store, i, cell);
+        bool neighbour = true;
+        for (int k = 0; k < 3; k++)
+        {
+            neighbour = neighbour && cell[k] + 1 >= last[k] && cell[k] <= last[k] + 1;
+            last[k] = cell[k];
+        }
+        far_number += neighbour ? 0 : 1;
+    }
+    return (MPM_FLOAT)far_number/(number - 1);
+}
+
+uint64_t ParticleReorder::MortonIndex(uint32_t ix, uint32_t iy, uint32_t iz)
+{
+    //!> Spread the 21 low bits so that two zero bits are between adjacent bits
+    auto spread = [](uint64_t x)
+    {
+        x &= 0x1FFFFF;
+        x = (x | (x << 32)) & 0x1F00000000FFFFULL;
+        x = (x | (x << 16)) & 0x1F0000FF0000FFULL;
+        x = (x | (x << 8)) & 0x100F00F00F00F00FULL;
+        x = (x | (x << 4)) & 0x10C30C30C30C30C3ULL;
+        x = (x | (x << 2)) & 0x1249249249249249ULL;
+        return x;
+    };
+    return spread(ix) | (spread(iy) << 1) | (spread(iz) << 2);
+}
@@ -0,0 +1,99 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Space-filling-curve reordering of particles. Active
+        particles are sorted by the Morton index of their cell
+        in the background grid, so consecutive particles touch
+        neighbouring grid nodes. The sort is a stable radix
+        sort of the keys, the fields are moved once each by
+        "ParticleStore::Permute". The locality metric is the
+        fraction of consecutive particles in cells which are
+        not neighbours, reordering is triggered every
+        "interval" steps or when the metric degrades.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _PARTICLEREORDER_H_
+#define _PARTICLEREORDER_H_
+
+#include "../main/MPM3D_MACRO.h"
+#include "ParticleStore.h"
+#include <cstdint>
+
+class ParticleReorder
+{
+public:
+    ParticleReorder();
+    ~ParticleReorder();
+
+    //!> Cells of the background grid start at "origin" with the edge length "cell_size"
+    //!> Reorder every "interval" steps (0 to disable), the locality is checked every "check_interval" steps
+    //!>    and particles are reordered if it exceeds the value after the last reorder by "tolerance"
+    bool Initialize(const Array3D& origin, MPM_FLOAT cell_size, int interval, int check_interval, 
+        MPM_FLOAT tolerance);
+
+    //!> Called once per step, write the locality to "log" when checked
+    //!> Return true if the particles are reordered, arrays indexed the same as the store should be
+    //!>    rebuilt or reordered by "ParticleStore::GetParticleID"
+    bool Update(ParticleStore& store, int step, ostream& log);
+
+    //!> Sort the active particles by the Morton index of their cells
+    bool Reorder(ParticleStore& store);
+
+    //!> Fraction of consecutive active particles in cells which are not neighbours, 0 is the best
+    MPM_FLOAT Locality(ParticleStore& store);
+
+    //!> Morton index of a cell, 21 bits of each index are interleaved
+    static uint64_t MortonIndex(uint32_t ix, uint32_t iy, uint32_t iz);
+private:
+    //!> Cell indices of particle "index", clamped to [0, 2^21)
+    inline void _Cell(ParticleStore& store, MPM_STATS index, uint32_t (&cell)[3])
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            MPM_FLOAT x = (store.GetPosition(k)[index] - _origin[k])*_inverse_cell_size;
+            x = x < 0.0 ? 0.0 : x;
+            x = x > _max_cell ? _max_cell : x;
+            cell[k] = (uint32_t)x;
+        }
+    }
+private:
+    Array3D _origin;
+    MPM_FLOAT _inverse_cell_size;
+    MPM_FLOAT _max_cell;
+    int _interval;
+    int _check_interval;
+    MPM_FLOAT _tolerance;
+
+    int _last_step;                     //!< step of the last reorder
+    MPM_FLOAT _locality;                //!< value of the last check
+    MPM_FLOAT _locality_reordered;      //!< value after the last reorder
+    MPM_STATS _reorder_number;
+
+    //!> Work arrays of the radix sort, kept between calls
+    vector<uint64_t> _key, _key_buffer;
+    vector<MPM_STATS> _order, _order_buffer;
+
+    //!> Profiler entries
+    int _profile_reorder;
+    int _profile_locality;
+
+public:
+    inline MPM_FLOAT GetLocality() {return _locality;}
+    inline MPM_STATS GetReorderNumber() {return _reorder_number;}
+};
+
+#endif
@@ -0,0 +1,430 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of class 'ParticleStore'
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "ParticleStore.h"
+#include "../utility/AlignedMemory.h"
+#include <cstring>
+#include <type_traits>
+
+ParticleStore::ParticleStore()
+{
+    _particle_number = 0;
+    _active_number = 0;
+    _particle_id = nullptr;
+    for (int i = 0; i < 3; i++)
+    {
+        _position[i] = nullptr;
+        _velocity[i] = nullptr;
+    }
+
+    _mass = nullptr;
+    _volume = nullptr;
+    _density = nullptr;
+    _mean_stress = nullptr;
+    for (int i = 0; i < 6; i++)
+        _deviatoric_stress[i] = nullptr;
+    _equivalent_stress = nullptr;
+    _bulk_q = nullptr;
+    _internal_energy = nullptr;
+    _sound_speed = nullptr;
+    _failure = nullptr;
+    _eroded = nullptr;
+    _cost = nullptr;
+
+    for (int i = 0; i < MPM::ExtraParticlePropertySum; i++)
+    {
+        _extra_properties[i] = nullptr;
+        _extra_property_positions[i] = -1;
+    }
+    _extra_property_number = 0;
+}
+
+ParticleStore::~ParticleStore()
+{
+    Clear();
+}
+
+bool ParticleStore::Initialize(MPM_STATS number, vector<MPM::ExtraParticleProperty>& extra_property)
+{
+    Clear();
+    _particle_number = number;
+    _active_number = number;
+
+    _particle_id = AlignedAllocate<MPM_STATS>(number);
+    for (int i = 0; i < 3; i++)
+    {
+        _position[i] = AlignedAllocate<MPM_FLOAT>(number);
+        _velocity[i] = AlignedAllocate<MPM_FLOAT>(number);
+    }
+    _mass = AlignedAllocate<MPM_FLOAT>(number);
+    _volume = AlignedAllocate<MPM_FLOAT>(number);
+    _density = AlignedAllocate<MPM_FLOAT>(number);
+    _mean_stress = AlignedAllocate<MPM_FLOAT>(number);
+    for (int i = 0; i < 6; i++)
+        _deviatoric_stress[i] = AlignedAllocate<MPM_FLOAT>(number);
+    _equivalent_stress = AlignedAllocate<MPM_FLOAT>(number);
+    _bulk_q = AlignedAllocate<MPM_FLOAT>(number);
+    _internal_energy = AlignedAllocate<MPM_FLOAT>(number);
+    _sound_speed = AlignedAllocate<MPM_FLOAT>(number);
+    _failure = AlignedAllocate<bool>(number);
+    _eroded = AlignedAllocate<bool>(number);
+    _cost = AlignedAllocate<MPM_FLOAT>(number);
+
+    bool allocated = _particle_id && _mass && _volume && _density && _mean_stress && _equivalent_stress &&
+        _bulk_q && _internal_energy && _sound_speed && _failure && _eroded && _cost;
+    for (int i = 0; i < 3; i++)
+        allocated = allocated && _position[i] && _velocity[i];
+    for (int i = 0; i < 6; i++)
+        allocated = allocated && _deviatoric_stress[i];
+
+    //!> The same property may be required by several models
+    for (auto prop : extra_property)
+    {
+        if (_extra_property_positions[prop] >= 0)
+            continue;
+        _extra_property_positions[prop] = _extra_property_number++;
+        _extra_properties[prop] = AlignedAllocate<MPM_FLOAT>(number);
+        allocated = allocated && _extra_properties[prop];
+    }
+
+    if (number > 0 && !allocated)
+    {
+        string error_msg = "*** Error *** Failed to allocate memory for " + to_string(number) + " particles.";
+        MPM3D_ErrorMessage(__FILE__, __LINE__, error_msg);
+        Clear();
+        return false;
+    }
+
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        _particle_id[i] = i;
+        _cost[i] = 1.0;
+    }
+    return true;
+}
+
+void ParticleStore::Gather(MPM_STATS index, PhysicalProperty* pp)
+{
+    pp->_mass = _mass[index];
+    pp->_volume = _volume[index];
+    pp->_density = _density[index];
+    pp->_mean_stress = _mean_stress[index];
+    for (int i = 0; i < 6; i++)
+        pp->_deviatoric_stress[i] = _deviatoric_stress[i][index];
+    pp->_equivalent_stress = _equivalent_stress[index];
+    pp->_bulk_q = _bulk_q[index];
+    pp->_internal_energy = _internal_energy[index];
+    pp->_sound_speed = _sound_speed[index];
+    pp->_failure = _failure[index];
+    pp->_eroded = _eroded[index];
+
+    for (int i = 0; i < MPM::ExtraParticlePropertySum; i++)
+        if (_extra_properties[i])
+            pp->_extra_properties[_extra_property_positions[i]] = _extra_properties[i][index];
+}
+
+void ParticleStore::Scatter(MPM_STATS index, PhysicalProperty* pp)
+{
+    _mass[index] = pp->_mass;
+    _volume[index] = pp->_volume;
+    _density[index] = pp->_density;
+    _mean_stress[index] = pp->_mean_stress;
+    for (int i = 0; i < 6; i++)
+        _deviatoric_stress[i][index] = pp->_deviatoric_stress[i];
+    _equivalent_stress[index] = pp->_equivalent_stress;
+    _bulk_q[index] = pp->_bulk_q;
+    _internal_energy[index] = pp->_internal_energy;
+    _sound_speed[index] = pp->_sound_speed;
+    _failure[index] = pp->_failure;
+    _eroded[index] = pp->_eroded;
+
+    for (int i = 0; i < MPM::ExtraParticlePropertySum; i++)
+        if (_extra_properties[i])
+            _extra_properties[i][index] = pp->_extra_properties[_extra_property_positions[i]];
+}
+
+MPM_STATS ParticleStore::CompactEroded()
+{
+    MPM_STATS eroded_number = 0;
+    for (MPM_STATS i = 0; i < _active_number; i++)
+        if (_eroded[i])
+            eroded_number++;
+    
+    if (eroded_number == 0)
+        return 0;
+
+    //!> Stable partition: active particles in order, then the eroded ones in order
+    MPM_STATS* order = AlignedAllocate<MPM_STATS>(_active_number);
+    if (!order)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Failed to allocate memory for compaction.");
+        return 0;
+    }
+
+    MPM_STATS active = 0, eroded = _active_number - eroded_number;
+    for (MPM_STATS i = 0; i < _active_number; i++)
+    {
+        if (_eroded[i])
+            order[eroded++] = i;
+        else
+            order[active++] = i;
+    }
+
+    bool permuted = Permute(order, _active_number);
+    AlignedFree(order);
+    if (!permuted)
+        return 0;
+    
+    _active_number -= eroded_number;
+    return eroded_number;
+}
+
+bool ParticleStore::Permute(const MPM_STATS* order, MPM_STATS number)
+{
+    MPM_FLOAT* buffer = AlignedAllocate<MPM_FLOAT>(number);
+    MPM_STATS* id_buffer = AlignedAllocate<MPM_STATS>(number);
+    bool* flag_buffer = AlignedAllocate<bool>(number);
+    if (number > 0 && !(buffer && id_buffer && flag_buffer))
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Failed to allocate memory for reordering particles.");
+        AlignedFree(buffer);
+        AlignedFree(id_buffer);
+        AlignedFree(flag_buffer);
+        return false;
+    }
+
+    _Permute(_particle_id, order, number, id_buffer);
+    for (int i = 0; i < 3; i++)
+    {
+        _Permute(_position[i], order, number, buffer);
+        _Permute(_velocity[i], order, number, buffer);
+    }
+    _Permute(_mass, order, number, buffer);
+    _Permute(_volume, order, number, buffer);
+    _Permute(_density, order, number, buffer);
+    _Permute(_mean_stress, order, number, buffer);
+    for (int i = 0; i < 6; i++)
+        _Permute(_deviatoric_stress[i], order, number, buffer);
+    _Permute(_equivalent_stress, order, number, buffer);
+    _Permute(_bulk_q, order, number, buffer);
+    _Permute(_internal_energy, order, number, buffer);
+    _Permute(_sound_speed, order, number, buffer);
+    _Permute(_failure, order, number, flag_buffer);
+    _Permute(_eroded, order, number, flag_buffer);
+    _Permute(_cost, order, number, buffer);
+
+    for (int i = 0; i < MPM::ExtraParticlePropertySum; i++)
+        if (_extra_properties[i])
+            _Permute(_extra_properties[i], order, number, buffer);
+
+    AlignedFree(buffer);
+    AlignedFree(id_buffer);
+    AlignedFree(flag_buffer);
+    return true;
+}
+
+template<class Visit>
+void ParticleStore::_ForEachArray(Visit visit)
+{
+    visit(_particle_id);
+    for (int i = 0; i < 3; i++)
+    {
+        visit(_position[i]);
+        visit(_velocity[i]);
+    }
+    visit(_mass);
+    visit(_volume);
+    visit(_density);
+    visit(_mean_stress);
+    for (int i = 0; i < 6; i++)
+        visit(_deviatoric_stress[i]);
+    visit(_equivalent_stress);
+    visit(_bulk_q);
+    visit(_internal_energy);
+    visit(_sound_speed);
+    visit(_failure);
+    visit(_eroded);
+    visit(_cost);
+
+    for (int i = 0; i < MPM::ExtraParticlePropertySum; i++)
+        if (_extra_properties[i])
+            visit(_extra_properties[i]);
+}
+
+size_t ParticleStore::GetPackedBytes()
+{
+    size_t bytes = 0;
+    _ForEachArray([&](auto*& array) {bytes += sizeof(*array);});
+    return bytes;
+}
+
+void ParticleStore::Pack(MPM_STATS index, char* buffer)
+{
+    _ForEachArray([&](auto*& array)
+    {
+        memcpy(buffer, array + index, sizeof(*array));
+        buffer += sizeof(*array);
+    });
+}
+
+void ParticleStore::Unpack(MPM_STATS index, const char* buffer)
+{
+    _ForEachArray([&](auto*& array)
+    {
+        memcpy(array + index, buffer, sizeof(*array));
+        buffer += sizeof(*array);
+    });
+}
+
+bool ParticleStore::Migrate(const vector<MPM_STATS>& leaving, const char* arrival, MPM_STATS arrival_number)
+{
+    MPM_STATS leaving_number = (MPM_STATS)leaving.size();
+    if (leaving_number == 0 && arrival_number == 0)
+        return true;
+
+    //!> Staying active particles, the eroded ones, then the leaving ones, which are cut off by the resize
+    MPM_STATS* order = AlignedAllocate<MPM_STATS>(_particle_number);
+    if (_particle_number > 0 && !order)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Failed to allocate memory for migration.");
+        return false;
+    }
+    MPM_STATS stay = 0, k = 0;
+    for (MPM_STATS i = 0; i < _active_number; i++)
+    {
+        if (k < leaving_number && leaving[k] == i)
+            k++;
+        else
+            order[stay++] = i;
+    }
+    MPM_STATS eroded_number = _particle_number - _active_number;
+    for (MPM_STATS i = 0; i < eroded_number; i++)
+        order[stay + i] = _active_number + i;
+    for (k = 0; k < leaving_number; k++)
+        order[stay + eroded_number + k] = leaving[k];
+
+    bool permuted = Permute(order, _particle_number);
+    AlignedFree(order);
+    if (!permuted || !_Resize(stay + arrival_number + eroded_number))
+        return false;
+
+    if (arrival_number > 0)
+    {
+        _ForEachArray([&](auto*& array)
+        {
+            copy_backward(array + stay, array + stay + eroded_number, array + stay + arrival_number + eroded_number);
+        });
+        size_t bytes = GetPackedBytes();
+        for (MPM_STATS i = 0; i < arrival_number; i++)
+            Unpack(stay + i, arrival + i*bytes);
+    }
+    _active_number = stay + arrival_number;
+    return true;
+}
+
+size_t ParticleStore::GetMemoryBytes()
+{
+    //!> Position, velocity, mass, volume, density, mean stress, deviatoric stress, equivalent stress, 
+    //!>    bulk viscosity, internal energy, sound speed and cost
+    const size_t float_number = 21 + _extra_property_number;
+    size_t length = (size_t)PaddedLength(_particle_number);
+    return length*(float_number*sizeof(MPM_FLOAT) + sizeof(MPM_STATS) + 2*sizeof(bool));
+}
+
+bool ParticleStore::_Resize(MPM_STATS number)
+{
+    //!> All arrays are allocated before any is replaced, so that the store is kept if one fails
+    vector<void*> resized;
+    bool allocated = true;
+    _ForEachArray([&](auto*& array)
+    {
+        typedef typename remove_reference<decltype(*array)>::type T;
+        T* memory = AlignedAllocate<T>(number);
+        allocated = allocated && (number == 0 || memory);
+        resized.push_back(memory);
+    });
+
+    size_t k = 0;
+    if (!allocated)
+    {
+        _ForEachArray([&](auto*& array)
+        {
+            typedef typename remove_reference<decltype(*array)>::type T;
+            T* memory = (T*)resized[k++];
+            AlignedFree(memory);
+        });
+        string error_msg = "*** Error *** Failed to allocate memory for " + to_string(number) + " particles.";
+        MPM3D_ErrorMessage(__FILE__, __LINE__, error_msg);
+        return false;
+    }
+
+    MPM_STATS kept = min(number, _particle_number);
+    _ForEachArray([&](auto*& array)
+    {
+        typedef typename remove_reference<decltype(*array)>::type T;
+        T* memory = (T*)resized[k++];
+        copy(array, array + kept, memory);
+        AlignedFree(array);
+        array = memory;
+    });
+    _particle_number = number;
+    _active_number = min(_active_number, number);
+    return true;
+}
+
+template<class T>
+void ParticleStore::_Permute(T* array, const MPM_STATS* order, MPM_STATS number, T* buffer)
+{
+    for (MPM_STATS i = 0; i < number; i++)
+        buffer[i] = array[order[i]];
+    copy(buffer, buffer + number, array);
+}
+
+void ParticleStore::Clear()
+{
+    AlignedFree(_particle_id);
+    for (int i = 0; i < 3; i++)
+    {
+        AlignedFree(_position[i]);
+        AlignedFree(_velocity[i]);
+    }
+    AlignedFree(_mass);
+    AlignedFree(_volume);
+    AlignedFree(_density);
+    AlignedFree(_mean_stress);
+    for (int i = 0; i < 6; i++)
+        AlignedFree(_deviatoric_stress[i]);
+    AlignedFree(_equivalent_stress);
+    AlignedFree(_bulk_q);
+    AlignedFree(_internal_energy);
+    AlignedFree(_sound_speed);
+    AlignedFree(_failure);
+    AlignedFree(_eroded);
+    AlignedFree(_cost);
+
+    for (int i = 0; i < MPM::ExtraParticlePropertySum; i++)
+    {
+        AlignedFree(_extra_properties[i]);
+        _extra_property_positions[i] = -1;
+    }
+    _extra_property_number = 0;
+    _particle_number = 0;
+    _active_number = 0;
+}
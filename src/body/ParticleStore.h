@@ -0,0 +1,142 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Structure-of-arrays storage of particle physical
+        properties. Each field (and each enabled extra particle
+        property) is a contiguous aligned array, so that the
+        material kernels stream memory linearly. Existing model
+        codes work on a PhysicalProperty view of one particle
+        through "Gather" and "Scatter", positions and
+        velocities are only kept in the store.
+        Eroded particles are compacted out to the back, so that
+        loops only run over the active particles at the front.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _PARTICLESTORE_H_
+#define _PARTICLESTORE_H_
+
+#include "../main/MPM3D_MACRO.h"
+#include "PhysicalProperty.h"
+
+class ParticleStore
+{
+public:
+    ParticleStore();
+    ~ParticleStore();
+
+    //!> Allocate arrays for particles with the enabled extra particle properties
+    bool Initialize(MPM_STATS number, vector<MPM::ExtraParticleProperty>& extra_property);
+
+    //!> Copy the properties of particle "index" into a PhysicalProperty view
+    //!> The view should be bound to extra property memory with "GetExtraPropertyPositions()"
+    void Gather(MPM_STATS index, PhysicalProperty* pp);
+
+    //!> Copy a PhysicalProperty view back to particle "index"
+    void Scatter(MPM_STATS index, PhysicalProperty* pp);
+
+    //!> Move the eroded particles among the active ones behind them, keeping the order of both parts
+    //!> Return the number of particles moved out, the active number is reduced by it
+    //!> Arrays indexed the same as the store should be rebuilt or reordered by "GetParticleID"
+    MPM_STATS CompactEroded();
+
+    //!> Reorder the first "number" particles, slot i takes the particle in slot order[i]
+    //!> "order" should be a permutation of [0, number)
+    bool Permute(const MPM_STATS* order, MPM_STATS number);
+
+    //!> Bytes of one particle packed by "Pack", the same for stores with the same extra properties
+    size_t GetPackedBytes();
+
+    //!> Copy all fields of particle "index" to "buffer" of "GetPackedBytes()" bytes, and back by "Unpack"
+    void Pack(MPM_STATS index, char* buffer);
+    void Unpack(MPM_STATS index, const char* buffer);
+
+    //!> Remove the active particles "leaving", in ascending order, and add "arrival_number" packed particles
+    //!>    from "arrival" behind the other active particles. The eroded particles are kept behind them.
+    //!> Arrays indexed the same as the store should be rebuilt, the particle IDs move with the particles
+    bool Migrate(const vector<MPM_STATS>& leaving, const char* arrival, MPM_STATS arrival_number);
+
+    //!> Bytes of the particle arrays
+    size_t GetMemoryBytes();
+private:
+    //!> Release all arrays
+    void Clear();
+
+    //!> Call "visit(array)" with a reference to the pointer of each array, extra properties if enabled
+    template<class Visit>
+    void _ForEachArray(Visit visit);
+
+    //!> Reallocate all arrays for "number" particles, keeping the first ones
+    bool _Resize(MPM_STATS number);
+
+    //!> Reorder one array by "order" through "buffer"
+    template<class T>
+    void _Permute(T* array, const MPM_STATS* order, MPM_STATS number, T* buffer);
+private:
+    MPM_STATS _particle_number;
+    MPM_STATS _active_number;          //!< particles [0, _active_number) are not compacted out
+    MPM_STATS* _particle_id;           //!< index of the particle at initialization, for output
+
+    MPM_FLOAT* _position[3];
+    MPM_FLOAT* _velocity[3];
+
+    MPM_FLOAT* _mass;
+    MPM_FLOAT* _volume;
+    MPM_FLOAT* _density;
+    MPM_FLOAT* _mean_stress;
+    MPM_FLOAT* _deviatoric_stress[6];   //!< SDxx, SDyy, SDzz, SDyz, SDxz, SDxy in sequence
+    MPM_FLOAT* _equivalent_stress;
+    MPM_FLOAT* _bulk_q;
+    MPM_FLOAT* _internal_energy;
+    MPM_FLOAT* _sound_speed;
+    bool* _failure;
+    bool* _eroded;
+    MPM_FLOAT* _cost;                  //!< estimated cost of the next stress update, 1 before the first update
+
+    //!> Extra Particle Properties, nullptr if not enabled
+    MPM_FLOAT* _extra_properties[MPM::ExtraParticlePropertySum];
+    //!> Positions of enabled extra properties in a PhysicalProperty view, -1 if not enabled
+    int _extra_property_positions[MPM::ExtraParticlePropertySum];
+    int _extra_property_number;
+
+public:
+//!> various Get function of arrays
+    inline MPM_STATS GetParticleNumber() {return _particle_number;}
+    inline MPM_STATS GetActiveNumber() {return _active_number;}
+    inline MPM_STATS* GetParticleID() {return _particle_id;}
+
+    inline MPM_FLOAT* GetPosition(int component) {return _position[component];}
+    inline MPM_FLOAT* GetVelocity(int component) {return _velocity[component];}
+
+    inline MPM_FLOAT* GetMass() {return _mass;}
+    inline MPM_FLOAT* GetVolume() {return _volume;}
+    inline MPM_FLOAT* GetDensity() {return _density;}
+    inline MPM_FLOAT* GetMeanStress() {return _mean_stress;}
+    inline MPM_FLOAT* GetDeviatoricStress(int component) {return _deviatoric_stress[component];}
+    inline MPM_FLOAT* GetEquivalentStress() {return _equivalent_stress;}
+    inline MPM_FLOAT* GetBulkViscosity() {return _bulk_q;}
+    inline MPM_FLOAT* GetInternalEnergy() {return _internal_energy;}
+    inline MPM_FLOAT* GetSoundSpeed() {return _sound_speed;}
+    inline bool* GetFailure() {return _failure;}
+    inline bool* GetEroded() {return _eroded;}
+    inline MPM_FLOAT* GetCost() {return _cost;}
+
+    inline MPM_FLOAT* GetExtraProperty(MPM::ExtraParticleProperty prop) {return _extra_properties[prop];}
+    inline int* GetExtraPropertyPositions() {return _extra_property_positions;}
+    inline int GetExtraPropertyNumber() {return _extra_property_number;}
+};
+
+#endif
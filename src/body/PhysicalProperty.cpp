@@ -19,6 +19,7 @@
 ==============================================================*/
 
 #include "./PhysicalProperty.h"
+#include "./ExtraPropertyArena.h"
 #include "../utility/MathFunctionList.h"
 
 PhysicalProperty::PhysicalProperty()
@@ -39,7 +40,16 @@ PhysicalProperty::PhysicalProperty()
     _extra_property_positions = nullptr;
 }
 
-PhysicalProperty::PhysicalProperty(const PhysicalProperty& pp)
+PhysicalProperty::~PhysicalProperty()
+{
+}
+
+bool PhysicalProperty::AllocateMemoryForExtraParticleProperty(ExtraPropertyArena& arena)
+{
+    return arena.Allocate(this, 1);
+}
+
+void PhysicalProperty::CopyFrom(PhysicalProperty& pp)
 {
     _mass = pp._mass;
     _volume = pp._volume;
@@ -53,54 +63,29 @@ PhysicalProperty::PhysicalProperty(const PhysicalProperty& pp)
     _failure = pp._failure;
     _eroded = pp._eroded;
 
-    _extra_properties = nullptr;
-    _extra_property_positions = pp._extra_property_positions;
-    if (_extra_property_positions)
+    for (int i = 0; i < MPM::ExtraParticlePropertySum; i++)
     {
-        int count = 0;
-        for (int i = 0; i < MPM::ExtraParticlePropertySum; i++)
-            if (_extra_property_positions[i] > 0)
-                count++;
-        
-        AllocateMemoryForExtraParticleProperty(count);
-        for (int i = 0; i < count; i++)
-            _extra_properties[i] = pp._extra_properties[i];
+        if (HasExtraParticleProperty(i) && pp.HasExtraParticleProperty(i))
+            (*this)[i] = pp[i];
     }
 }
 
-PhysicalProperty::~PhysicalProperty()
-{
-    if (_extra_properties)
-        delete[] _extra_properties;
-}
-
-void PhysicalProperty::AllocateMemoryForExtraParticleProperty(int number)
+void PhysicalProperty::BindExtraParticleProperty(MPM_FLOAT* extra_properties, int* positions)
 {
-    _extra_properties = new MPM_FLOAT[number];
-    for (int i = 0; i < number; i++)
-        _extra_properties[i] = 0.0;
+    _extra_properties = extra_properties;
+    _extra_property_positions = positions;
 }
 
-Array3D&& PhysicalProperty::CalculatePrincipleStress()
+Array3D PhysicalProperty::CalculatePrincipleStress()
 {
     MPM_FLOAT stress_x = _deviatoric_stress[0] + _mean_stress - _bulk_q;
     MPM_FLOAT stress_y = _deviatoric_stress[1] + _mean_stress - _bulk_q;
     MPM_FLOAT stress_z = _deviatoric_stress[2] + _mean_stress - _bulk_q;
 
-    MPM_FLOAT I_1 = stress_x + stress_y + stress_z;
-    MPM_FLOAT I_2 = -0.5*(I_1*I_1 - (stress_x*stress_x + stress_y*stress_y + stress_z*stress_z
-        + 2.0*(_deviatoric_stress[3]*_deviatoric_stress[3] + 
-               _deviatoric_stress[4]*_deviatoric_stress[4] + 
-               _deviatoric_stress[5]*_deviatoric_stress[5])));
-    MPM_FLOAT I_3 = stress_x*stress_y*stress_z + 
-        2.0*_deviatoric_stress[3]*_deviatoric_stress[4]*_deviatoric_stress[5]
-        - stress_x*_deviatoric_stress[3]*_deviatoric_stress[3] 
-        - stress_y*_deviatoric_stress[4]*_deviatoric_stress[4] 
-        - stress_z*_deviatoric_stress[5]*_deviatoric_stress[5];
-    
     Array3D result;
-    CubicFunctionRoots(1.0, -I_1, -I_2, -I_3, result);
-    return move(result);
+    SymmetricEigenvalues(stress_x, stress_y, stress_z, _deviatoric_stress[3], _deviatoric_stress[4],
+        _deviatoric_stress[5], result[0], result[1], result[2]);
+    return result;
 }
 
 void PhysicalProperty::DeviatoricStressMultiplyScalar(MPM_FLOAT scalar)
@@ -22,15 +22,29 @@
 #define _PhysicalProperty_H_
 #include "../main/MPM3D_MACRO.h"
 
+class ExtraPropertyArena;
+
 class PhysicalProperty
 {
+    friend class ParticleStore;
 public:
     PhysicalProperty();
-    PhysicalProperty(const PhysicalProperty& pp);
     ~PhysicalProperty();
 
-    //!> Allocate Memory For Extra Particle Property
-    void AllocateMemoryForExtraParticleProperty(int number);
+    //!> A copy would alias the extra particle properties of the source, use "CopyFrom" instead
+    PhysicalProperty(const PhysicalProperty&) = delete;
+    PhysicalProperty& operator=(const PhysicalProperty&) = delete;
+
+    //!> Copy the state of "pp" into this particle, the extra particle properties are copied by value
+    //!> into the memory bound to this particle, properties not enabled on both sides are skipped
+    void CopyFrom(PhysicalProperty& pp);
+
+    //!> Allocate Memory For Extra Particle Property from the arena of the body
+    bool AllocateMemoryForExtraParticleProperty(ExtraPropertyArena& arena);
+
+    //!> Use external memory for extra particle properties, which is not released by this object
+    //!> positions[MPM::ExtraParticleProperty] is the index in "extra_properties", -1 if not enabled
+    void BindExtraParticleProperty(MPM_FLOAT* extra_properties, int* positions);
 
     //!> override operator [] to get extra particle property
     inline MPM_FLOAT& operator[] (int index)
@@ -38,6 +52,12 @@ public:
         return _extra_properties[_extra_property_positions[index]];
     }
 
+    //!> Whether the extra particle property is enabled
+    inline bool HasExtraParticleProperty(int index)
+    {
+        return _extra_property_positions && _extra_property_positions[index] >= 0;
+    }
+
     //!> Update the volume and density based on the incremental volumetric strain
     inline void UpdateVolume(MPM_FLOAT (&de)[6])
     {
@@ -53,8 +73,8 @@ public:
 
     inline void UpdateDensity() {_density = _mass/_volume;}
 
-    //!> Calculate the principle stress
-    Array3D&& CalculatePrincipleStress();
+    //!> Calculate the principle stress in descending order
+    Array3D CalculatePrincipleStress();
 
     //!> Multiply the deviatoric stress with a scalar
     void DeviatoricStressMultiplyScalar(MPM_FLOAT scalar);
@@ -77,7 +97,7 @@ private:
     bool _failure;
     bool _eroded;
 
-    //!> Extra Particle Properties
+    //!> Extra Particle Properties, owned by the arena or the caller of "BindExtraParticleProperty"
     MPM_FLOAT* _extra_properties;
     int* _extra_property_positions;
 
@@ -0,0 +1,50 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Entry of the single material point driver
+    Usage: MPM3D_Driver <input.xml> [thread number]
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "MaterialDriver.h"
+#include "../utility/Profiler.h"
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " <input.xml> [thread number]" << endl;
+        return 1;
+    }
+
+    MaterialDriver driver;
+    if (!driver.Initialize(argv[1]))
+        return 1;
+
+    int thread_number = argc > 2 ? atoi(argv[2]) : driver.GetThreadNumber();
+    cout << "Parameter sets: " << driver.GetSetNumber() << ", steps: " << driver.GetStepNumber() << endl;
+
+    uint64_t start = Profiler::Now();
+    bool succeeded = driver.Run(thread_number);
+    double seconds = (Profiler::Now() - start)*1e-9;
+    cout << "Finished in " << seconds << " s, "
+         << driver.GetSetNumber()*driver.GetStepNumber()/max(seconds, 1e-9) << " point updates/s" << endl;
+
+    if (!driver.Write(driver.GetOutputFile()))
+        return 1;
+    cout << "Curves are written to " << driver.GetOutputFile() << endl;
+    return succeeded ? 0 : 1;
+}
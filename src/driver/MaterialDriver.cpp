@@ -0,0 +1,601 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of class "MaterialDriver"
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "MaterialDriver.h"
+#include "../body/ExtraPropertyArena.h"
+#include "../solver/SimulationContext.h"
+#include "../utility/ThreadPool.h"
+#include <thread>
+#include <sstream>
+#include <limits>
+
+using namespace tinyxml2;
+
+//!> Split a line of CSV or a list separated by spaces
+static vector<string> DriverSplit(const string& line)
+{
+    vector<string> items;
+    string item;
+    for (char c : line)
+    {
+        if (c == ',' || c == ' ' || c == '\t' || c == '\r' || c == ';')
+        {
+            if (!item.empty())
+                items.push_back(item);
+            item.clear();
+        }
+        else
+            item += c;
+    }
+    if (!item.empty())
+        items.push_back(item);
+    return items;
+}
+
+static bool DriverToNumber(const string& item, MPM_FLOAT& value)
+{
+    char* end = nullptr;
+    value = strtod(item.c_str(), &end);
+    return end && *end == '\0' && end != item.c_str();
+}
+
+//!> Read all attributes of an element into a parameter map
+static bool DriverReadAttributes(XMLElement* element, map<string, MPM_FLOAT>& para)
+{
+    if (!element)
+        return true;
+    for (const XMLAttribute* attribute = element->FirstAttribute(); attribute; attribute = attribute->Next())
+    {
+        MPM_FLOAT value;
+        if (!DriverToNumber(attribute->Value(), value))
+        {
+            string error_msg = "*** Input Error *** Parameter " + string(attribute->Name()) + " of " +
+                element->Name() + " is not a number!";
+            MPM3D_ErrorMessage(__FILE__, __LINE__, error_msg);
+            return false;
+        }
+        para[attribute->Name()] = value;
+    }
+    return true;
+}
+
+//!> Parameter map of "Group.Name", nullptr for a wrong name
+static map<string, MPM_FLOAT>* DriverParameterMap(const string& name, string& parameter,
+    map<string, MPM_FLOAT>& strength_para, map<string, MPM_FLOAT>& eos_para,
+    vector< map<string, MPM_FLOAT> >& failure_para_list, map<string, MPM_FLOAT>& extra_para)
+{
+    size_t dot = name.find('.');
+    if (dot == string::npos || dot + 1 == name.size())
+        return nullptr;
+
+    string group = name.substr(0, dot);
+    parameter = name.substr(dot + 1);
+    if (group == "Strength")
+        return &strength_para;
+    if (group == "EOS")
+        return &eos_para;
+    if (group == "Extra")
+        return &extra_para;
+    if (group.compare(0, 7, "Failure") == 0)
+    {
+        size_t n = group.size() > 7 ? atoi(group.c_str() + 7) : 0;
+        if (n < failure_para_list.size())
+            return &failure_para_list[n];
+    }
+    return nullptr;
+}
+
+MaterialDriver::MaterialDriver()
+{
+    _path.time_step = 0.0;
+    _thread_number = 0;
+    _output_interval = 1;
+    _output_file = "curves.csv";
+}
+
+MaterialDriver::~MaterialDriver()
+{
+}
+
+bool MaterialDriver::Initialize(const string& filename)
+{
+    XMLDocument document;
+    if (document.LoadFile(filename.c_str()) != XML_SUCCESS)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** Failed to read the driver input " + filename);
+        return false;
+    }
+
+    XMLElement* root = document.FirstChildElement("MaterialDriver");
+    if (!root)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** There is no MaterialDriver element in " + filename);
+        return false;
+    }
+
+    _thread_number = root->IntAttribute("Threads", 0);
+    _output_interval = max(1, root->IntAttribute("OutputInterval", 1));
+    if (root->Attribute("Output"))
+        _output_file = root->Attribute("Output");
+
+    if (!_ReadMaterial(root->FirstChildElement("Material")))
+        return false;
+    if (!_ReadPath(root->FirstChildElement("Path")))
+        return false;
+    if (!_ReadParameterSets(root))
+        return false;
+
+    //!> Check all parameter names once, so that the threads do not fail on input errors
+    //!> Values not given in a set are taken from the base material, NaN for the default of the model
+    for (size_t k = 0; k < _parameter_names.size(); k++)
+    {
+        string parameter;
+        map<string, MPM_FLOAT>* para = DriverParameterMap(_parameter_names[k], parameter, _strength_para,
+            _eos_para, _failure_para_list, _extra_para);
+        if (!para)
+        {
+            string error_msg = "*** Input Error *** Wrong parameter name " + _parameter_names[k] +
+                ", which should be Strength.<name>, EOS.<name>, Failure<n>.<name> or Extra.<name>!";
+            MPM3D_ErrorMessage(__FILE__, __LINE__, error_msg);
+            return false;
+        }
+
+        auto base = para->find(parameter);
+        if (base != para->end())
+            for (auto& parameter_set : _parameter_sets)
+                if (std::isnan(parameter_set[k]))
+                    parameter_set[k] = base->second;
+    }
+    return true;
+}
+
+bool MaterialDriver::_ReadMaterial(XMLElement* element)
+{
+    if (!element || !element->Attribute("Strength"))
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** The Material element with Strength is required!");
+        return false;
+    }
+
+    _strength_name = element->Attribute("Strength");
+    _eos_name = element->Attribute("EOS") ? element->Attribute("EOS") : "";
+    if (element->Attribute("Failure"))
+        _failure_name_list = DriverSplit(element->Attribute("Failure"));
+
+    if (!DriverReadAttributes(element->FirstChildElement("Strength"), _strength_para))
+        return false;
+    if (!DriverReadAttributes(element->FirstChildElement("EOS"), _eos_para))
+        return false;
+    if (!DriverReadAttributes(element->FirstChildElement("Extra"), _extra_para))
+        return false;
+
+    //!> Failure elements in the order of the "Failure" list
+    _failure_para_list.resize(_failure_name_list.size());
+    XMLElement* failure = element->FirstChildElement("Failure");
+    for (size_t n = 0; n < _failure_name_list.size() && failure; n++)
+    {
+        if (!DriverReadAttributes(failure, _failure_para_list[n]))
+            return false;
+        failure = failure->NextSiblingElement("Failure");
+    }
+    return true;
+}
+
+bool MaterialDriver::_ReadPath(XMLElement* element)
+{
+    if (!element || !element->Attribute("Type"))
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** The Path element with Type is required!");
+        return false;
+    }
+
+    string type = element->Attribute("Type");
+    MPM_FLOAT time_step = element->DoubleAttribute("TimeStep", 0.0);
+    if (time_step <= 0.0)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** TimeStep of the path should be greater than zero!");
+        return false;
+    }
+    _path.time_step = time_step;
+
+    if (type == "CSV")
+    {
+        if (!element->Attribute("File"))
+        {
+            MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** File of the CSV path is required!");
+            return false;
+        }
+        return _ReadPathCSV(element->Attribute("File"), time_step);
+    }
+
+    //!> Monotonic loading at constant strain rate, compression for negative "Strain"
+    MPM_FLOAT strain = element->DoubleAttribute("Strain", 0.0);
+    MPM_FLOAT strain_rate = element->DoubleAttribute("StrainRate", 0.0);
+    MPM_FLOAT lateral = element->DoubleAttribute("Lateral", 0.0);
+    if (fabs(strain) <= MPM_EPSILON || strain_rate <= MPM_EPSILON)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** Strain and StrainRate of the path are required!");
+        return false;
+    }
+
+    MPM_STATS step_number = max((MPM_STATS)1, (MPM_STATS)floor(fabs(strain)/(strain_rate*time_step) + 0.5));
+    MPM_FLOAT increment = strain/step_number;
+    SymTensor de, dv;
+    de.fill(0.0);
+    dv.fill(0.0);
+    if (type == "Uniaxial")
+        de[0] = increment;
+    else if (type == "Triaxial")
+    {
+        de[0] = increment;
+        de[1] = lateral*increment;
+        de[2] = lateral*increment;
+    }
+    else if (type == "Shear")
+    {
+        //!> Simple shear v_x = rate*y, engineering strain Exy, and the spin -W_xy in the
+        //!>    convention of "PhysicalProperty::StressRotationJaumann"
+        de[5] = increment;
+        dv[2] = -0.5*increment;
+    }
+    else
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** There is no path type named " + type + "!");
+        return false;
+    }
+
+    _path.delta_strain.assign(step_number, de);
+    _path.delta_vortex.assign(step_number, dv);
+    return true;
+}
+
+bool MaterialDriver::_ReadPathCSV(const string& filename, MPM_FLOAT time_step)
+{
+    ifstream is(filename);
+    if (!is)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** Failed to open the path file " + filename);
+        return false;
+    }
+
+    //!> Accumulated values at the sampled times, rows not starting with a number are skipped
+    vector<MPM_FLOAT> time;
+    vector< array<MPM_FLOAT, 9> > history;
+    string line;
+    while (getline(is, line))
+    {
+        vector<string> items = DriverSplit(line);
+        MPM_FLOAT value;
+        if (items.size() < 7 || !DriverToNumber(items[0], value))
+            continue;
+
+        array<MPM_FLOAT, 9> row;
+        row.fill(0.0);
+        for (size_t k = 1; k < items.size() && k <= 9; k++)
+            if (!DriverToNumber(items[k], row[k - 1]))
+            {
+                MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** Wrong row in " + filename + ": " + line);
+                return false;
+            }
+
+        if (!time.empty() && value <= time.back())
+        {
+            MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** Time should increase in " + filename);
+            return false;
+        }
+        time.push_back(value);
+        history.push_back(row);
+    }
+
+    if (time.size() < 2)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** At least 2 rows are required in " + filename);
+        return false;
+    }
+
+    //!> Linear interpolation at the constant time step
+    MPM_STATS step_number = (MPM_STATS)floor((time.back() - time.front())/time_step + 0.5);
+    _path.delta_strain.resize(step_number);
+    _path.delta_vortex.resize(step_number);
+    array<MPM_FLOAT, 9> previous = history[0];
+    size_t row = 0;
+    for (MPM_STATS step = 1; step <= step_number; step++)
+    {
+        MPM_FLOAT t = min(time.front() + step*time_step, time.back());
+        while (row + 2 < time.size() && time[row + 1] < t)
+            row++;
+        MPM_FLOAT ratio = (t - time[row])/(time[row + 1] - time[row]);
+
+        array<MPM_FLOAT, 9> current;
+        for (int k = 0; k < 9; k++)
+            current[k] = history[row][k] + ratio*(history[row + 1][k] - history[row][k]);
+
+        for (int k = 0; k < 6; k++)
+            _path.delta_strain[step - 1][k] = current[k] - previous[k];
+        _path.delta_vortex[step - 1].fill(0.0);
+        for (int k = 0; k < 3; k++)
+            _path.delta_vortex[step - 1][k] = current[k + 6] - previous[k + 6];
+        previous = current;
+    }
+    return true;
+}
+
+bool MaterialDriver::_ReadParameterSets(XMLElement* root)
+{
+    //!> Cartesian product of the sweeps
+    vector< vector<MPM_FLOAT> > sweep_values;
+    for (XMLElement* sweep = root->FirstChildElement("Sweep"); sweep; sweep = sweep->NextSiblingElement("Sweep"))
+    {
+        if (!sweep->Attribute("Parameter") || !sweep->Attribute("Values"))
+        {
+            MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** Parameter and Values of Sweep are required!");
+            return false;
+        }
+
+        vector<MPM_FLOAT> values;
+        for (auto& item : DriverSplit(sweep->Attribute("Values")))
+        {
+            MPM_FLOAT value;
+            if (!DriverToNumber(item, value))
+            {
+                MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** Wrong value of Sweep: " + item);
+                return false;
+            }
+            values.push_back(value);
+        }
+        if (values.empty())
+            continue;
+        _parameter_names.push_back(sweep->Attribute("Parameter"));
+        sweep_values.push_back(values);
+    }
+
+    if (!sweep_values.empty())
+    {
+        vector<size_t> counter(sweep_values.size(), 0);
+        while (true)
+        {
+            vector<MPM_FLOAT> parameter_set(sweep_values.size());
+            for (size_t k = 0; k < sweep_values.size(); k++)
+                parameter_set[k] = sweep_values[k][counter[k]];
+            _parameter_sets.push_back(parameter_set);
+
+            size_t k = 0;
+            while (k < counter.size() && ++counter[k] == sweep_values[k].size())
+                counter[k++] = 0;
+            if (k == counter.size())
+                break;
+        }
+    }
+
+    for (XMLElement* sets = root->FirstChildElement("ParameterSets"); sets;
+        sets = sets->NextSiblingElement("ParameterSets"))
+    {
+        if (!sets->Attribute("File") || !_ReadParameterSetsCSV(sets->Attribute("File")))
+        {
+            MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** Failed to read ParameterSets!");
+            return false;
+        }
+    }
+
+    //!> The base material only
+    if (_parameter_sets.empty())
+        _parameter_sets.push_back(vector<MPM_FLOAT>(_parameter_names.size()));
+    return true;
+}
+
+bool MaterialDriver::_ReadParameterSetsCSV(const string& filename)
+{
+    ifstream is(filename);
+    if (!is)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** Failed to open the parameter file " + filename);
+        return false;
+    }
+
+    string line;
+    vector<string> header;
+    while (header.empty() && getline(is, line))
+        header = DriverSplit(line);
+
+    //!> Columns of new names are added to all sets, NaN for the value of the base material
+    vector<size_t> columns;
+    for (auto& name : header)
+    {
+        size_t column = find(_parameter_names.begin(), _parameter_names.end(), name) - _parameter_names.begin();
+        if (column == _parameter_names.size())
+        {
+            _parameter_names.push_back(name);
+            for (auto& parameter_set : _parameter_sets)
+                parameter_set.push_back(numeric_limits<MPM_FLOAT>::quiet_NaN());
+        }
+        columns.push_back(column);
+    }
+
+    while (getline(is, line))
+    {
+        vector<string> items = DriverSplit(line);
+        if (items.empty())
+            continue;
+        if (items.size() != header.size())
+        {
+            MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** Wrong row in " + filename + ": " + line);
+            return false;
+        }
+
+        vector<MPM_FLOAT> parameter_set(_parameter_names.size(), numeric_limits<MPM_FLOAT>::quiet_NaN());
+        for (size_t k = 0; k < items.size(); k++)
+            if (!DriverToNumber(items[k], parameter_set[columns[k]]))
+            {
+                MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Input Error *** Wrong row in " + filename + ": " + line);
+                return false;
+            }
+        _parameter_sets.push_back(parameter_set);
+    }
+    return true;
+}
+
+void MaterialDriver::_SetParameter(const string& name, MPM_FLOAT value, map<string, MPM_FLOAT>& strength_para,
+    map<string, MPM_FLOAT>& eos_para, vector< map<string, MPM_FLOAT> >& failure_para_list,
+    map<string, MPM_FLOAT>& extra_para)
+{
+    string parameter;
+    map<string, MPM_FLOAT>* para = DriverParameterMap(name, parameter, strength_para, eos_para,
+        failure_para_list, extra_para);
+    if (para)
+        (*para)[parameter] = value;
+}
+
+bool MaterialDriver::Run(int thread_number)
+{
+    if (thread_number <= 0)
+        thread_number = max(1, (int)thread::hardware_concurrency());
+    thread_number = (int)min((size_t)thread_number, _parameter_sets.size());
+
+    _curves.assign(_parameter_sets.size(), "");
+    _succeeded.assign(_parameter_sets.size(), 0);
+
+    //!> Sets are taken one by one, their cost depends on the models and parameters
+    ThreadPool pool;
+    if (!pool.Initialize(thread_number))
+        return false;
+    pool.ParallelFor(0, (MPM_STATS)_parameter_sets.size(), ThreadPool::Dynamic, 1, 
+        [this](MPM_STATS begin, MPM_STATS end, int)
+    {
+        for (MPM_STATS index = begin; index < end; index++)
+            _succeeded[index] = _RunSet(index);
+    });
+
+    bool succeeded = true;
+    for (size_t index = 0; index < _parameter_sets.size(); index++)
+        if (!_succeeded[index])
+        {
+            cout << "*** Warning *** Parameter set " << index << " failed to initialize the material!" << endl;
+            succeeded = false;
+        }
+    return succeeded;
+}
+
+bool MaterialDriver::_RunSet(size_t index)
+{
+    map<string, MPM_FLOAT> strength_para = _strength_para, eos_para = _eos_para, extra_para = _extra_para;
+    vector< map<string, MPM_FLOAT> > failure_para_list = _failure_para_list;
+    vector<MPM_FLOAT>& parameter_set = _parameter_sets[index];
+    for (size_t k = 0; k < _parameter_names.size(); k++)
+        if (!std::isnan(parameter_set[k]))
+            _SetParameter(_parameter_names[k], parameter_set[k], strength_para, eos_para, failure_para_list, extra_para);
+
+    string strength_name = _strength_name, eos_name = _eos_name;
+    vector<string> failure_name_list = _failure_name_list;
+    MaterialFactory material;
+    if (!material.Initialize(strength_name, strength_para, eos_name, eos_para,
+        failure_name_list, failure_para_list, extra_para))
+        return false;
+
+    vector<MPM::ExtraParticleProperty> extra_list;
+    DataTransfer transfer;
+    if (!material.AddExtraParticleProperty(extra_list, transfer))
+        return false;
+
+    //!> One material point of unit volume at the reference density
+    ExtraPropertyArena arena;
+    if (!arena.Initialize(1, extra_list))
+        return false;
+    PhysicalProperty pp;
+    if (!pp.AllocateMemoryForExtraParticleProperty(arena))
+        return false;
+    pp.SetMass(material.GetReferenceDensity());
+    pp.SetVolume(1.0);
+    pp.UpdateDensity();
+    if (pp.HasExtraParticleProperty(MPM::kelvin))
+        pp[MPM::kelvin] = transfer.roomt;
+    if (pp.HasExtraParticleProperty(MPM::sigma_y))
+        pp[MPM::sigma_y] = transfer.sigma_y;
+
+    //!> Each set runs in its own context, the time advances by the constant step of the path
+    SimulationContext context;
+    context.SetTimeStep(_path.time_step);
+
+    string parameters;
+    for (auto value : parameter_set)
+    {
+        ostringstream item;
+        item << "," << value;
+        parameters += item.str();
+    }
+
+    ostringstream os;
+    os.precision(10);
+    SymTensor strain;
+    strain.fill(0.0);
+    MPM_STATS step_number = _path.delta_strain.size();
+    for (MPM_STATS step = 0; step <= step_number; step++)
+    {
+        if (step > 0)
+        {
+            SymTensor& de = _path.delta_strain[step - 1];
+            MPM_FLOAT volume_old = pp.GetVolume();
+            pp.SetVolume(volume_old*(1.0 + de[0] + de[1] + de[2]));
+            pp.UpdateDensity();
+            material.UpdateStress(&pp, de, _path.delta_vortex[step - 1], volume_old, context);
+            context.AdvanceTime();
+
+            for (int k = 0; k < 6; k++)
+                strain[k] += de[k];
+        }
+
+        if (step%_output_interval != 0 && step != step_number)
+            continue;
+
+        //!> Total stress with the artificial bulk viscosity as "CalculatePrincipleStress"
+        SymTensor sd = pp.GetDeviatoricStress();
+        MPM_FLOAT mean_stress = pp.GetMeanStress() - pp.GetBulkViscosity();
+        os << index << parameters << "," << step << "," << step*_path.time_step;
+        for (int k = 0; k < 6; k++)
+            os << "," << strain[k];
+        for (int k = 0; k < 6; k++)
+            os << "," << (k < 3 ? sd[k] + mean_stress : sd[k]);
+        os << "," << pp.GetMeanStress() << "," << pp.GetEquivalentStress()
+           << "," << (pp.HasExtraParticleProperty(MPM::epeff) ? pp[MPM::epeff] : 0.0)
+           << "," << (pp.HasExtraParticleProperty(MPM::DMG) ? pp[MPM::DMG] : 0.0)
+           << "," << (pp.HasExtraParticleProperty(MPM::kelvin) ? pp[MPM::kelvin] : 0.0)
+           << "," << pp.is_Failed() << "\n";
+    }
+    _curves[index] = os.str();
+    return true;
+}
+
+bool MaterialDriver::Write(const string& filename)
+{
+    ofstream os(filename);
+    if (!os)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Failed to open the output file " + filename);
+        return false;
+    }
+
+    os << "Set";
+    for (auto& name : _parameter_names)
+        os << "," << name;
+    os << ",Step,Time,Exx,Eyy,Ezz,Eyz,Exz,Exy,Sxx,Syy,Szz,Syz,Sxz,Sxy,MeanStress,EquivalentStress,"
+       << "EffectivePlasticStrain,Damage,Temperature,Failed\n";
+    for (auto& curve : _curves)
+        os << curve;
+    return true;
+}
@@ -0,0 +1,122 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Single material point driver for model calibration.
+        A prescribed strain/vorticity history (uniaxial,
+        triaxial, simple shear, or read from CSV) is replayed
+        through MaterialFactory::UpdateStress for a list of
+        parameter sets. The sets are independent and run in
+        parallel threads, each writes a stress-strain curve.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _MATERIALDRIVER_H_
+#define _MATERIALDRIVER_H_
+
+#include "../material/MaterialFactory.h"
+#include "../utility/tinyxml2.h"
+
+//!> Strain path sampled at a constant time step
+struct DriverPath
+{
+    MPM_FLOAT time_step;
+    vector<SymTensor> delta_strain;     //!< Exx, Eyy, Ezz, Eyz, Exz, Exy increments, shear in engineering strain
+    vector<SymTensor> delta_vortex;     //!< increments passed to "StressRotationJaumann", first 3 components used
+};
+
+class MaterialDriver
+{
+public:
+    MaterialDriver();
+    ~MaterialDriver();
+
+    //!> Read the driver input file, see "Example" at the end of this file
+    bool Initialize(const string& filename);
+
+    //!> Run all parameter sets with "thread_number" threads, 0 for the hardware concurrency
+    bool Run(int thread_number);
+
+    //!> Write the curves of all sets in one CSV file
+    bool Write(const string& filename);
+
+    inline int GetThreadNumber() {return _thread_number;}
+    inline string GetOutputFile() {return _output_file;}
+    inline size_t GetSetNumber() {return _parameter_sets.size();}
+    inline size_t GetStepNumber() {return _path.delta_strain.size();}
+private:
+    //!> Base material of all parameter sets
+    bool _ReadMaterial(tinyxml2::XMLElement* element);
+
+    //!> Uniaxial, Triaxial and Shear paths are generated, CSV paths are resampled at the time step
+    bool _ReadPath(tinyxml2::XMLElement* element);
+    bool _ReadPathCSV(const string& filename, MPM_FLOAT time_step);
+
+    //!> Parameter sets from "Sweep" elements (cartesian product) and "ParameterSets" CSV files
+    bool _ReadParameterSets(tinyxml2::XMLElement* root);
+    bool _ReadParameterSetsCSV(const string& filename);
+
+    //!> Replay the path for set "index" and fill "_curves[index]"
+    bool _RunSet(size_t index);
+
+    //!> Set parameter "Group.Name" in the parameter maps of one material, names are checked in "Initialize"
+    void _SetParameter(const string& name, MPM_FLOAT value, map<string, MPM_FLOAT>& strength_para,
+        map<string, MPM_FLOAT>& eos_para, vector< map<string, MPM_FLOAT> >& failure_para_list,
+        map<string, MPM_FLOAT>& extra_para);
+private:
+    string _strength_name;
+    string _eos_name;
+    vector<string> _failure_name_list;
+    map<string, MPM_FLOAT> _strength_para;
+    map<string, MPM_FLOAT> _eos_para;
+    vector< map<string, MPM_FLOAT> > _failure_para_list;
+    map<string, MPM_FLOAT> _extra_para;
+
+    DriverPath _path;
+
+    vector<string> _parameter_names;            //!< "Strength.B", "EOS.C0", "Failure.D1", "Failure1.D1", "Extra.bq1"
+    vector< vector<MPM_FLOAT> > _parameter_sets;
+    vector<string> _curves;                     //!< CSV rows of each set
+    vector<char> _succeeded;
+
+    int _thread_number;
+    int _output_interval;
+    string _output_file;
+};
+
+/* Example of the input file, all lengths and times in SI units
+
+<MaterialDriver Threads="0" Output="curves.csv" OutputInterval="10">
+    <Material Strength="JohnsonCook" EOS="Gruneisen" Failure="JohnsonCookDamage">
+        <Strength Young="2e11" Poisson="0.3" Yield0="7.92e8" B="5.1e8" n="0.26" C="0.014"
+                  m="1.03" melt="1793" SpecHeat="477" roomt="294"/>
+        <EOS C0="4570" S1="1.49" gamma0="1.93"/>
+        <Failure D1="0.05" D2="3.44" D3="-2.12" D4="0.002" D5="0.61"/>
+        <Extra ReferenceDensity="7830"/>
+    </Material>
+
+    Type: Uniaxial (Exx), Triaxial (Exx and Eyy = Ezz = Lateral*Exx), Shear (Exy and spin), CSV
+    <Path Type="Uniaxial" Strain="0.2" StrainRate="1000" TimeStep="1e-7"/>
+    <Path Type="CSV" File="path.csv" TimeStep="1e-7"/>
+        rows of "time, Exx, Eyy, Ezz, Eyz, Exz, Exy[, Vyz, Vxz, Vxy]", accumulated values
+
+    <Sweep Parameter="Strength.B" Values="4e8 5e8 6e8"/>
+    <Sweep Parameter="Strength.n" Values="0.2 0.26 0.3"/>
+    <ParameterSets File="sets.csv"/>
+        header of parameter names, e.g. "Strength.B, Strength.n", and one set in each row
+</MaterialDriver>
+*/
+
+#endif
@@ -0,0 +1,272 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of class 'ParticleToGrid'
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "ParticleToGrid.h"
+#include "../utility/Profiler.h"
+
+//!> Add to a node value shared by several threads
+//!> atomic<MPM_FLOAT> has the layout of MPM_FLOAT and is lock-free on the supported platforms
+static inline void AtomicAdd(MPM_FLOAT* address, MPM_FLOAT value)
+{
+    atomic<MPM_FLOAT>* target = reinterpret_cast<atomic<MPM_FLOAT>*>(address);
+    MPM_FLOAT expected = target->load(memory_order_relaxed);
+    while (!target->compare_exchange_weak(expected, expected + value, memory_order_relaxed))
+        ;
+}
+
+ParticleToGrid::ParticleToGrid()
+{
+    _mode = Serial;
+    _pool = nullptr;
+    _profile_transfer = Profiler::Register("P2G/" + ModeName(_mode));
+    _profile_bin = Profiler::Register("P2G/Bin");
+}
+
+ParticleToGrid::~ParticleToGrid()
+{
+}
+
+bool ParticleToGrid::Initialize(TransferMode mode, ThreadPool* pool)
+{
+    _mode = mode;
+    _pool = _mode == Serial ? nullptr : pool;
+    if (!_pool)
+        _mode = Serial;
+    _profile_transfer = Profiler::Register("P2G/" + ModeName(_mode));
+    return true;
+}
+
+bool ParticleToGrid::ParseMode(const string& name, TransferMode& mode)
+{
+    for (TransferMode m : {Serial, Atomic, Colored})
+    {
+        if (name == ModeName(m))
+        {
+            mode = m;
+            return true;
+        }
+    }
+    return false;
+}
+
+string ParticleToGrid::ModeName(TransferMode mode)
+{
+    switch (mode)
+    {
+    case Serial:
+        return "Serial";
+    case Atomic:
+        return "Atomic";
+    case Colored:
+        return "Colored";
+    }
+    return "";
+}
+
+bool ParticleToGrid::Transfer(ParticleStore& store, SparseGrid& grid, ShapeFunction& shape, 
+    const Array3D& gravity, int quantity)
+{
+    MPM_STATS number = store.GetActiveNumber();
+    if (shape.GetParticleNumber() != number)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, 
+            "*** Error *** The shape function cache is not updated for the particles.");
+        return false;
+    }
+
+    ProfileScope profile(_profile_transfer, number);
+    switch (shape.GetWidth())
+    {
+    case 2:
+        _Transfer<2>(store, grid, shape, gravity, quantity);
+        return true;
+    case 3:
+        _Transfer<3>(store, grid, shape, gravity, quantity);
+        return true;
+    case 4:
+        _Transfer<4>(store, grid, shape, gravity, quantity);
+        return true;
+    }
+    return false;
+}
+
+template<int W>
+void ParticleToGrid::_Transfer(ParticleStore& store, SparseGrid& grid, ShapeFunction& shape, 
+    const Array3D& gravity, int quantity)
+{
+    switch (_mode)
+    {
+    case Serial:
+        _TransferSerial<W>(store, grid, shape, gravity, quantity);
+        break;
+    case Atomic:
+        _TransferAtomic<W>(store, grid, shape, gravity, quantity);
+        break;
+    case Colored:
+        _TransferColored<W>(store, grid, shape, gravity, quantity);
+        break;
+    }
+}
+
+template<int W, class Add>
+inline void ParticleToGrid::_Scatter(ParticleStore& store, SparseGrid& grid, ShapeFunction& shape, MPM_STATS p, 
+    const Array3D& gravity, int quantity, Add add)
+{
+    const MPM_FLOAT* row = shape.GetWeight(p);
+    const MPM_FLOAT* wx = row;
+    const MPM_FLOAT* wy = row + W;
+    const MPM_FLOAT* wz = row + 2*W;
+    const MPM_FLOAT* gx = row + 3*W;
+    const MPM_FLOAT* gy = row + 4*W;
+    const MPM_FLOAT* gz = row + 5*W;
+    const MPM_STATS* nodes = shape.GetNode(p);
+
+    MPM_FLOAT mass = store.GetMass()[p];
+    MPM_FLOAT volume = store.GetVolume()[p];
+    MPM_FLOAT pressure_part = store.GetMeanStress()[p] - store.GetBulkViscosity()[p];
+    MPM_FLOAT sxx = store.GetDeviatoricStress(0)[p] + pressure_part;
+    MPM_FLOAT syy = store.GetDeviatoricStress(1)[p] + pressure_part;
+    MPM_FLOAT szz = store.GetDeviatoricStress(2)[p] + pressure_part;
+    MPM_FLOAT syz = store.GetDeviatoricStress(3)[p];
+    MPM_FLOAT sxz = store.GetDeviatoricStress(4)[p];
+    MPM_FLOAT sxy = store.GetDeviatoricStress(5)[p];
+    MPM_FLOAT momentum[3];
+    for (int k = 0; k < 3; k++)
+        momentum[k] = mass*store.GetVelocity(k)[p];
+
+    MPM_FLOAT* node_mass = grid.GetMass();
+    MPM_FLOAT* node_momentum[3] = {grid.GetMomentum(0), grid.GetMomentum(1), grid.GetMomentum(2)};
+    MPM_FLOAT* node_force[3] = {grid.GetForce(0), grid.GetForce(1), grid.GetForce(2)};
+
+    for (int oz = 0; oz < W; oz++)
+        for (int oy = 0; oy < W; oy++)
+        {
+            MPM_FLOAT weight_yz = wy[oy]*wz[oz];
+            MPM_FLOAT gradient_y = gy[oy]*wz[oz];
+            MPM_FLOAT gradient_z = wy[oy]*gz[oz];
+            const MPM_STATS* line = nodes + W*(oy + W*oz);
+            for (int ox = 0; ox < W; ox++)
+            {
+                MPM_STATS node = line[ox];
+                MPM_FLOAT weight = wx[ox]*weight_yz;
+                if (quantity & Mass)
+                    add(node_mass + node, mass*weight);
+                if (quantity & Momentum)
+                {
+                    for (int k = 0; k < 3; k++)
+                        add(node_momentum[k] + node, momentum[k]*weight);
+                }
+                if (quantity & Force)
+                {
+                    MPM_FLOAT dx = gx[ox]*weight_yz;
+                    MPM_FLOAT dy = wx[ox]*gradient_y;
+                    MPM_FLOAT dz = wx[ox]*gradient_z;
+                    add(node_force[0] + node, -volume*(sxx*dx + sxy*dy + sxz*dz) + mass*gravity[0]*weight);
+                    add(node_force[1] + node, -volume*(sxy*dx + syy*dy + syz*dz) + mass*gravity[1]*weight);
+                    add(node_force[2] + node, -volume*(sxz*dx + syz*dy + szz*dz) + mass*gravity[2]*weight);
+                }
+            }
+        }
+}
+
+template<int W>
+void ParticleToGrid::_TransferSerial(ParticleStore& store, SparseGrid& grid, ShapeFunction& shape, 
+    const Array3D& gravity, int quantity)
+{
+    auto add = [](MPM_FLOAT* address, MPM_FLOAT value) {*address += value;};
+    MPM_STATS number = store.GetActiveNumber();
+    for (MPM_STATS p = 0; p < number; p++)
+        _Scatter<W>(store, grid, shape, p, gravity, quantity, add);
+}
+
+template<int W>
+void ParticleToGrid::_TransferAtomic(ParticleStore& store, SparseGrid& grid, ShapeFunction& shape, 
+    const Array3D& gravity, int quantity)
+{
+    _pool->ParallelFor(0, store.GetActiveNumber(), [&](MPM_STATS begin, MPM_STATS end, int)
+    {
+        for (MPM_STATS p = begin; p < end; p++)
+            _Scatter<W>(store, grid, shape, p, gravity, quantity, AtomicAdd);
+    });
+}
+
+void ParticleToGrid::_Bin(SparseGrid& grid, ShapeFunction& shape, MPM_STATS number)
+{
+    ProfileScope profile(_profile_bin, number);
+    MPM_STATS block_number = grid.GetBlockNumber();
+    _bin_offset.assign(block_number + 1, 0);
+    _bin_particle.resize(number);
+
+    //!> Block of each particle is kept in "_bin_particle" before the particles are placed
+    vector<MPM_STATS>& particle_block = _bin_particle;
+    for (MPM_STATS p = 0; p < number; p++)
+    {
+        particle_block[p] = shape.GetNode(p)[0]/MPM::GridBlockNodes;
+        _bin_offset[particle_block[p] + 1]++;
+    }
+    for (MPM_STATS b = 0; b < block_number; b++)
+        _bin_offset[b + 1] += _bin_offset[b];
+
+    vector<MPM_STATS> position(_bin_offset.begin(), _bin_offset.end() - 1);
+    vector<MPM_STATS> sorted(number);
+    for (MPM_STATS p = 0; p < number; p++)
+        sorted[position[particle_block[p]]++] = p;
+    _bin_particle.swap(sorted);
+
+    for (int c = 0; c < 8; c++)
+        _color_block[c].clear();
+    int* block_coordinate[3] = {grid.GetBlockCoordinate(0), grid.GetBlockCoordinate(1), grid.GetBlockCoordinate(2)};
+    for (MPM_STATS b = 0; b < block_number; b++)
+    {
+        if (_bin_offset[b + 1] == _bin_offset[b])
+            continue;
+        int color = (block_coordinate[0][b] & 1) | (block_coordinate[1][b] & 1) << 1 | 
+            (block_coordinate[2][b] & 1) << 2;
+        _color_block[color].push_back(b);
+    }
+}
+
+template<int W>
+void ParticleToGrid::_TransferColored(ParticleStore& store, SparseGrid& grid, ShapeFunction& shape, 
+    const Array3D& gravity, int quantity)
+{
+    static_assert(W <= MPM::GridBlockEdge, "Stencils of the same color should not share nodes");
+    _Bin(grid, shape, store.GetActiveNumber());
+
+    //!> One loop per color, blocks are taken one by one since their particle numbers differ,
+    //!>    from a shared counter or by work stealing if that is the schedule of the pool
+    auto add = [](MPM_FLOAT* address, MPM_FLOAT value) {*address += value;};
+    ThreadPool::Schedule schedule = _pool->GetSchedule() == ThreadPool::Stealing ? 
+        ThreadPool::Stealing : ThreadPool::Dynamic;
+    for (int c = 0; c < 8; c++)
+    {
+        const vector<MPM_STATS>& blocks = _color_block[c];
+        _pool->ParallelFor(0, (MPM_STATS)blocks.size(), schedule, 1, 
+            [&](MPM_STATS begin, MPM_STATS end, int)
+        {
+            for (MPM_STATS i = begin; i < end; i++)
+            {
+                MPM_STATS b = blocks[i];
+                for (MPM_STATS k = _bin_offset[b]; k < _bin_offset[b + 1]; k++)
+                    _Scatter<W>(store, grid, shape, _bin_particle[k], gravity, quantity, add);
+            }
+        });
+    }
+}
@@ -0,0 +1,117 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Particle-to-grid transfer of mass, momentum and
+        force (internal force by the stress and gravity) with
+        the cached shape functions, multi-threaded by a
+        ThreadPool in one of three modes selected at runtime:
+        Serial  - one thread, reference results
+        Atomic  - particle ranges by the schedule of the pool,
+                  compare-and-swap adds on the node values
+        Colored - particles are binned by the grid block of
+                  their lowest stencil node. A stencil of 4
+                  nodes at most spans two blocks in each
+                  direction, so bins
+                  of blocks with the same parity of (bx, by, bz)
+                  never write the same node. The 8 colors run
+                  one after another, bins of one color are
+                  shared by the threads without atomics.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _PARTICLETOGRID_H_
+#define _PARTICLETOGRID_H_
+
+#include "../main/MPM3D_MACRO.h"
+#include "SparseGrid.h"
+#include "ShapeFunction.h"
+#include "../utility/ThreadPool.h"
+
+class ParticleToGrid
+{
+public:
+    enum TransferMode
+    {
+        Serial,
+        Atomic,
+        Colored
+    };
+
+    //!> Node values mapped by "Transfer", combined by bitwise or
+    enum TransferQuantity
+    {
+        Mass = 1,
+        Momentum = 2,
+        Force = 4,
+        All = Mass | Momentum | Force
+    };
+
+    ParticleToGrid();
+    ~ParticleToGrid();
+
+    //!> Atomic and Colored modes run on the threads of "pool", Serial mode and nullptr on the calling thread
+    bool Initialize(TransferMode mode, ThreadPool* pool);
+
+    //!> Mode of name "Serial", "Atomic" or "Colored", return false for other names
+    static bool ParseMode(const string& name, TransferMode& mode);
+    static string ModeName(TransferMode mode);
+
+    //!> Scatter mass, momentum and force of the active particles to the grid by the shape function cache,
+    //!>    which should be updated for the current positions. Node values are added to.
+    //!> "quantity" selects the node values, e.g. the momentum alone for the remapping of MUSL
+    bool Transfer(ParticleStore& store, SparseGrid& grid, ShapeFunction& shape, const Array3D& gravity, 
+        int quantity = All);
+private:
+    //!> Contributions of particle "p" to its W^3 nodes, "add(address, value)" adds to a node value
+    template<int W, class Add>
+    void _Scatter(ParticleStore& store, SparseGrid& grid, ShapeFunction& shape, MPM_STATS p, 
+        const Array3D& gravity, int quantity, Add add);
+
+    //!> Counting sort of the active particles by the block of their lowest stencil node, 
+    //!>    "_bin_offset" and "_bin_particle"
+    void _Bin(SparseGrid& grid, ShapeFunction& shape, MPM_STATS number);
+
+    //!> Transfer of stencil width W in the current mode
+    template<int W>
+    void _Transfer(ParticleStore& store, SparseGrid& grid, ShapeFunction& shape, const Array3D& gravity, 
+        int quantity);
+    template<int W>
+    void _TransferSerial(ParticleStore& store, SparseGrid& grid, ShapeFunction& shape, const Array3D& gravity, 
+        int quantity);
+    template<int W>
+    void _TransferAtomic(ParticleStore& store, SparseGrid& grid, ShapeFunction& shape, const Array3D& gravity, 
+        int quantity);
+    template<int W>
+    void _TransferColored(ParticleStore& store, SparseGrid& grid, ShapeFunction& shape, const Array3D& gravity, 
+        int quantity);
+private:
+    TransferMode _mode;
+    ThreadPool* _pool;
+
+    vector<MPM_STATS> _bin_offset;          //!< particles of block b are _bin_particle[_bin_offset[b], _bin_offset[b + 1])
+    vector<MPM_STATS> _bin_particle;
+    vector<MPM_STATS> _color_block[8];      //!< blocks with particles of each color
+
+    //!> Profiler entries
+    int _profile_transfer;
+    int _profile_bin;
+
+public:
+    inline TransferMode GetMode() {return _mode;}
+    inline int GetThreadNumber() {return _pool ? _pool->GetThreadNumber() : 1;}
+};
+
+#endif
@@ -0,0 +1,276 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of class 'ShapeFunction'
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "ShapeFunction.h"
+#include "../utility/AlignedMemory.h"
+#include "../utility/Profiler.h"
+
+ShapeFunction::ShapeFunction()
+{
+    _particle_number = 0;
+    _capacity = 0;
+    _weight = nullptr;
+    _node = nullptr;
+    _profile_update = -1;
+    Initialize(MPM::LinearShape);
+}
+
+ShapeFunction::~ShapeFunction()
+{
+    AlignedFree(_weight);
+    AlignedFree(_node);
+}
+
+bool ShapeFunction::Initialize(MPM::ShapeFunctionType type, MPM_FLOAT gimp_half_size)
+{
+    if (type == MPM::GIMPShape && (gimp_half_size <= 0.0 || gimp_half_size >= 0.5))
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, 
+            "*** INPUT ERROR *** Half size of GIMP particles should be in (0, 0.5) cell size.");
+        return false;
+    }
+
+    _type = type;
+    _gimp_half_size = gimp_half_size;
+    switch (_type)
+    {
+    case MPM::LinearShape:
+        _width = 2;
+        _stencil_low = 0;
+        _stencil_high = 1;
+        break;
+    case MPM::GIMPShape:
+    case MPM::QuadraticBSpline:
+        //!> Base node is the cell or the one below, depending on the half of the cell
+        _width = 3;
+        _stencil_low = -1;
+        _stencil_high = 2;
+        break;
+    case MPM::CubicBSpline:
+        _width = 4;
+        _stencil_low = -1;
+        _stencil_high = 2;
+        break;
+    }
+
+    //!> Rows are padded to whole cache lines, the cache is allocated again for the new strides
+    const int float_line = (int)(MPM::MemoryAlignment/sizeof(MPM_FLOAT));
+    const int stats_line = (int)(MPM::MemoryAlignment/sizeof(MPM_STATS));
+    _weight_stride = (6*_width + float_line - 1)/float_line*float_line;
+    _node_stride = (_width*_width*_width + stats_line - 1)/stats_line*stats_line;
+    AlignedFree(_weight);
+    AlignedFree(_node);
+    _particle_number = 0;
+    _capacity = 0;
+
+    _profile_update = Profiler::Register("Shape/" + TypeName(_type));
+    return true;
+}
+
+bool ShapeFunction::ParseType(const string& name, MPM::ShapeFunctionType& type)
+{
+    for (MPM::ShapeFunctionType t : {MPM::LinearShape, MPM::GIMPShape, MPM::QuadraticBSpline, MPM::CubicBSpline})
+    {
+        if (name == TypeName(t))
+        {
+            type = t;
+            return true;
+        }
+    }
+    return false;
+}
+
+string ShapeFunction::TypeName(MPM::ShapeFunctionType type)
+{
+    switch (type)
+    {
+    case MPM::LinearShape:
+        return "Linear";
+    case MPM::GIMPShape:
+        return "GIMP";
+    case MPM::QuadraticBSpline:
+        return "QuadraticBSpline";
+    case MPM::CubicBSpline:
+        return "CubicBSpline";
+    }
+    return "";
+}
+
+bool ShapeFunction::Update(ParticleStore& store, SparseGrid& grid, ThreadPool* pool)
+{
+    MPM_STATS number = store.GetActiveNumber();
+    ProfileScope profile(_profile_update, number);
+    if (number > _capacity && !_Reserve(number))
+        return false;
+    _particle_number = number;
+
+    const MPM_FLOAT inverse_cell_size = 1.0/grid.GetCellSize();
+    const Array3D origin = grid.GetOrigin();
+    const int width = _width;
+    const int nodes_number = width*width*width;
+    atomic<bool> outside(false);
+    auto update = [&](MPM_STATS begin, MPM_STATS end, int)
+    {
+        for (MPM_STATS p = begin; p < end; p++)
+        {
+            MPM_FLOAT* row = _weight + (size_t)p*_weight_stride;
+            int base[3];
+            for (int k = 0; k < 3; k++)
+            {
+                MPM_FLOAT x = (store.GetPosition(k)[p] - origin[k])*inverse_cell_size;
+                base[k] = _Weight1D(x, row + k*width, row + (3 + k)*width);
+                for (int o = 0; o < width; o++)
+                    row[(3 + k)*width + o] *= inverse_cell_size;
+            }
+
+            MPM_STATS* nodes = _node + (size_t)p*_node_stride;
+            grid.StencilNodes(base, 0, width - 1, nodes);
+            MPM_STATS lowest = *min_element(nodes, nodes + nodes_number);
+            if (lowest < 0)
+            {
+                outside = true;
+                return;
+            }
+        }
+    };
+    if (pool)
+        pool->ParallelFor(0, number, ThreadPool::Static, 0, update);
+    else
+        update(0, number, 0);
+
+    if (outside)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, 
+            "*** Error *** A particle stencil is out of the active grid blocks, the grid should be rebuilt.");
+        return false;
+    }
+    return true;
+}
+
+size_t ShapeFunction::GetMemoryBytes()
+{
+    return ((size_t)_weight_stride*sizeof(MPM_FLOAT) + (size_t)_node_stride*sizeof(MPM_STATS))*
+        (size_t)PaddedLength(_capacity);
+}
+
+int ShapeFunction::_Weight1D(MPM_FLOAT x, MPM_FLOAT* weight, MPM_FLOAT* gradient)
+{
+    int cell = (int)floor(x);
+    switch (_type)
+    {
+    case MPM::LinearShape:
+    {
+        MPM_FLOAT r = x - cell;
+        weight[0] = 1.0 - r;
+        weight[1] = r;
+        gradient[0] = -1.0;
+        gradient[1] = 1.0;
+        return cell;
+    }
+    case MPM::GIMPShape:
+    {
+        //!> S(r) of r = x - node, l the half size of particles
+        //!>    1 - (r^2 + l^2)/(2l)    |r| < l
+        //!>    1 - |r|                 l <= |r| < 1 - l
+        //!>    (1 + l - |r|)^2/(4l)    1 - l <= |r| < 1 + l
+        const MPM_FLOAT l = _gimp_half_size;
+        int base = x - cell < 0.5 ? cell - 1 : cell;
+        for (int o = 0; o < 3; o++)
+        {
+            MPM_FLOAT r = x - (base + o);
+            MPM_FLOAT a = fabs(r);
+            MPM_FLOAT sign = r < 0.0 ? -1.0 : 1.0;
+            if (a < l)
+            {
+                weight[o] = 1.0 - (r*r + l*l)/(2.0*l);
+                gradient[o] = -r/l;
+            }
+            else if (a < 1.0 - l)
+            {
+                weight[o] = 1.0 - a;
+                gradient[o] = -sign;
+            }
+            else if (a < 1.0 + l)
+            {
+                weight[o] = (1.0 + l - a)*(1.0 + l - a)/(4.0*l);
+                gradient[o] = -sign*(1.0 + l - a)/(2.0*l);
+            }
+            else
+            {
+                weight[o] = 0.0;
+                gradient[o] = 0.0;
+            }
+        }
+        return base;
+    }
+    case MPM::QuadraticBSpline:
+    {
+        //!> r = x - base in [0.5, 1.5)
+        int base = (int)floor(x - 0.5);
+        MPM_FLOAT r = x - base;
+        weight[0] = 0.5*(1.5 - r)*(1.5 - r);
+        weight[1] = 0.75 - (r - 1.0)*(r - 1.0);
+        weight[2] = 0.5*(r - 0.5)*(r - 0.5);
+        gradient[0] = r - 1.5;
+        gradient[1] = -2.0*(r - 1.0);
+        gradient[2] = r - 0.5;
+        return base;
+    }
+    case MPM::CubicBSpline:
+    {
+        //!> r = x - base in [1, 2), N(d) = |d|^3/2 - d^2 + 2/3 for |d| < 1, (2 - |d|)^3/6 for 1 <= |d| < 2
+        //!>    distances to the nodes are r, r - 1, 2 - r, 3 - r, with a = 2 - r and b = r - 1
+        int base = cell - 1;
+        MPM_FLOAT r = x - base;
+        MPM_FLOAT a = 2.0 - r;
+        MPM_FLOAT b = r - 1.0;
+        weight[0] = a*a*a/6.0;
+        weight[1] = 0.5*b*b*b - b*b + 2.0/3.0;
+        weight[2] = 0.5*a*a*a - a*a + 2.0/3.0;
+        weight[3] = b*b*b/6.0;
+        gradient[0] = -0.5*a*a;
+        gradient[1] = 1.5*b*b - 2.0*b;
+        gradient[2] = -1.5*a*a + 2.0*a;
+        gradient[3] = 0.5*b*b;
+        return base;
+    }
+    }
+    return cell;
+}
+
+bool ShapeFunction::_Reserve(MPM_STATS capacity)
+{
+    MPM_FLOAT* weight = AlignedAllocate<MPM_FLOAT>((MPM_STATS)((size_t)capacity*_weight_stride));
+    MPM_STATS* node = AlignedAllocate<MPM_STATS>((MPM_STATS)((size_t)capacity*_node_stride));
+    if (!weight || !node)
+    {
+        AlignedFree(weight);
+        AlignedFree(node);
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Failed to allocate the shape function cache of " + 
+            to_string(capacity) + " particles.");
+        return false;
+    }
+    AlignedFree(_weight);
+    AlignedFree(_node);
+    _weight = weight;
+    _node = node;
+    _capacity = capacity;
+    return true;
+}
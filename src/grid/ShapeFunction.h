@@ -0,0 +1,109 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Shape functions of the background grid and the
+        per-particle cache of their values. Linear, GIMP
+        (uniform GIMP), quadratic and cubic B-spline are tensor
+        products of 1D functions, so each particle keeps the
+        base node of its stencil, the 1D weights and gradients
+        in each direction, and the node indices of the stencil.
+        Rows of each particle are padded to whole cache lines.
+        The cache is updated once per step after the grid is
+        rebuilt, and read by the particle-to-grid transfer and
+        all grid-to-particle passes of the step, which form the
+        3D weight wx*wy*wz and gradient on the fly.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _SHAPEFUNCTION_H_
+#define _SHAPEFUNCTION_H_
+
+#include "../main/MPM3D_MACRO.h"
+#include "SparseGrid.h"
+
+namespace MPM{
+    enum ShapeFunctionType
+    {
+        LinearShape,            //!< 2 nodes in each direction
+        GIMPShape,              //!< uniform GIMP, 3 nodes in each direction
+        QuadraticBSpline,       //!< 3 nodes in each direction
+        CubicBSpline            //!< 4 nodes in each direction
+    };
+}
+
+class ShapeFunction
+{
+public:
+    ShapeFunction();
+    ~ShapeFunction();
+
+    ShapeFunction(const ShapeFunction&) = delete;
+    ShapeFunction& operator=(const ShapeFunction&) = delete;
+
+    //!> "gimp_half_size" is the half length of GIMP particles in cell sizes, in (0, 0.5), 0.25 for 2 particles
+    //!>    in each direction of a cell. It is not used by the other shape functions.
+    bool Initialize(MPM::ShapeFunctionType type, MPM_FLOAT gimp_half_size = 0.25);
+
+    //!> Type of name "Linear", "GIMP", "QuadraticBSpline" or "CubicBSpline", return false for other names
+    static bool ParseType(const string& name, MPM::ShapeFunctionType& type);
+    static string TypeName(MPM::ShapeFunctionType type);
+
+    //!> Weights, gradients and node indices of the active particles, the grid should be rebuilt with
+    //!>    "GetStencilLow()" and "GetStencilHigh()". Return false if a stencil node is not active
+    //!> Particles are updated on the threads of "pool" if not nullptr
+    bool Update(ParticleStore& store, SparseGrid& grid, ThreadPool* pool = nullptr);
+
+    //!> Bytes of the cache
+    size_t GetMemoryBytes();
+private:
+    //!> 1D weights and gradients (in cell units) of nodes base, base + 1, ... at "x" in cell units
+    //!>    from the grid origin, return the base node
+    int _Weight1D(MPM_FLOAT x, MPM_FLOAT* weight, MPM_FLOAT* gradient);
+
+    //!> Grow the cache to "capacity" particles
+    bool _Reserve(MPM_STATS capacity);
+private:
+    MPM::ShapeFunctionType _type;
+    MPM_FLOAT _gimp_half_size;
+    int _width;                     //!< nodes in each direction
+    int _stencil_low;               //!< stencil relative to the cell of a particle, for "SparseGrid::Rebuild"
+    int _stencil_high;
+
+    MPM_STATS _particle_number;     //!< particles in the cache
+    MPM_STATS _capacity;
+    int _weight_stride;             //!< row length of "_weight", 6*_width padded
+    int _node_stride;               //!< row length of "_node", _width^3 padded
+
+    //!> Row of each particle: wx, wy, wz, gx, gy, gz, _width values each, gradients in 1/length
+    MPM_FLOAT* _weight;
+    //!> Row of each particle: node indices of the stencil, x running fastest
+    MPM_STATS* _node;
+
+    int _profile_update;
+
+public:
+    inline MPM::ShapeFunctionType GetType() {return _type;}
+    inline int GetWidth() {return _width;}
+    inline int GetStencilLow() {return _stencil_low;}
+    inline int GetStencilHigh() {return _stencil_high;}
+    inline MPM_STATS GetParticleNumber() {return _particle_number;}
+
+    //!> Rows of particle "p"
+    inline const MPM_FLOAT* GetWeight(MPM_STATS p) {return _weight + (size_t)p*_weight_stride;}
+    inline const MPM_STATS* GetNode(MPM_STATS p) {return _node + (size_t)p*_node_stride;}
+};
+
+#endif
@@ -0,0 +1,328 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of class 'SparseGrid'
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "SparseGrid.h"
+#include "../body/ParticleReorder.h"
+#include "../utility/AlignedMemory.h"
+#include "../utility/Profiler.h"
+#include "../utility/SIMD.h"
+
+const uint64_t SparseGrid::EmptyKey;
+
+SparseGrid::SparseGrid()
+{
+    _origin.fill(0.0);
+    _cell_size = 1.0;
+    _inverse_cell_size = 1.0;
+
+    _block_number = 0;
+    _block_capacity = 0;
+    _mass = nullptr;
+    for (int i = 0; i < 3; i++)
+    {
+        _block_coordinate[i] = nullptr;
+        _momentum[i] = nullptr;
+        _force[i] = nullptr;
+        _velocity[i] = nullptr;
+    }
+
+    _RebuildTable(64);
+    _profile_rebuild = Profiler::Register("Grid/Rebuild");
+}
+
+SparseGrid::~SparseGrid()
+{
+    AlignedFree(_mass);
+    for (int i = 0; i < 3; i++)
+    {
+        AlignedFree(_block_coordinate[i]);
+        AlignedFree(_momentum[i]);
+        AlignedFree(_force[i]);
+        AlignedFree(_velocity[i]);
+    }
+}
+
+bool SparseGrid::Initialize(const Array3D& origin, MPM_FLOAT cell_size)
+{
+    if (cell_size <= MPM_EPSILON)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** INPUT ERROR *** cell size of the grid should be positive.");
+        return false;
+    }
+
+    _origin = origin;
+    _cell_size = cell_size;
+    _inverse_cell_size = 1.0/cell_size;
+    ClearBlocks();
+    return true;
+}
+
+bool SparseGrid::Rebuild(ParticleStore& store, int stencil_low, int stencil_high, ThreadPool* pool)
+{
+    MPM_STATS number = store.GetActiveNumber();
+    ProfileScope profile(_profile_rebuild, number);
+    ClearBlocks();
+
+    const MPM_FLOAT* x = store.GetPosition(0);
+    const MPM_FLOAT* y = store.GetPosition(1);
+    const MPM_FLOAT* z = store.GetPosition(2);
+    int last_low[3] = {INT32_MAX, INT32_MAX, INT32_MAX};
+    int last_high[3] = {INT32_MAX, INT32_MAX, INT32_MAX};
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        int cell[3], low[3], high[3];
+        Cell(x[i], y[i], z[i], cell);
+        for (int k = 0; k < 3; k++)
+        {
+            low[k] = _BlockOf(cell[k] + stencil_low);
+            high[k] = _BlockOf(cell[k] + stencil_high);
+        }
+
+        //!> Consecutive particles often touch the same blocks after reordering
+        if (equal(low, low + 3, last_low) && equal(high, high + 3, last_high))
+            continue;
+        copy(low, low + 3, last_low);
+        copy(high, high + 3, last_high);
+
+        for (int bz = low[2]; bz <= high[2]; bz++)
+            for (int by = low[1]; by <= high[1]; by++)
+                for (int bx = low[0]; bx <= high[0]; bx++)
+                    if (ActivateBlock(bx, by, bz) < 0)
+                        return false;
+    }
+
+    _SortBlocks();
+    ResetNodes(pool);
+    return true;
+}
+
+void SparseGrid::ClearBlocks()
+{
+    fill(_table_key.begin(), _table_key.end(), EmptyKey);
+    _block_number = 0;
+}
+
+MPM_STATS SparseGrid::ActivateBlock(int bx, int by, int bz)
+{
+    uint64_t key = _BlockKey(bx, by, bz);
+    uint64_t slot = _Hash(key);
+    for (; _table_key[slot] != EmptyKey; slot = (slot + 1) & _table_mask)
+        if (_table_key[slot] == key)
+            return _table_block[slot];
+    
+    if (_block_number == _block_capacity && !_ReserveBlocks(max<MPM_STATS>(64, _block_capacity*2)))
+        return -1;
+
+    MPM_STATS block = _block_number++;
+    _block_coordinate[0][block] = bx;
+    _block_coordinate[1][block] = by;
+    _block_coordinate[2][block] = bz;
+
+    if ((uint64_t)_block_number*2 > _table_key.size())
+        _RebuildTable(_table_key.size()*2);
+    else
+    {
+        _table_key[slot] = key;
+        _table_block[slot] = block;
+    }
+    return block;
+}
+
+template<class Loop>
+void SparseGrid::_ForNodes(ThreadPool* pool, Loop loop)
+{
+    if (!pool)
+    {
+        loop(0, _block_number*MPM::GridBlockNodes);
+        return;
+    }
+    pool->ParallelFor(0, _block_number, ThreadPool::Static, 0, [&](MPM_STATS begin, MPM_STATS end, int)
+    {
+        loop(begin*MPM::GridBlockNodes, end*MPM::GridBlockNodes);
+    });
+}
+
+void SparseGrid::ResetNodes(ThreadPool* pool)
+{
+    _ForNodes(pool, [this](MPM_STATS begin, MPM_STATS end)
+    {
+        fill(_mass + begin, _mass + end, 0.0);
+        for (int i = 0; i < 3; i++)
+        {
+            fill(_momentum[i] + begin, _momentum[i] + end, 0.0);
+            fill(_force[i] + begin, _force[i] + end, 0.0);
+            fill(_velocity[i] + begin, _velocity[i] + end, 0.0);
+        }
+    });
+}
+
+void SparseGrid::ResetMomentum(ThreadPool* pool)
+{
+    _ForNodes(pool, [this](MPM_STATS begin, MPM_STATS end)
+    {
+        for (int i = 0; i < 3; i++)
+            fill(_momentum[i] + begin, _momentum[i] + end, 0.0);
+    });
+}
+
+void SparseGrid::IntegrateMomentum(MPM_FLOAT dt, ThreadPool* pool)
+{
+    _ForNodes(pool, [this, dt](MPM_STATS begin, MPM_STATS end)
+    {
+        const MPM_FLOAT* MPM_RESTRICT mass = _mass;
+        for (int i = 0; i < 3; i++)
+        {
+            MPM_FLOAT* MPM_RESTRICT momentum = _momentum[i];
+            MPM_FLOAT* MPM_RESTRICT velocity = _velocity[i];
+            const MPM_FLOAT* MPM_RESTRICT force = _force[i];
+            for (MPM_STATS n = begin; n < end; n++)
+            {
+                momentum[n] += force[n]*dt;
+                velocity[n] = mass[n] > 0.0 ? momentum[n]/mass[n] : 0.0;
+            }
+        }
+    });
+}
+
+void SparseGrid::UpdateVelocity(ThreadPool* pool)
+{
+    _ForNodes(pool, [this](MPM_STATS begin, MPM_STATS end)
+    {
+        const MPM_FLOAT* MPM_RESTRICT mass = _mass;
+        for (int i = 0; i < 3; i++)
+        {
+            const MPM_FLOAT* MPM_RESTRICT momentum = _momentum[i];
+            MPM_FLOAT* MPM_RESTRICT velocity = _velocity[i];
+            for (MPM_STATS n = begin; n < end; n++)
+                velocity[n] = mass[n] > 0.0 ? momentum[n]/mass[n] : 0.0;
+        }
+    });
+}
+
+void SparseGrid::NodeCoordinate(MPM_STATS node, int (&coordinate)[3])
+{
+    MPM_STATS block = node/MPM::GridBlockNodes;
+    int local = node%MPM::GridBlockNodes;
+    const int mask = MPM::GridBlockEdge - 1;
+    coordinate[0] = (_block_coordinate[0][block] << MPM::GridBlockShift) + (local & mask);
+    coordinate[1] = (_block_coordinate[1][block] << MPM::GridBlockShift) + ((local >> MPM::GridBlockShift) & mask);
+    coordinate[2] = (_block_coordinate[2][block] << MPM::GridBlockShift) + (local >> 2*MPM::GridBlockShift);
+}
+
+void SparseGrid::NodePosition(MPM_STATS node, Array3D& position)
+{
+    int coordinate[3];
+    NodeCoordinate(node, coordinate);
+    for (int k = 0; k < 3; k++)
+        position[k] = _origin[k] + coordinate[k]*_cell_size;
+}
+
+size_t SparseGrid::GetMemoryBytes()
+{
+    size_t node_bytes = 10*sizeof(MPM_FLOAT)*(size_t)PaddedLength(_block_capacity*MPM::GridBlockNodes);
+    size_t block_bytes = 3*sizeof(int)*(size_t)PaddedLength(_block_capacity);
+    size_t table_bytes = _table_key.size()*(sizeof(uint64_t) + sizeof(MPM_STATS));
+    return node_bytes + block_bytes + table_bytes;
+}
+
+bool SparseGrid::_ReserveBlocks(MPM_STATS block_capacity)
+{
+    MPM_STATS node_capacity = block_capacity*MPM::GridBlockNodes;
+    MPM_STATS node_number = _block_number*MPM::GridBlockNodes;
+    bool allocated = true;
+
+    auto grow = [&](auto*& array, MPM_STATS capacity, MPM_STATS number)
+    {
+        typedef typename remove_reference<decltype(*array)>::type T;
+        T* grown = AlignedAllocate<T>(capacity);
+        if (!grown)
+        {
+            allocated = false;
+            return;
+        }
+        if (array)
+            copy(array, array + number, grown);
+        AlignedFree(array);
+        array = grown;
+    };
+
+    for (int i = 0; i < 3; i++)
+        grow(_block_coordinate[i], block_capacity, _block_number);
+    grow(_mass, node_capacity, node_number);
+    for (int i = 0; i < 3; i++)
+    {
+        grow(_momentum[i], node_capacity, node_number);
+        grow(_force[i], node_capacity, node_number);
+        grow(_velocity[i], node_capacity, node_number);
+    }
+
+    if (!allocated)
+    {
+        string error_msg = "*** Error *** Failed to allocate memory for " + to_string(block_capacity) + 
+            " grid blocks.";
+        MPM3D_ErrorMessage(__FILE__, __LINE__, error_msg);
+        return false;
+    }
+    _block_capacity = block_capacity;
+    return true;
+}
+
+void SparseGrid::_RebuildTable(uint64_t table_size)
+{
+    _table_key.assign(table_size, EmptyKey);
+    _table_block.assign(table_size, -1);
+    _table_mask = table_size - 1;
+    _table_shift = 64;
+    for (uint64_t size = table_size; size > 1; size >>= 1)
+        _table_shift--;
+
+    for (MPM_STATS block = 0; block < _block_number; block++)
+    {
+        uint64_t key = _BlockKey(_block_coordinate[0][block], _block_coordinate[1][block], 
+            _block_coordinate[2][block]);
+        uint64_t slot = _Hash(key);
+        while (_table_key[slot] != EmptyKey)
+            slot = (slot + 1) & _table_mask;
+        _table_key[slot] = key;
+        _table_block[slot] = block;
+    }
+}
+
+void SparseGrid::_SortBlocks()
+{
+    vector< pair<uint64_t, MPM_STATS> > order(_block_number);
+    for (MPM_STATS block = 0; block < _block_number; block++)
+    {
+        uint32_t u[3];
+        for (int k = 0; k < 3; k++)
+            u[k] = (uint32_t)(_block_coordinate[k][block] + (1 << 20));
+        order[block] = make_pair(ParticleReorder::MortonIndex(u[0], u[1], u[2]), block);
+    }
+    sort(order.begin(), order.end());
+
+    vector<int> coordinate(_block_number);
+    for (int k = 0; k < 3; k++)
+    {
+        for (MPM_STATS block = 0; block < _block_number; block++)
+            coordinate[block] = _block_coordinate[k][order[block].second];
+        copy(coordinate.begin(), coordinate.end(), _block_coordinate[k]);
+    }
+    _RebuildTable(_table_key.size());
+}
@@ -0,0 +1,228 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Sparse block-structured background grid. Nodes are
+        allocated in blocks of 4x4x4 (GridBlockShift = 3 for
+        8x8x8) which are touched by the stencils of particles,
+        found through an open-addressing hash table of block
+        coordinates. Only the active blocks are allocated and
+        reset, so mostly empty domains cost memory and time in
+        proportion to the particles instead of the bounding
+        box. Node values are structure-of-arrays over all
+        active blocks, node index = block*GridBlockNodes +
+        local index, x running fastest in a block. Blocks are
+        numbered in Morton order of their coordinates.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _SPARSEGRID_H_
+#define _SPARSEGRID_H_
+
+#include "../main/MPM3D_MACRO.h"
+#include "../body/ParticleStore.h"
+#include "../utility/ThreadPool.h"
+#include <cstdint>
+#include <cassert>
+
+namespace MPM{
+    //!> Edge of a grid block is 2^GridBlockShift nodes
+    const int GridBlockShift = 2;
+    const int GridBlockEdge = 1 << GridBlockShift;
+    const int GridBlockNodes = GridBlockEdge*GridBlockEdge*GridBlockEdge;
+    //!> Maximum nodes of a particle stencil in each direction, not larger than GridBlockEdge
+    const int MaxStencilWidth = 4;
+}
+
+class SparseGrid
+{
+public:
+    SparseGrid();
+    ~SparseGrid();
+
+    SparseGrid(const SparseGrid&) = delete;
+    SparseGrid& operator=(const SparseGrid&) = delete;
+
+    //!> Node (0, 0, 0) is at "origin", nodes are "cell_size" apart in each direction
+    bool Initialize(const Array3D& origin, MPM_FLOAT cell_size);
+
+    //!> Activate the blocks of nodes [cell + stencil_low, cell + stencil_high] of each active particle,
+    //!>    e.g. 0 and 1 for linear shape functions, and set their node values to zero
+    //!> Blocks activated before are released, node indices of the last step are invalid
+    //!> Node values are set to zero on the threads of "pool" if not nullptr
+    bool Rebuild(ParticleStore& store, int stencil_low, int stencil_high, ThreadPool* pool = nullptr);
+
+    //!> Release all blocks, the memory is kept for the next "Rebuild"
+    void ClearBlocks();
+
+    //!> Activate the block at block coordinate (bx, by, bz), return the block index, -1 if failed
+    //!> Node values of a new block are not initialized, see "ResetNodes"
+    MPM_STATS ActivateBlock(int bx, int by, int bz);
+
+    //!> Node loops below run on the threads of "pool" by blocks, on the calling thread for nullptr
+
+    //!> Set the node values of all active blocks to zero
+    void ResetNodes(ThreadPool* pool = nullptr);
+
+    //!> Set the node momentum to zero, before the momentum of the particles is mapped again
+    void ResetMomentum(ThreadPool* pool = nullptr);
+
+    //!> Momentum by the force in a time step "dt", and the node velocity
+    void IntegrateMomentum(MPM_FLOAT dt, ThreadPool* pool = nullptr);
+
+    //!> Node velocity = momentum/mass, zero for nodes without mass
+    void UpdateVelocity(ThreadPool* pool = nullptr);
+
+    //!> Block index at block coordinate (bx, by, bz), -1 if not active
+    inline MPM_STATS BlockIndex(int bx, int by, int bz)
+    {
+        uint64_t key = _BlockKey(bx, by, bz);
+        for (uint64_t slot = _Hash(key); ; slot = (slot + 1) & _table_mask)
+        {
+            if (_table_key[slot] == key)
+                return _table_block[slot];
+            if (_table_key[slot] == EmptyKey)
+                return -1;
+        }
+    }
+
+    //!> Node index of node (ix, iy, iz), -1 if its block is not active
+    inline MPM_STATS NodeIndex(int ix, int iy, int iz)
+    {
+        MPM_STATS block = BlockIndex(_BlockOf(ix), _BlockOf(iy), _BlockOf(iz));
+        if (block < 0)
+            return -1;
+        const int mask = MPM::GridBlockEdge - 1;
+        return block*MPM::GridBlockNodes + (ix & mask) + MPM::GridBlockEdge*((iy & mask) + 
+            MPM::GridBlockEdge*(iz & mask));
+    }
+
+    //!> Node indices of the stencil nodes [cell + low, cell + high] in each direction, x running fastest,
+    //!>    -1 for nodes of inactive blocks. A stencil spans 2 blocks at most in each direction, so at most
+    //!>    8 blocks are looked up instead of each node
+    inline void StencilNodes(const int (&cell)[3], int low, int high, MPM_STATS* nodes)
+    {
+        const int width = high - low + 1;
+        assert(width >= 1 && width <= MPM::MaxStencilWidth);
+        const int mask = MPM::GridBlockEdge - 1;
+        int first_block[3], last_offset[3], block_offset[3][MPM::MaxStencilWidth], local[3][MPM::MaxStencilWidth];
+        for (int k = 0; k < 3; k++)
+        {
+            first_block[k] = _BlockOf(cell[k] + low);
+            last_offset[k] = _BlockOf(cell[k] + high) - first_block[k];
+            for (int o = 0; o < width; o++)
+            {
+                int index = cell[k] + low + o;
+                block_offset[k][o] = _BlockOf(index) - first_block[k];
+                local[k][o] = index & mask;
+            }
+        }
+
+        MPM_STATS block[2][2][2];
+        for (int bz = 0; bz <= last_offset[2]; bz++)
+            for (int by = 0; by <= last_offset[1]; by++)
+                for (int bx = 0; bx <= last_offset[0]; bx++)
+                    block[bz][by][bx] = BlockIndex(first_block[0] + bx, first_block[1] + by, first_block[2] + bz);
+
+        for (int oz = 0; oz < width; oz++)
+            for (int oy = 0; oy < width; oy++)
+                for (int ox = 0; ox < width; ox++)
+                {
+                    MPM_STATS b = block[block_offset[2][oz]][block_offset[1][oy]][block_offset[0][ox]];
+                    *nodes++ = b < 0 ? -1 : b*MPM::GridBlockNodes + local[0][ox] + 
+                        MPM::GridBlockEdge*(local[1][oy] + MPM::GridBlockEdge*local[2][oz]);
+                }
+    }
+
+    //!> Cell (index of the node below) of a position
+    inline void Cell(MPM_FLOAT x, MPM_FLOAT y, MPM_FLOAT z, int (&cell)[3])
+    {
+        cell[0] = (int)floor((x - _origin[0])*_inverse_cell_size);
+        cell[1] = (int)floor((y - _origin[1])*_inverse_cell_size);
+        cell[2] = (int)floor((z - _origin[2])*_inverse_cell_size);
+    }
+
+    //!> Grid coordinates (ix, iy, iz) and position of a node
+    void NodeCoordinate(MPM_STATS node, int (&coordinate)[3]);
+    void NodePosition(MPM_STATS node, Array3D& position);
+
+    //!> Bytes of node values, block coordinates and the hash table
+    size_t GetMemoryBytes();
+
+    static const uint64_t EmptyKey = UINT64_MAX;
+private:
+    //!> Floor division of a node index by the block edge
+    static inline int _BlockOf(int index) {return index >= 0 ? index >> MPM::GridBlockShift : 
+        -((-index - 1) >> MPM::GridBlockShift) - 1;}
+
+    //!> 21 bits of each coordinate with an offset of 2^20
+    static inline uint64_t _BlockKey(int bx, int by, int bz)
+    {
+        const uint64_t mask = (1 << 21) - 1;
+        return ((uint64_t)(bx + (1 << 20)) & mask) << 42 | ((uint64_t)(by + (1 << 20)) & mask) << 21 | 
+            ((uint64_t)(bz + (1 << 20)) & mask);
+    }
+
+    inline uint64_t _Hash(uint64_t key) {return (key*0x9E3779B97F4A7C15ULL) >> _table_shift;}
+
+    //!> Grow node arrays to "block_capacity" blocks, keeping the values
+    bool _ReserveBlocks(MPM_STATS block_capacity);
+
+    //!> Rebuild the hash table with "table_size" slots from the block coordinates
+    void _RebuildTable(uint64_t table_size);
+
+    //!> Renumber the active blocks in Morton order of their coordinates
+    void _SortBlocks();
+
+    //!> Run "loop(node_begin, node_end)" on ranges of whole blocks, on the threads of "pool" if not nullptr
+    template<class Loop>
+    void _ForNodes(ThreadPool* pool, Loop loop);
+private:
+    Array3D _origin;
+    MPM_FLOAT _cell_size;
+    MPM_FLOAT _inverse_cell_size;
+
+    MPM_STATS _block_number;            //!< active blocks [0, _block_number)
+    MPM_STATS _block_capacity;
+    int* _block_coordinate[3];          //!< bx, by, bz of each block
+
+    //!> Node values, GridBlockNodes entries for each block
+    MPM_FLOAT* _mass;
+    MPM_FLOAT* _momentum[3];
+    MPM_FLOAT* _force[3];
+    MPM_FLOAT* _velocity[3];
+
+    //!> Hash table of block coordinates, linear probing, at most half full
+    vector<uint64_t> _table_key;
+    vector<MPM_STATS> _table_block;
+    uint64_t _table_mask;
+    int _table_shift;
+
+    int _profile_rebuild;
+
+public:
+    inline MPM_FLOAT GetCellSize() {return _cell_size;}
+    inline Array3D GetOrigin() {return _origin;}
+    inline MPM_STATS GetBlockNumber() {return _block_number;}
+    inline MPM_STATS GetNodeNumber() {return _block_number*MPM::GridBlockNodes;}
+    inline int* GetBlockCoordinate(int component) {return _block_coordinate[component];}
+
+    inline MPM_FLOAT* GetMass() {return _mass;}
+    inline MPM_FLOAT* GetMomentum(int component) {return _momentum[component];}
+    inline MPM_FLOAT* GetForce(int component) {return _force[component];}
+    inline MPM_FLOAT* GetVelocity(int component) {return _velocity[component];}
+};
+
+#endif
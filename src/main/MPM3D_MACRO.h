@@ -28,6 +28,8 @@
 #include <algorithm>
 #include <iostream>
 #include <fstream>
+#include <cmath>
+#include <cfloat>
 using namespace std;
 
 #ifdef _MPM_DOUBLE
@@ -72,6 +74,9 @@ namespace MPM{
         USF         //!< update-stress-first formulation
     };
 
+    //!> Number of particles processed together by batch kernels
+    const MPM_STATS ParticleChunkSize = 64;
+
     //!> Number of extra particle properties
     const MPM_STATS ExtraParticlePropertySum = 11;
     //!> Extra property list
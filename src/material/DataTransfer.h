@@ -0,0 +1,61 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Data transferred between Strength, EOS and Failure
+        models during the stress update of one particle
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _DATATRANSFER_H_
+#define _DATATRANSFER_H_
+
+#include "../main/MPM3D_MACRO.h"
+
+class SimulationContext;
+
+struct DataTransfer
+{
+    //!> Slots updated in every step, reset by "Reset()" before each particle
+    bool yield;             //!< whether the particle yields, used for temperature update
+    MPM_FLOAT depeff;       //!< increment of effective plastic strain
+    MPM_FLOAT lsrate;       //!< log(strain rate) of Johnson-Cook model
+    MPM_FLOAT tstar;        //!< dimensionless temperature of Johnson-Cook model
+
+    //!> Time steps and current time of the simulation, set by MaterialFactory before the update
+    const SimulationContext* context;
+
+    //!> Slots for particle property initialization
+    MPM_FLOAT roomt;        //!< room temperature for particle property "kelvin"
+    MPM_FLOAT sigma_y;      //!< initial yield stress for particle property "sigma_y"
+
+    DataTransfer()
+    {
+        Reset();
+        context = nullptr;
+        roomt = 0.0;
+        sigma_y = 0.0;
+    }
+
+    inline void Reset()
+    {
+        yield = false;
+        depeff = 0.0;
+        lsrate = 0.0;
+        tstar = 0.0;
+    }
+};
+
+#endif
@@ -19,7 +19,8 @@
 ==============================================================*/
 
 #include "MaterialFactory.h"
-#include "../solver/Solver_Base.h"
+#include "MaterialKernel.h"
+#include "../utility/Profiler.h"
 
 MaterialFactory::MaterialFactory()
 {
@@ -30,12 +31,32 @@ MaterialFactory::MaterialFactory()
     _bq2 = 0.06;
     _fail_response_type = 0;
     _tensile_cutoff = 0.0;
+    _fast_math = 0.0;
+    _time_step_scale = 1.0;
+    _max_time_step = numeric_limits<MPM_FLOAT>::max();
+    _cost_smoothing = 0.1;
+    _particle_cost[0].store(1.0, memory_order_relaxed);
+    _particle_cost[1].store(1.0, memory_order_relaxed);
+    _cost_measured.store(false, memory_order_relaxed);
+    _stress_kernel = &MaterialFactory::_UpdateStressKernel<Strength_Base, EOS_Base, Failure_Base>;
+    _profile_material = -1;
+    _profile_model = -1;
+    _profile_strength = -1;
+    _profile_sound_speed = -1;
+    _profile_pressure = -1;
+    _profile_failure = -1;
+    _profile_gather = -1;
+    _profile_output = -1;
 
     ParameterMap_Material["ReferenceDensity"] = &_reference_density;
     ParameterMap_Material["bq1"] = &_bq1;
     ParameterMap_Material["bq2"] = &_bq2;
     ParameterMap_Material["FailedType"] = &_fail_response_type;
     ParameterMap_Material["TensileCutoff"] = &_tensile_cutoff;
+    ParameterMap_Material["FastMath"] = &_fast_math;
+    ParameterMap_Material["TimeStepScale"] = &_time_step_scale;
+    ParameterMap_Material["MaxTimeStep"] = &_max_time_step;
+    ParameterMap_Material["CostSmoothing"] = &_cost_smoothing;
 }
 
 MaterialFactory::~MaterialFactory()
@@ -69,22 +90,33 @@ bool MaterialFactory::Initialize(string& strength_name, map<string, MPM_FLOAT>&
             return false;
         }
     }
+    if (_time_step_scale <= 0.0 || _time_step_scale > 1.0 || _max_time_step <= 0.0)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, 
+            "*** INPUT ERROR *** TimeStepScale should be in (0, 1] and MaxTimeStep should be positive.");
+        return false;
+    }
+    if (_cost_smoothing <= 0.0 || _cost_smoothing > 1.0)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** INPUT ERROR *** CostSmoothing should be in (0, 1].");
+        return false;
+    }
 
     //!> Strength model
     if (strength_name == "IsoElastic")
-        _strength = new Strength_IsoElastic;
+        _strength = new FinalModel<Strength_IsoElastic>;
     else if (strength_name == "ElaPlastic")
-        _strength = new Strength_ElaPlastic;
+        _strength = new FinalModel<Strength_ElaPlastic>;
     else if (strength_name == "IsoHarden")
-        _strength = new Strength_IsoHarden;
+        _strength = new FinalModel<Strength_IsoHarden>;
     else if (strength_name == "JohnsonCook")
-        _strength = new Strength_JohnsonCook;
+        _strength = new FinalModel<Strength_JohnsonCook>;
     else if (strength_name == "SimJohnsonCook")
-        _strength = new Strength_SimpleJohnsonCook;
+        _strength = new FinalModel<Strength_SimpleJohnsonCook>;
     else if (strength_name == "DruckerPrager")
-        _strength = new Strength_DruckerPrager;
+        _strength = new FinalModel<Strength_DruckerPrager>;
     else if (strength_name == "Null")
-        _strength = new Strength_Null;
+        _strength = new FinalModel<Strength_Null>;
     else
     {
         string error_msg = "*** Input Error *** There is no strength model named " + strength_name + "!";
@@ -94,18 +126,19 @@ bool MaterialFactory::Initialize(string& strength_name, map<string, MPM_FLOAT>&
 
     if (!_strength->Initialize(strength_para, _reference_density))
         return false;
+    _strength->SetFastMath(_fast_math > MPM_EPSILON);
     
     //!> EOS model
     if (eos_name == "Polynomial")
-        _eos = new EOS_Polynomial;
+        _eos = new FinalModel<EOS_Polynomial>;
     else if (eos_name == "Gruneisen")
-        _eos = new EOS_Gruneisen;
+        _eos = new FinalModel<EOS_Gruneisen>;
     else if (eos_name == "SimGruneisen")
-        _eos = new EOS_SimpleGruneisen;
+        _eos = new FinalModel<EOS_SimpleGruneisen>;
     else if (eos_name == "JWL")
-        _eos = new EOS_JWL;
+        _eos = new FinalModel<EOS_JWL>;
     else if (eos_name == "HighExpBurn")
-        _eos = new EOS_HighExpBurn;
+        _eos = new FinalModel<EOS_HighExpBurn>;
     else if (eos_name != "" && eos_name != "none" && eos_name != "None")
     {
         string error_msg = "*** Input Error *** There is no EOS model named " + eos_name + "!";
@@ -118,20 +151,17 @@ bool MaterialFactory::Initialize(string& strength_name, map<string, MPM_FLOAT>&
             return false;
 
     //!> Failure model
-    if (failure_name_list.empty())
-        return true;    //!< There is no failure model
-    
     for (int n = 0; n < failure_name_list.size(); n++)
     {
         Failure_Base* failure_temp = nullptr;
         if (failure_name_list[n] == "PlaStrain")
-            failure_temp = new Failure_PlaStrain;
+            failure_temp = new FinalModel<Failure_PlaStrain>;
         else if (failure_name_list[n] == "PriStrain")
-            failure_temp = new Failure_PriStrain;
+            failure_temp = new FinalModel<Failure_PriStrain>;
         else if (failure_name_list[n] == "PriStress")
-            failure_temp = new Failure_PriStress;
+            failure_temp = new FinalModel<Failure_PriStress>;
         else if (failure_name_list[n] == "JohnsonCookDamage")
-            failure_temp = new Failure_Damage_JohnsonCook;
+            failure_temp = new FinalModel<Failure_Damage_JohnsonCook>;
         else if (failure_name_list[n] != "" && failure_name_list[n] != "none" &&
                  failure_name_list[n] != "None")
         {
@@ -144,14 +174,120 @@ bool MaterialFactory::Initialize(string& strength_name, map<string, MPM_FLOAT>&
         {
             if (!failure_temp->Initialize(failure_para_list[n]))
                 return false;
+            failure_temp->SetFastMath(_fast_math > MPM_EPSILON);
             _failure.push_back(failure_temp);
         }
     }
+
+    //!> Relative costs by the number of models, a yielded particle also runs the return mapping
+    MPM_FLOAT model_cost = 1.0 + (_eos ? 1.0 : 0.0) + _failure.size();
+    bool plastic = !IsFinalModel<Strength_IsoElastic>(_strength) && !IsFinalModel<Strength_Null>(_strength);
+    _particle_cost[0].store(model_cost, memory_order_relaxed);
+    _particle_cost[1].store(model_cost + (plastic ? 1.0 : 0.0), memory_order_relaxed);
+    _cost_measured.store(false, memory_order_relaxed);
+
+    _stress_kernel = _SelectKernel();
+    _RegisterProfile(strength_name, eos_name, failure_name_list);
+    return true;
+}
+
+void MaterialFactory::_UpdateParticleCost(uint64_t time_ns, MPM_STATS number, MPM_STATS yielded)
+{
+    //!> Threads updating other chunks may store in between, a lost update only delays the smoothing
+    MPM_FLOAT cost[2] = {_particle_cost[0].load(memory_order_relaxed), _particle_cost[1].load(memory_order_relaxed)};
+    MPM_FLOAT estimate = (number - yielded)*cost[0] + yielded*cost[1];
+    if (number <= 0 || estimate <= 0.0)
+        return;
+
+    MPM_FLOAT ratio = time_ns/estimate;
+    if (!_cost_measured.exchange(true, memory_order_relaxed))
+    {
+        //!> The first measurement turns the relative costs into nanoseconds
+        cost[0] *= ratio;
+        cost[1] *= ratio;
+    }
+    else if (yielded == 0 || yielded == number)
+    {
+        bool yield = yielded > 0;
+        cost[yield] += _cost_smoothing*((MPM_FLOAT)time_ns/number - cost[yield]);
+        _particle_cost[yield].store(cost[yield], memory_order_relaxed);
+        return;
+    }
+    else
+    {
+        MPM_FLOAT scale = 1.0 + _cost_smoothing*(ratio - 1.0);
+        cost[0] *= scale;
+        cost[1] *= scale;
+    }
+    _particle_cost[0].store(cost[0], memory_order_relaxed);
+    _particle_cost[1].store(cost[1], memory_order_relaxed);
+}
+
+void MaterialFactory::_RegisterProfile(string& strength_name, string& eos_name, vector<string>& failure_name_list)
+{
+    string model_name = strength_name;
+    if (_eos)
+        model_name += "+" + eos_name;
+
+    string failure_name;
+    for (size_t n = 0; n < failure_name_list.size(); n++)
+        if (failure_name_list[n] != "" && failure_name_list[n] != "none" && failure_name_list[n] != "None")
+            failure_name += (failure_name.empty() ? "" : "+") + failure_name_list[n];
+    if (failure_name.empty())
+        failure_name = "None";
+
+    _profile_material = Profiler::Register("Material");
+    _profile_model = Profiler::Register("Material/" + model_name);
+    _profile_strength = Profiler::Register("Strength/" + strength_name);
+    _profile_sound_speed = Profiler::Register("SoundSpeed/" + model_name);
+    _profile_pressure = Profiler::Register("Pressure/" + (_eos ? eos_name : strength_name));
+    _profile_failure = Profiler::Register("Failure/" + failure_name);
+    _profile_gather = Profiler::Register("ParticleStore/GatherScatter");
+    _profile_output = Profiler::Register("Output/Material");
+}
+
+MaterialFactory::StressKernel MaterialFactory::_SelectKernel()
+{
+    StressKernel kernel = nullptr;
+    if (IsFinalModel<Strength_IsoElastic>(_strength))
+        kernel = _SelectKernel_SolidEOS<FinalModel<Strength_IsoElastic> >();
+    else if (IsFinalModel<Strength_ElaPlastic>(_strength))
+        kernel = _SelectKernel_SolidEOS<FinalModel<Strength_ElaPlastic> >();
+    else if (IsFinalModel<Strength_IsoHarden>(_strength))
+        kernel = _SelectKernel_SolidEOS<FinalModel<Strength_IsoHarden> >();
+    else if (IsFinalModel<Strength_JohnsonCook>(_strength))
+        kernel = _SelectKernel_SolidEOS<FinalModel<Strength_JohnsonCook> >();
+    else if (IsFinalModel<Strength_SimpleJohnsonCook>(_strength))
+        kernel = _SelectKernel_SolidEOS<FinalModel<Strength_SimpleJohnsonCook> >();
+    else if (IsFinalModel<Strength_DruckerPrager>(_strength))
+        kernel = _SelectKernel_SolidEOS<FinalModel<Strength_DruckerPrager> >();
+    else if (IsFinalModel<Strength_Null>(_strength))
+        kernel = _SelectKernel_FluidEOS<FinalModel<Strength_Null> >();
+
+    //!> Exotic combination, e.g. solid strength with JWL EOS
+    if (!kernel)
+        kernel = &MaterialFactory::_UpdateStressKernel<Strength_Base, EOS_Base, Failure_Base>;
+    return kernel;
+}
+
+bool MaterialFactory::AddExtraParticleProperty(vector<MPM::ExtraParticleProperty>& ExtraProp, DataTransfer& transfer)
+{
+    if (!_strength->AddExtraParticleProperty_Strength(ExtraProp, transfer))
+        return false;
+
+    if (_eos)
+        if (!_eos->AddExtraParticleProperty_EOS(ExtraProp, transfer))
+            return false;
+
+    for (auto failure : _failure)
+        if (!failure->AddExtraParticleProperty_Failure(ExtraProp, transfer))
+            return false;
     return true;
 }
 
 void MaterialFactory::Write(ofstream& os, int number)
 {
+    ProfileScope profile(_profile_output);
     os << "Material #" << number << endl;
     _strength->Write(os);
 
@@ -164,107 +300,87 @@ void MaterialFactory::Write(ofstream& os, int number)
 }
 
 void MaterialFactory::UpdateStress(PhysicalProperty* pp, SymTensor& delta_strain, SymTensor& delta_vortex,
-    MPM_FLOAT volume_old)
+    MPM_FLOAT volume_old, const SimulationContext& context)
 {
-    SymTensor sold = pp->GetDeviatoricStress();
-    MPM_FLOAT mean_stress_old = pp->GetMeanStress();
-    MPM_FLOAT delta_vol = delta_strain[0] + delta_strain[1] + delta_strain[2];
-    MPM_FLOAT volume = pp->GetVolume();
-    MPM_FLOAT delta_vol_half = 0.5*(volume - volume_old);
-    MPM_FLOAT volume_double = (volume + volume_old);
-    MPM_FLOAT delta_ie = 0.0;
-    map<string, MPM_FLOAT> data_transfer;
+    ProfileScope profile(_profile_material, 1);
+    SymTensor sold;
+    MPM_FLOAT mean_stress_old, delta_vol, delta_vol_half, volume_double, delta_ie;
+    DataTransfer data_transfer;
+    data_transfer.context = &context;
 
-    pp->StressRotationJaumann(delta_vortex);
+    _BeginStress(pp, delta_strain, delta_vortex, volume_old, sold, mean_stress_old, delta_vol, delta_vol_half,
+        volume_double);
 
     _strength->UpdateDeviatoricStress(pp, delta_strain, delta_vortex, data_transfer);
 
-    SoundSpeed(pp);
+    _SoundSpeed(_strength, _eos, pp, data_transfer);
 
-    ArtificialViscosity(pp, delta_vol);
+    ArtificialViscosity(pp, delta_vol, context);
     
     if (_eos)
     {
-        if (pp->is_Failed())
-        {
-            delta_ie = delta_vol_half*(mean_stress_old - pp->GetBulkViscosity()*2.0);
-            _eos->UpdatePressure(pp, delta_vol_half, delta_ie, data_transfer);
-            _strength->ModifyPressureByTemperature(pp);
-        }
-        else
-        {
-            SymTensor sd = pp->GetDeviatoricStress();
-            delta_ie = 0.25*(delta_strain[0]*(sold[0] + sd[0]) + 
-                             delta_strain[1]*(sold[1] + sd[1]) +
-                             delta_strain[2]*(sold[2] + sd[2]) +
-                             delta_strain[3]*(sold[3] + sd[3]) +
-                             delta_strain[4]*(sold[4] + sd[4]) +
-                             delta_strain[5]*(sold[5] + sd[5]))*volume_double;
-            delta_ie += delta_vol_half*(mean_stress_old - pp->GetBulkViscosity()*2.0);
-
-            _eos->UpdatePressure(pp, delta_vol_half, delta_ie, data_transfer);
-            _strength->ModifyPressureByTemperature(pp);
-
-            delta_ie += delta_vol_half*pp->GetMeanStress();
-        }
+        bool failed = pp->is_Failed();
+        delta_ie = _EnergyBeforePressure(pp, failed, delta_strain, sold, mean_stress_old, delta_vol_half,
+            volume_double);
+        _eos->UpdatePressure(pp, delta_vol_half, delta_ie, data_transfer);
+        _EnergyAfterPressure(_strength, pp, failed, delta_vol_half, delta_ie);
     }
     else
-    {
-        //!> Pressure has already been modified by temperature in "Strength_Isotropic::_ElasticPressure"
-        //!> May be moved here to be consistent with above procedure
-        _strength->ElasticPressure(pp, delta_vol, data_transfer);
-
-        SymTensor sd = pp->GetDeviatoricStress();
-        MPM_FLOAT mean_stress_part = mean_stress_old + pp->GetMeanStress() 
-            - pp->GetBulkViscosity()*2.0;
-        delta_ie = 0.25*(delta_strain[0]*(sold[0] + sd[0] + mean_stress_part) + 
-                         delta_strain[1]*(sold[1] + sd[1] + mean_stress_part) +
-                         delta_strain[2]*(sold[2] + sd[2] + mean_stress_part) +
-                         delta_strain[3]*(sold[3] + sd[3]) +
-                         delta_strain[4]*(sold[4] + sd[4]) +
-                         delta_strain[5]*(sold[5] + sd[5]))*volume_double;
-    }
+        delta_ie = _ElasticPressure(_strength, pp, delta_strain, sold, mean_stress_old, delta_vol, volume_double,
+            data_transfer);
 
     for (auto failure : _failure)
         failure->CheckFailure(pp, data_transfer);
-    if (pp->is_Failed())
+    _EndStress(_strength, pp, volume_old, delta_vol, delta_vol_half, mean_stress_old, delta_ie, data_transfer);
+}
+
+MPM_FLOAT MaterialFactory::UpdateStressBatch(ParticleStore& store, MPM_STATS begin, MPM_STATS end, 
+    SymTensor* delta_strain, SymTensor* delta_vortex, MPM_FLOAT* volume_old, const SimulationContext& context,
+    const MPM_FLOAT* speed)
+{
+    //!> Views of one chunk of particles for the model codes, all on stack
+    PhysicalProperty view[MPM::ParticleChunkSize];
+    MPM_FLOAT view_extra[MPM::ParticleChunkSize*MPM::ExtraParticlePropertySum];
+    for (MPM_STATS k = 0; k < MPM::ParticleChunkSize; k++)
+        view[k].BindExtraParticleProperty(view_extra + k*MPM::ExtraParticlePropertySum, 
+            store.GetExtraPropertyPositions());
+
+    MPM_FLOAT critical_dt = numeric_limits<MPM_FLOAT>::max();
+    for (MPM_STATS chunk_begin = begin; chunk_begin < end; chunk_begin += MPM::ParticleChunkSize)
     {
-        ResponseFailure(pp, volume_old);
-        delta_ie = delta_vol_half*(mean_stress_old + pp->GetMeanStress() - pp->GetBulkViscosity()*2.0);
-    }
+        MPM_STATS number = min(MPM::ParticleChunkSize, end - chunk_begin);
+        {
+            ProfileScope profile(_profile_gather, number);
+            for (MPM_STATS k = 0; k < number; k++)
+                store.Gather(chunk_begin + k, view + k);
+        }
 
-    pp->UpdateInternalEnergy(delta_ie);
+        MPM_FLOAT chunk_dt = UpdateStressBatch(view, delta_strain + chunk_begin, delta_vortex + chunk_begin, 
+            volume_old + chunk_begin, number, context, speed ? speed + chunk_begin : nullptr, 
+            store.GetCost() + chunk_begin);
+        critical_dt = min(critical_dt, chunk_dt);
 
-    _strength->UpdateTemperature(pp, delta_vol, data_transfer);
+        ProfileScope profile(_profile_gather);
+        for (MPM_STATS k = 0; k < number; k++)
+            store.Scatter(chunk_begin + k, view + k);
+    }
+    return critical_dt;
 }
 
-void MaterialFactory::SoundSpeed(PhysicalProperty* pp)
+void MaterialFactory::SoundSpeed(PhysicalProperty* pp, const SimulationContext& context)
 {
-    MPM_FLOAT sound_speed_square = _strength->SoundSpeedSquare_Strength(pp);
-    if (_eos)
-        sound_speed_square += _eos->SoundSpeedSquare_EOS(pp);
-    else   
-        sound_speed_square += _strength->SoundSpeedSquare_Elastic(pp);
-    
-    if (sound_speed_square <= -MPM_EPSILON)
-    {
-        cout << "*** Warning *** The sound speed is negative!" << endl;
-        cout << "Strength Type: " << _strength->GetName() << endl;
-        if (_eos)
-            cout << "EOS Type: " << _eos->GetName() << endl;
-        
-        pp->SetSoundSpeed(MPM_EPSILON);
-    }
-    else
-        pp->SetSoundSpeed(sqrt(sound_speed_square));
+    DataTransfer transfer;
+    transfer.context = &context;
+    _SoundSpeed(_strength, _eos, pp, transfer);
 }
 
-void MaterialFactory::ArtificialViscosity(PhysicalProperty* pp, MPM_FLOAT& delta_vol)
+void MaterialFactory::ArtificialViscosity(PhysicalProperty* pp, MPM_FLOAT& delta_vol, 
+    const SimulationContext& context)
 {
     MPM_FLOAT bulk_q = 0.0;
     if (pp->GetMeanStress() < -MPM_EPSILON)
     {
-        MPM_FLOAT dt = Solver_Base::GetDTn_I();
+        MPM_FLOAT dt = context.GetDTn_I();
         MPM_FLOAT volume_rate = delta_vol/dt;
         if (volume_rate < -MPM_EPSILON)
         {
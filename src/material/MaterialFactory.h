@@ -27,6 +27,11 @@
 #include "StrengthList.h"
 #include "EOSList.h"
 #include "FailureList.h"
+#include "../body/ParticleStore.h"
+#include "../solver/SimulationContext.h"
+#include <atomic>
+
+struct StressChunk;
 
 class MaterialFactory
 {
@@ -40,18 +45,129 @@ public:
                     vector<string>& failure_name_list, vector< map<string, MPM_FLOAT> >& failure_para_list,
                     map<string, MPM_FLOAT>& extra_para);
 
+    //!> Collect extra particle properties required by Strength, EOS and Failure models
+    bool AddExtraParticleProperty(vector<MPM::ExtraParticleProperty>& ExtraProp, DataTransfer& transfer);
+
     //!> Write material information to file
     void Write(ofstream& os, int number);
 
-    //!> Update stress of deviatoric and volumetric
+    //!> Update stress of deviatoric and volumetric of one particle by the virtual model calls
+    //!> Same results as "UpdateStressBatch" of one particle, without the scratch of a particle chunk
+    //!> "context" gives the time step and the current time of the simulation to the models, nothing else
+    //!>    is shared between updates, so that materials of different simulations can be updated in parallel
     void UpdateStress(PhysicalProperty* pp, SymTensor& delta_strain, SymTensor& delta_vortex,
-        MPM_FLOAT volume_old);
+        MPM_FLOAT volume_old, const SimulationContext& context);
+
+    //!> Update stress of a contiguous range of particles without any heap allocation
+    //!> delta_strain, delta_vortex and volume_old are arrays with the same length as pp
+    //!> The kernel composed for the current models is selected in "Initialize"
+    //!> Return the critical time step of the range, min(character_length/(c + |v|)) of the particles
+    //!>    not eroded with the limits of "LimitTimeStep". "speed" is |v| of the particles, nullptr for zero.
+    //!>    Ranges updated by different threads are reduced by min, see "SimulationContext::UpdateTimeStep"
+    //!> "cost" receives the estimated cost of the next update of each particle, see "GetParticleCost", and
+    //!>    the estimates are then smoothed by the measured time of the chunks. nullptr to skip both
+    inline MPM_FLOAT UpdateStressBatch(PhysicalProperty* pp, SymTensor* delta_strain, SymTensor* delta_vortex,
+        MPM_FLOAT* volume_old, MPM_STATS number, const SimulationContext& context, const MPM_FLOAT* speed = nullptr,
+        MPM_FLOAT* cost = nullptr)
+    {
+        return LimitTimeStep((this->*_stress_kernel)(pp, delta_strain, delta_vortex, volume_old, speed, cost,
+            number, context));
+    }
+
+    //!> Critical time step of the particles of this material, scaled by "TimeStepScale" and not larger
+    //!>    than "MaxTimeStep", e.g. for the reaction zone of explosives
+    inline MPM_FLOAT LimitTimeStep(MPM_FLOAT critical_dt) {return min(_time_step_scale*critical_dt, _max_time_step);}
+
+    //!> Update stress of particles [begin, end) in a structure-of-arrays store
+    //!> delta_strain, delta_vortex, volume_old and speed are indexed the same as the store
+    //!> Particle costs are written to "ParticleStore::GetCost"
+    MPM_FLOAT UpdateStressBatch(ParticleStore& store, MPM_STATS begin, MPM_STATS end, 
+        SymTensor* delta_strain, SymTensor* delta_vortex, MPM_FLOAT* volume_old, 
+        const SimulationContext& context, const MPM_FLOAT* speed = nullptr);
+
+    //!> Estimated nanoseconds of the stress update of a particle that did not yield (false) or yielded (true)
+    //!>    in its last update. Before the first measurement the estimates are relative costs by the models
+    inline MPM_FLOAT GetParticleCost(bool yield) {return _particle_cost[yield].load(memory_order_relaxed);}
 
     //!> Calculate sound speed
-    void SoundSpeed(PhysicalProperty* pp);
+    void SoundSpeed(PhysicalProperty* pp, const SimulationContext& context);
 protected:
+    //!> Stress update kernel of a range of particles
+    typedef MPM_FLOAT (MaterialFactory::*StressKernel)(PhysicalProperty* pp, SymTensor* delta_strain, 
+        SymTensor* delta_vortex, MPM_FLOAT* volume_old, const MPM_FLOAT* speed, MPM_FLOAT* cost, MPM_STATS number,
+        const SimulationContext& context);
+
+    //!> Kernels composed of Strength(S), EOS(E) and Failure(F) models, see "MaterialKernel.h"
+    //!> Calls are devirtualized when the model types are "FinalModel<Model>"
+    template<class S, class E, class F>
+    MPM_FLOAT _UpdateStressKernel(PhysicalProperty* pp, SymTensor* delta_strain, SymTensor* delta_vortex,
+        MPM_FLOAT* volume_old, const MPM_FLOAT* speed, MPM_FLOAT* cost, MPM_STATS number, 
+        const SimulationContext& context);
+
+    //!> Particles are updated in chunks of "MPM::ParticleChunkSize", EOS by batch kernels if available
+    //!> Return the critical time step of the chunk
+    template<class S, class E, class F>
+    MPM_FLOAT _UpdateStressChunk(S* strength, E* eos, PhysicalProperty* pp, SymTensor* delta_strain,
+        SymTensor* delta_vortex, MPM_FLOAT* volume_old, const MPM_FLOAT* speed, MPM_STATS number, 
+        const SimulationContext& context, StressChunk& chunk);
+
+    template<class S, class E>
+    void _SoundSpeed(S* strength, E* eos, PhysicalProperty* pp, DataTransfer& transfer);
+
+    template<class S, class E>
+    void _SetSoundSpeed(S* strength, E* eos, PhysicalProperty* pp, MPM_FLOAT sound_speed_square);
+
+    //!> Check the failure of a chunk, by the batch kernel of the failure model if available
+    template<class F>
+    void _CheckFailure(PhysicalProperty* pp, DataTransfer* data_transfer, MPM_STATS number);
+
+    //!> Phases of the stress update of one particle, shared by "UpdateStress" and "_UpdateStressChunk"
+    //!> State before the update, then the Jaumann rotation of the deviatoric stress
+    void _BeginStress(PhysicalProperty* pp, const SymTensor& delta_strain, SymTensor& delta_vortex,
+        MPM_FLOAT volume_old, SymTensor& stress_old, MPM_FLOAT& mean_stress_old, MPM_FLOAT& delta_vol,
+        MPM_FLOAT& delta_vol_half, MPM_FLOAT& volume_double);
+
+    //!> Internal energy increment passed to the EOS, "failed" is the failure state at the pressure update
+    MPM_FLOAT _EnergyBeforePressure(PhysicalProperty* pp, bool failed, const SymTensor& delta_strain,
+        const SymTensor& stress_old, MPM_FLOAT mean_stress_old, MPM_FLOAT delta_vol_half, MPM_FLOAT volume_double);
+
+    //!> Temperature correction of the EOS pressure, and the work of the new pressure if not failed
+    template<class S>
+    void _EnergyAfterPressure(S* strength, PhysicalProperty* pp, bool failed, MPM_FLOAT delta_vol_half,
+        MPM_FLOAT& delta_ie);
+
+    //!> Pressure of the strength model without EOS, return the internal energy increment
+    template<class S>
+    MPM_FLOAT _ElasticPressure(S* strength, PhysicalProperty* pp, const SymTensor& delta_strain,
+        const SymTensor& stress_old, MPM_FLOAT mean_stress_old, MPM_FLOAT delta_vol, MPM_FLOAT volume_double,
+        DataTransfer& transfer);
+
+    //!> After the failure check: failure response, internal energy and temperature
+    template<class S>
+    void _EndStress(S* strength, PhysicalProperty* pp, MPM_FLOAT volume_old, MPM_FLOAT delta_vol,
+        MPM_FLOAT delta_vol_half, MPM_FLOAT mean_stress_old, MPM_FLOAT delta_ie, DataTransfer& transfer);
+
+    //!> Select the kernel according to the model types, virtual kernel for other combinations
+    StressKernel _SelectKernel();
+
+    //!> Smooth the particle costs by the time of a chunk of "number" particles, "yielded" of them yielded
+    //!> Chunks of one kind update the cost of that kind, mixed chunks scale both costs
+    void _UpdateParticleCost(uint64_t time_ns, MPM_STATS number, MPM_STATS yielded);
+
+    //!> Register profiler entries named by the model names of the input
+    void _RegisterProfile(string& strength_name, string& eos_name, vector<string>& failure_name_list);
+
+    template<class S, class E>
+    StressKernel _SelectKernel_Failure();
+
+    template<class S>
+    StressKernel _SelectKernel_SolidEOS();
+
+    template<class S>
+    StressKernel _SelectKernel_FluidEOS();
+
     //!> Deal with artificial viscosity
-    void ArtificialViscosity(PhysicalProperty* pp, MPM_FLOAT& delta_vol);
+    void ArtificialViscosity(PhysicalProperty* pp, MPM_FLOAT& delta_vol, const SimulationContext& context);
 
     //!> Stress Response when particle failed
     void ResponseFailure(PhysicalProperty* pp, MPM_FLOAT volume_old);
@@ -61,10 +177,30 @@ protected:
     //!> There could be various failure model
     vector<Failure_Base*>   _failure;
 
+    StressKernel _stress_kernel;
+
+    //!> Profiler entries, see "Profiler"
+    int _profile_material;      //!< "Material", all stress updates
+    int _profile_model;         //!< "Material/<Strength>+<EOS>"
+    int _profile_strength;      //!< "Strength/<Strength>", deviatoric stress
+    int _profile_sound_speed;   //!< "SoundSpeed/<Strength>+<EOS>", with artificial viscosity
+    int _profile_pressure;      //!< "Pressure/<EOS>", "Pressure/<Strength>" without EOS
+    int _profile_failure;       //!< "Failure/<Failure>+...", failure check and internal energy
+    int _profile_gather;        //!< "ParticleStore/GatherScatter", copy between ParticleStore and views
+    int _profile_output;        //!< "Output/Material"
+
     MPM_FLOAT _reference_density;
     MPM_FLOAT _bq1, _bq2;   //!< Artificial viscosity
     MPM_FLOAT _fail_response_type;
     MPM_FLOAT _tensile_cutoff;
+    MPM_FLOAT _fast_math;   //!< 1 to use polynomial approximations of pow/log/exp in the models
+    MPM_FLOAT _time_step_scale; //!< scale of the critical time step of this material, in (0, 1]
+    MPM_FLOAT _max_time_step;   //!< upper bound of the critical time step of this material
+    MPM_FLOAT _cost_smoothing;  //!< weight of a new measurement of the particle cost, in (0, 1]
+
+    //!> Particle costs of "GetParticleCost", updated by all threads updating this material
+    atomic<MPM_FLOAT> _particle_cost[2];
+    atomic<bool> _cost_measured;
 
     map<string, MPM_FLOAT*> ParameterMap_Material;
 
@@ -0,0 +1,519 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Stress update kernels of MaterialFactory composed of
+        Strength, EOS and Failure models at compile time.
+        Models are created as "FinalModel<Model>", so calls on
+        a pointer of that type are resolved without virtual
+        dispatch and can be inlined. A kernel instantiated with
+        the base classes is the virtual fallback.
+        This file should only be included by MaterialFactory.cpp
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _MATERIALKERNEL_H_
+#define _MATERIALKERNEL_H_
+
+#include "MaterialFactory.h"
+#include "../utility/AlignedMemory.h"
+#include "../utility/Profiler.h"
+
+//!> Sealed model type, the exact type of every model created by MaterialFactory
+template<class Model>
+class FinalModel final: public Model
+{
+};
+
+//!> Whether the model pointer is created as "FinalModel<Model>"
+template<class Model, class Base>
+inline bool IsFinalModel(Base* model)
+{
+    return dynamic_cast<FinalModel<Model>*>(model) != nullptr;
+}
+
+//!> Intermediate data of a chunk of particles during stress update
+//!> The update runs in phases over the chunk, so that EOS can be evaluated by batch kernels
+struct StressChunk
+{
+    DataTransfer transfer[MPM::ParticleChunkSize];
+    SymTensor stress_old[MPM::ParticleChunkSize];
+    MPM_FLOAT mean_stress_old[MPM::ParticleChunkSize];
+    MPM_FLOAT delta_vol[MPM::ParticleChunkSize];
+    MPM_FLOAT delta_vol_half[MPM::ParticleChunkSize];
+    MPM_FLOAT volume_double[MPM::ParticleChunkSize];
+    MPM_FLOAT sound_speed_square[MPM::ParticleChunkSize];
+    bool failed[MPM::ParticleChunkSize];        //!< failure state when pressure is updated
+
+    //!> Packed arrays of "eos_batch"
+    alignas(MPM::MemoryAlignment) MPM_FLOAT mass[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT volume[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT density[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT internal_energy[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT light_time[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT delta_ie[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT mean_stress[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT eos_sound_speed_square[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) bool failure[MPM::ParticleChunkSize];
+    EOS_Batch eos_batch;
+
+    //!> Packed arrays of "strength_batch", "failure" and "mean_stress" are shared with "eos_batch"
+    alignas(MPM::MemoryAlignment) MPM_FLOAT strain[6][MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT stress[6][MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT equivalent_stress[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT bulk_viscosity[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT epeff[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT sigma_y[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT kelvin[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT damage[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) bool yield[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT depeff[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT lsrate[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT tstar[MPM::ParticleChunkSize];
+    Strength_Batch strength_batch;
+
+    //!> Pack the particle data used by EOS models
+    inline void PackEOSBatch(PhysicalProperty* pp, MPM_STATS number)
+    {
+        bool has_light_time = pp[0].HasExtraParticleProperty(MPM::LT);
+        for (MPM_STATS i = 0; i < number; i++)
+        {
+            mass[i] = pp[i].GetMass();
+            volume[i] = pp[i].GetVolume();
+            density[i] = pp[i].GetDensity();
+            internal_energy[i] = pp[i].GetInternalEnergy();
+            mean_stress[i] = pp[i].GetMeanStress();
+            failure[i] = pp[i].is_Failed();
+            if (has_light_time)
+                light_time[i] = pp[i][MPM::LT];
+        }
+
+        eos_batch.number = number;
+        eos_batch.mass = mass;
+        eos_batch.volume = volume;
+        eos_batch.density = density;
+        eos_batch.internal_energy = internal_energy;
+        eos_batch.light_time = has_light_time ? light_time : nullptr;
+        eos_batch.failure = failure;
+        eos_batch.delta_vol_half = delta_vol_half;
+        eos_batch.delta_ie = delta_ie;
+        eos_batch.mean_stress = mean_stress;
+        eos_batch.sound_speed_square = eos_sound_speed_square;
+    }
+
+    //!> Pack the particle data used by strength models, after the stress rotation
+    inline void PackStrengthBatch(PhysicalProperty* pp, SymTensor* delta_strain, MPM_STATS number)
+    {
+        bool has_epeff = pp[0].HasExtraParticleProperty(MPM::epeff);
+        bool has_sigma_y = pp[0].HasExtraParticleProperty(MPM::sigma_y);
+        bool has_kelvin = pp[0].HasExtraParticleProperty(MPM::kelvin);
+        bool has_damage = pp[0].HasExtraParticleProperty(MPM::DMG);
+        for (MPM_STATS i = 0; i < number; i++)
+        {
+            SymTensor sd = pp[i].GetDeviatoricStress();
+            for (int k = 0; k < 6; k++)
+            {
+                strain[k][i] = delta_strain[i][k];
+                stress[k][i] = sd[k];
+            }
+            equivalent_stress[i] = pp[i].GetEquivalentStress();
+            mean_stress[i] = pp[i].GetMeanStress();
+            bulk_viscosity[i] = pp[i].GetBulkViscosity();
+            failure[i] = pp[i].is_Failed();
+            if (has_epeff)
+                epeff[i] = pp[i][MPM::epeff];
+            if (has_sigma_y)
+                sigma_y[i] = pp[i][MPM::sigma_y];
+            if (has_kelvin)
+                kelvin[i] = pp[i][MPM::kelvin];
+            if (has_damage)
+                damage[i] = pp[i][MPM::DMG];
+            
+            yield[i] = false;
+            depeff[i] = 0.0;
+            lsrate[i] = 0.0;
+            tstar[i] = 0.0;
+        }
+
+        strength_batch.number = number;
+        for (int k = 0; k < 6; k++)
+        {
+            strength_batch.delta_strain[k] = strain[k];
+            strength_batch.deviatoric_stress[k] = stress[k];
+        }
+        strength_batch.equivalent_stress = equivalent_stress;
+        strength_batch.mean_stress = mean_stress;
+        strength_batch.bulk_viscosity = bulk_viscosity;
+        strength_batch.failure = failure;
+        strength_batch.epeff = has_epeff ? epeff : nullptr;
+        strength_batch.sigma_y = has_sigma_y ? sigma_y : nullptr;
+        strength_batch.kelvin = has_kelvin ? kelvin : nullptr;
+        strength_batch.damage = has_damage ? damage : nullptr;
+        strength_batch.yield = yield;
+        strength_batch.depeff = depeff;
+        strength_batch.lsrate = lsrate;
+        strength_batch.tstar = tstar;
+    }
+
+    //!> Write the results of strength models back to the particles and "transfer"
+    inline void UnpackStrengthBatch(PhysicalProperty* pp, MPM_STATS number)
+    {
+        for (MPM_STATS i = 0; i < number; i++)
+        {
+            SymTensor sd;
+            for (int k = 0; k < 6; k++)
+                sd[k] = stress[k][i];
+            pp[i].SetDeviatoricStress(sd);
+            pp[i].SetEquivalentStress(equivalent_stress[i]);
+            if (failure[i])
+                pp[i].Failed();
+            if (strength_batch.epeff)
+                pp[i][MPM::epeff] = epeff[i];
+            if (strength_batch.sigma_y)
+                pp[i][MPM::sigma_y] = sigma_y[i];
+            
+            transfer[i].yield = yield[i];
+            transfer[i].depeff = depeff[i];
+            transfer[i].lsrate = lsrate[i];
+            transfer[i].tstar = tstar[i];
+        }
+    }
+};
+
+template<class S, class E, class F>
+MPM_FLOAT MaterialFactory::_UpdateStressKernel(PhysicalProperty* pp, SymTensor* delta_strain, SymTensor* delta_vortex,
+    MPM_FLOAT* volume_old, const MPM_FLOAT* speed, MPM_FLOAT* cost, MPM_STATS number, 
+    const SimulationContext& context)
+{
+    //!> Estimated bytes: particles and extra properties read and written, strain, vortex and volume read
+    uint64_t bytes = (uint64_t)number*(2*(sizeof(PhysicalProperty) + MPM::ExtraParticlePropertySum*sizeof(MPM_FLOAT))
+        + 2*sizeof(SymTensor) + sizeof(MPM_FLOAT));
+    ProfileScope profile_material(_profile_material, number, bytes);
+    ProfileScope profile_model(_profile_model, number);
+
+    S* strength = static_cast<S*>(_strength);
+    E* eos = static_cast<E*>(_eos);
+    StressChunk chunk;
+    for (MPM_STATS i = 0; i < MPM::ParticleChunkSize; i++)
+        chunk.transfer[i].context = &context;
+    chunk.eos_batch.context = &context;
+    chunk.strength_batch.context = &context;
+
+    MPM_FLOAT critical_dt = numeric_limits<MPM_FLOAT>::max();
+    for (MPM_STATS begin = 0; begin < number; begin += MPM::ParticleChunkSize)
+    {
+        MPM_STATS chunk_number = min(MPM::ParticleChunkSize, number - begin);
+        uint64_t start_ns = cost ? Profiler::Now() : 0;
+        MPM_FLOAT chunk_dt = _UpdateStressChunk<S, E, F>(strength, eos, pp + begin, delta_strain + begin, 
+            delta_vortex + begin, volume_old + begin, speed ? speed + begin : nullptr, chunk_number, context, chunk);
+        critical_dt = min(critical_dt, chunk_dt);
+
+        //!> Cost of the next update by whether the particle yielded in this one
+        if (cost)
+        {
+            MPM_STATS yielded = 0;
+            for (MPM_STATS i = 0; i < chunk_number; i++)
+                yielded += chunk.transfer[i].yield ? 1 : 0;
+            _UpdateParticleCost(Profiler::Now() - start_ns, chunk_number, yielded);
+            for (MPM_STATS i = 0; i < chunk_number; i++)
+                cost[begin + i] = GetParticleCost(chunk.transfer[i].yield);
+        }
+    }
+    return critical_dt;
+}
+
+template<class S, class E, class F>
+MPM_FLOAT MaterialFactory::_UpdateStressChunk(S* strength, E* eos, PhysicalProperty* pp, SymTensor* delta_strain,
+    SymTensor* delta_vortex, MPM_FLOAT* volume_old, const MPM_FLOAT* speed, MPM_STATS number, 
+    const SimulationContext& context, StressChunk& chunk)
+{
+    //!> Deviatoric stress
+    ProfileScope profile(_profile_strength, number);
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        chunk.transfer[i].Reset();
+        _BeginStress(pp + i, delta_strain[i], delta_vortex[i], volume_old[i], chunk.stress_old[i],
+            chunk.mean_stress_old[i], chunk.delta_vol[i], chunk.delta_vol_half[i], chunk.volume_double[i]);
+    }
+
+    if (strength->HasBatchKernel())
+    {
+        chunk.PackStrengthBatch(pp, delta_strain, number);
+        strength->UpdateDeviatoricStressBatch(chunk.strength_batch);
+        chunk.UnpackStrengthBatch(pp, number);
+    }
+    else
+    {
+        for (MPM_STATS i = 0; i < number; i++)
+            strength->UpdateDeviatoricStress(pp + i, delta_strain[i], delta_vortex[i], chunk.transfer[i]);
+    }
+
+    //!> Sound speed and artificial viscosity
+    profile.Next(_profile_sound_speed, number);
+    for (MPM_STATS i = 0; i < number; i++)
+        chunk.sound_speed_square[i] = strength->SoundSpeedSquare_Strength(pp + i);
+
+    if (eos)
+    {
+        chunk.PackEOSBatch(pp, number);
+        if (!eos->SoundSpeedSquareBatch_EOS(chunk.eos_batch))
+            for (MPM_STATS i = 0; i < number; i++)
+                chunk.eos_sound_speed_square[i] = eos->SoundSpeedSquare_EOS(pp + i, chunk.transfer[i]);
+        
+        for (MPM_STATS i = 0; i < number; i++)
+            chunk.sound_speed_square[i] += chunk.eos_sound_speed_square[i];
+    }
+    else
+    {
+        for (MPM_STATS i = 0; i < number; i++)
+            chunk.sound_speed_square[i] += strength->SoundSpeedSquare_Elastic(pp + i);
+    }
+
+    //!> Critical time step with the sound speed modified by artificial viscosity, so that
+    //!>    the solver does not need another loop over particles
+    MPM_FLOAT critical_dt = numeric_limits<MPM_FLOAT>::max();
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        _SetSoundSpeed(strength, eos, pp + i, chunk.sound_speed_square[i]);
+        ArtificialViscosity(pp + i, chunk.delta_vol[i], context);
+
+        if (!pp[i].is_Eroded())
+        {
+            MPM_FLOAT character_length = cbrt(pp[i].GetVolume());
+            MPM_FLOAT velocity = speed ? speed[i] : 0.0;
+            critical_dt = min(critical_dt, character_length/(pp[i].GetSoundSpeed() + velocity));
+        }
+    }
+
+    //!> Pressure
+    profile.Next(_profile_pressure, number);
+    if (eos)
+    {
+        for (MPM_STATS i = 0; i < number; i++)
+        {
+            chunk.failed[i] = pp[i].is_Failed();
+            chunk.delta_ie[i] = _EnergyBeforePressure(pp + i, chunk.failed[i], delta_strain[i], chunk.stress_old[i],
+                chunk.mean_stress_old[i], chunk.delta_vol_half[i], chunk.volume_double[i]);
+        }
+
+        if (eos->UpdatePressureBatch(chunk.eos_batch))
+        {
+            for (MPM_STATS i = 0; i < number; i++)
+                pp[i].SetMeanStress(chunk.mean_stress[i]);
+        }
+        else
+        {
+            for (MPM_STATS i = 0; i < number; i++)
+                eos->UpdatePressure(pp + i, chunk.delta_vol_half[i], chunk.delta_ie[i], chunk.transfer[i]);
+        }
+
+        for (MPM_STATS i = 0; i < number; i++)
+            _EnergyAfterPressure(strength, pp + i, chunk.failed[i], chunk.delta_vol_half[i], chunk.delta_ie[i]);
+    }
+    else
+    {
+        for (MPM_STATS i = 0; i < number; i++)
+            chunk.delta_ie[i] = _ElasticPressure(strength, pp + i, delta_strain[i], chunk.stress_old[i],
+                chunk.mean_stress_old[i], chunk.delta_vol[i], chunk.volume_double[i], chunk.transfer[i]);
+    }
+
+    //!> Failure, internal energy and temperature
+    profile.Next(_profile_failure, number);
+    _CheckFailure<F>(pp, chunk.transfer, number);
+    for (MPM_STATS i = 0; i < number; i++)
+        _EndStress(strength, pp + i, volume_old[i], chunk.delta_vol[i], chunk.delta_vol_half[i],
+            chunk.mean_stress_old[i], chunk.delta_ie[i], chunk.transfer[i]);
+
+    return critical_dt;
+}
+
+inline void MaterialFactory::_BeginStress(PhysicalProperty* pp, const SymTensor& delta_strain, SymTensor& delta_vortex,
+    MPM_FLOAT volume_old, SymTensor& stress_old, MPM_FLOAT& mean_stress_old, MPM_FLOAT& delta_vol,
+    MPM_FLOAT& delta_vol_half, MPM_FLOAT& volume_double)
+{
+    stress_old = pp->GetDeviatoricStress();
+    mean_stress_old = pp->GetMeanStress();
+    delta_vol = delta_strain[0] + delta_strain[1] + delta_strain[2];
+    MPM_FLOAT volume = pp->GetVolume();
+    delta_vol_half = 0.5*(volume - volume_old);
+    volume_double = (volume + volume_old);
+
+    pp->StressRotationJaumann(delta_vortex);
+}
+
+inline MPM_FLOAT MaterialFactory::_EnergyBeforePressure(PhysicalProperty* pp, bool failed, 
+    const SymTensor& delta_strain, const SymTensor& stress_old, MPM_FLOAT mean_stress_old, MPM_FLOAT delta_vol_half,
+    MPM_FLOAT volume_double)
+{
+    if (failed)
+        return delta_vol_half*(mean_stress_old - pp->GetBulkViscosity()*2.0);
+
+    const SymTensor& de = delta_strain;
+    const SymTensor& sold = stress_old;
+    SymTensor sd = pp->GetDeviatoricStress();
+    MPM_FLOAT delta_ie = 0.25*(de[0]*(sold[0] + sd[0]) + 
+                               de[1]*(sold[1] + sd[1]) +
+                               de[2]*(sold[2] + sd[2]) +
+                               de[3]*(sold[3] + sd[3]) +
+                               de[4]*(sold[4] + sd[4]) +
+                               de[5]*(sold[5] + sd[5]))*volume_double;
+    delta_ie += delta_vol_half*(mean_stress_old - pp->GetBulkViscosity()*2.0);
+    return delta_ie;
+}
+
+template<class S>
+inline void MaterialFactory::_EnergyAfterPressure(S* strength, PhysicalProperty* pp, bool failed, 
+    MPM_FLOAT delta_vol_half, MPM_FLOAT& delta_ie)
+{
+    strength->ModifyPressureByTemperature(pp);
+    if (!failed)
+        delta_ie += delta_vol_half*pp->GetMeanStress();
+}
+
+template<class S>
+inline MPM_FLOAT MaterialFactory::_ElasticPressure(S* strength, PhysicalProperty* pp, const SymTensor& delta_strain,
+    const SymTensor& stress_old, MPM_FLOAT mean_stress_old, MPM_FLOAT delta_vol, MPM_FLOAT volume_double,
+    DataTransfer& transfer)
+{
+    //!> Pressure has already been modified by temperature in "Strength_Isotropic::_ElasticPressure"
+    //!> May be moved here to be consistent with above procedure
+    strength->ElasticPressure(pp, delta_vol, transfer);
+
+    const SymTensor& de = delta_strain;
+    const SymTensor& sold = stress_old;
+    SymTensor sd = pp->GetDeviatoricStress();
+    MPM_FLOAT mean_stress_part = mean_stress_old + pp->GetMeanStress() - pp->GetBulkViscosity()*2.0;
+    return 0.25*(de[0]*(sold[0] + sd[0] + mean_stress_part) + 
+                 de[1]*(sold[1] + sd[1] + mean_stress_part) +
+                 de[2]*(sold[2] + sd[2] + mean_stress_part) +
+                 de[3]*(sold[3] + sd[3]) +
+                 de[4]*(sold[4] + sd[4]) +
+                 de[5]*(sold[5] + sd[5]))*volume_double;
+}
+
+template<class S>
+inline void MaterialFactory::_EndStress(S* strength, PhysicalProperty* pp, MPM_FLOAT volume_old, MPM_FLOAT delta_vol,
+    MPM_FLOAT delta_vol_half, MPM_FLOAT mean_stress_old, MPM_FLOAT delta_ie, DataTransfer& transfer)
+{
+    if (pp->is_Failed())
+    {
+        ResponseFailure(pp, volume_old);
+        delta_ie = delta_vol_half*(mean_stress_old + pp->GetMeanStress() - pp->GetBulkViscosity()*2.0);
+    }
+
+    pp->UpdateInternalEnergy(delta_ie);
+
+    strength->UpdateTemperature(pp, delta_vol, transfer);
+}
+
+template<class S, class E>
+inline void MaterialFactory::_SoundSpeed(S* strength, E* eos, PhysicalProperty* pp, DataTransfer& transfer)
+{
+    MPM_FLOAT sound_speed_square = strength->SoundSpeedSquare_Strength(pp);
+    if (eos)
+        sound_speed_square += eos->SoundSpeedSquare_EOS(pp, transfer);
+    else   
+        sound_speed_square += strength->SoundSpeedSquare_Elastic(pp);
+    
+    _SetSoundSpeed(strength, eos, pp, sound_speed_square);
+}
+
+template<class S, class E>
+inline void MaterialFactory::_SetSoundSpeed(S* strength, E* eos, PhysicalProperty* pp, MPM_FLOAT sound_speed_square)
+{
+    if (sound_speed_square <= -MPM_EPSILON)
+    {
+        cout << "*** Warning *** The sound speed is negative!" << endl;
+        cout << "Strength Type: " << strength->GetName() << endl;
+        if (eos)
+            cout << "EOS Type: " << eos->GetName() << endl;
+        
+        pp->SetSoundSpeed(MPM_EPSILON);
+    }
+    else
+        pp->SetSoundSpeed(sqrt(sound_speed_square));
+}
+
+//!> Kernel with one known failure model
+template<class F>
+inline void MaterialFactory::_CheckFailure(PhysicalProperty* pp, DataTransfer* data_transfer, MPM_STATS number)
+{
+    F* failure = static_cast<F*>(_failure[0]);
+    if (failure->HasBatchKernel())
+        failure->CheckFailureBatch(pp, data_transfer, number);
+    else
+    {
+        for (MPM_STATS i = 0; i < number; i++)
+            failure->CheckFailure(pp + i, data_transfer[i]);
+    }
+}
+
+//!> Kernel without failure model or with several failure models
+template<>
+inline void MaterialFactory::_CheckFailure<Failure_Base>(PhysicalProperty* pp, DataTransfer* data_transfer, 
+    MPM_STATS number)
+{
+    for (auto failure : _failure)
+        failure->CheckFailureBatch(pp, data_transfer, number);
+}
+
+template<class S, class E>
+MaterialFactory::StressKernel MaterialFactory::_SelectKernel_Failure()
+{
+    if (_failure.size() == 1)
+    {
+        if (IsFinalModel<Failure_PlaStrain>(_failure[0]))
+            return &MaterialFactory::_UpdateStressKernel<S, E, FinalModel<Failure_PlaStrain> >;
+        if (IsFinalModel<Failure_PriStrain>(_failure[0]))
+            return &MaterialFactory::_UpdateStressKernel<S, E, FinalModel<Failure_PriStrain> >;
+        if (IsFinalModel<Failure_PriStress>(_failure[0]))
+            return &MaterialFactory::_UpdateStressKernel<S, E, FinalModel<Failure_PriStress> >;
+        if (IsFinalModel<Failure_Damage_JohnsonCook>(_failure[0]))
+            return &MaterialFactory::_UpdateStressKernel<S, E, FinalModel<Failure_Damage_JohnsonCook> >;
+    }
+    return &MaterialFactory::_UpdateStressKernel<S, E, Failure_Base>;
+}
+
+template<class S>
+MaterialFactory::StressKernel MaterialFactory::_SelectKernel_SolidEOS()
+{
+    if (!_eos)
+        return _SelectKernel_Failure<S, EOS_Base>();    //!< "eos" is always nullptr in kernel
+    if (IsFinalModel<EOS_Polynomial>(_eos))
+        return _SelectKernel_Failure<S, FinalModel<EOS_Polynomial> >();
+    if (IsFinalModel<EOS_Gruneisen>(_eos))
+        return _SelectKernel_Failure<S, FinalModel<EOS_Gruneisen> >();
+    if (IsFinalModel<EOS_SimpleGruneisen>(_eos))
+        return _SelectKernel_Failure<S, FinalModel<EOS_SimpleGruneisen> >();
+    return nullptr;
+}
+
+template<class S>
+MaterialFactory::StressKernel MaterialFactory::_SelectKernel_FluidEOS()
+{
+    if (IsFinalModel<EOS_Polynomial>(_eos))
+        return &MaterialFactory::_UpdateStressKernel<S, FinalModel<EOS_Polynomial>, Failure_Base>;
+    if (IsFinalModel<EOS_Gruneisen>(_eos))
+        return &MaterialFactory::_UpdateStressKernel<S, FinalModel<EOS_Gruneisen>, Failure_Base>;
+    if (IsFinalModel<EOS_SimpleGruneisen>(_eos))
+        return &MaterialFactory::_UpdateStressKernel<S, FinalModel<EOS_SimpleGruneisen>, Failure_Base>;
+    if (IsFinalModel<EOS_JWL>(_eos))
+        return &MaterialFactory::_UpdateStressKernel<S, FinalModel<EOS_JWL>, Failure_Base>;
+    if (IsFinalModel<EOS_HighExpBurn>(_eos))
+        return &MaterialFactory::_UpdateStressKernel<S, FinalModel<EOS_HighExpBurn>, Failure_Base>;
+    return nullptr;
+}
+
+#endif
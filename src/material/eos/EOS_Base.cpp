@@ -53,8 +53,18 @@ bool EOS_Base::Initialize(map<string, MPM_FLOAT> &eos_para, MPM_FLOAT rho0)
     return true;
 }
 
+bool EOS_Base::UpdatePressureBatch(EOS_Batch& batch)
+{
+    return false;
+}
+
+bool EOS_Base::SoundSpeedSquareBatch_EOS(EOS_Batch& batch)
+{
+    return false;
+}
+
 bool EOS_Base::AddExtraParticleProperty_EOS(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer)
+        DataTransfer& transfer)
 {
     // Nothing needs to be added
     return true;
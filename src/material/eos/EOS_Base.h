@@ -23,11 +23,30 @@
 
 #include "../../main/MPM3D_MACRO.h"
 #include "../../body/PhysicalProperty.h"
+#include "../DataTransfer.h"
+
+//!> Particle data packed into arrays for the batch EOS kernels, each array has "number" entries
+struct EOS_Batch
+{
+    MPM_STATS number;
+    const MPM_FLOAT* mass;
+    const MPM_FLOAT* volume;
+    const MPM_FLOAT* density;
+    const MPM_FLOAT* internal_energy;
+    const MPM_FLOAT* light_time;        //!< nullptr if "MPM::LT" is not an extra particle property
+    const bool* failure;
+    const MPM_FLOAT* delta_vol_half;    //!< input of "UpdatePressureBatch"
+    const MPM_FLOAT* delta_ie;          //!< input of "UpdatePressureBatch"
+    MPM_FLOAT* mean_stress;             //!< input of "SoundSpeedSquareBatch_EOS", output of "UpdatePressureBatch"
+    MPM_FLOAT* sound_speed_square;      //!< output of "SoundSpeedSquareBatch_EOS"
+    const SimulationContext* context;   //!< time steps and current time of the simulation
+};
+
 class EOS_Base
 {
 public:
     EOS_Base();
-    ~EOS_Base();
+    virtual ~EOS_Base();
 
     inline string GetName() {return Type;}
 
@@ -39,14 +58,19 @@ public:
 
     //!> Update the pressure of the particle
     virtual void UpdatePressure(PhysicalProperty* pp, MPM_FLOAT delta_vol_half, 
-        MPM_FLOAT delta_ie, map<string, MPM_FLOAT>& transfer) = 0;
+        MPM_FLOAT delta_ie, DataTransfer& transfer) = 0;
 
     //!> Calculate the squared adabatic sound speed of EOS part
-    virtual MPM_FLOAT SoundSpeedSquare_EOS(PhysicalProperty* pp) = 0;
+    virtual MPM_FLOAT SoundSpeedSquare_EOS(PhysicalProperty* pp, DataTransfer& transfer) = 0;
+
+    //!> Vectorized versions of "UpdatePressure" and "SoundSpeedSquare_EOS" on packed arrays
+    //!> Return false if the model has no batch kernel, then the particle versions should be used
+    virtual bool UpdatePressureBatch(EOS_Batch& batch);
+    virtual bool SoundSpeedSquareBatch_EOS(EOS_Batch& batch);
 
     //!> Add extra particle properties based on different failure model
     virtual bool AddExtraParticleProperty_EOS(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer);
+        DataTransfer& transfer);
 protected:
     string Type;
     MPM_FLOAT _density_0;           //!< initial density
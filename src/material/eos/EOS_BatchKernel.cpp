@@ -0,0 +1,346 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of vectorized EOS kernels. Formulas
+        follow the particle versions in "EOS_*.cpp" line by line
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "EOS_BatchKernel.h"
+#include "../../utility/MathFunctionList.h"
+
+//!> Pressure of Jones-Wilkins-Lee EOS, same as "EOS_JWL::UpdatePressure"
+static inline MPM_FLOAT JWL_Pressure(MPM_FLOAT mass, MPM_FLOAT density, MPM_FLOAT internal_energy,
+    MPM_FLOAT delta_ie, MPM_FLOAT delta_vol_half, MPM_FLOAT rho0, 
+    MPM_FLOAT A, MPM_FLOAT B, MPM_FLOAT R1, MPM_FLOAT R2, MPM_FLOAT w)
+{
+    MPM_FLOAT V0 = mass/rho0;
+    MPM_FLOAT E = (internal_energy + delta_ie)/V0;
+    MPM_FLOAT rv = rho0/density;
+
+    MPM_FLOAT R1rv = R1*rv;
+    MPM_FLOAT R2rv = R2*rv;
+    MPM_FLOAT Aw_R1rv = A*w/R1rv;
+    MPM_FLOAT Bw_R2rv = B*w/R2rv;
+    MPM_FLOAT exp_R1rv = VectorExp(-R1rv);
+    MPM_FLOAT exp_R2rv = VectorExp(-R2rv);
+
+    MPM_FLOAT A_ = (A - Aw_R1rv)*exp_R1rv + (B - Bw_R2rv)*exp_R2rv;
+    MPM_FLOAT B_ = w/rv;
+
+    MPM_FLOAT pressure = (A_ + B_*E)/(1 + B_*delta_vol_half/V0);
+    return pressure < MPM_EPSILON ? 0.0 : pressure;
+}
+
+//!> Squared sound speed of Jones-Wilkins-Lee EOS, same as "EOS_JWL::SoundSpeedSquare_EOS"
+static inline MPM_FLOAT JWL_SoundSpeedSquare(MPM_FLOAT mass, MPM_FLOAT density, MPM_FLOAT internal_energy,
+    MPM_FLOAT mean_stress, MPM_FLOAT rho0, MPM_FLOAT A, MPM_FLOAT B, MPM_FLOAT R1, MPM_FLOAT R2, MPM_FLOAT w)
+{
+    MPM_FLOAT rv = rho0/density;
+    MPM_FLOAT E = internal_energy*rho0/mass;
+
+    MPM_FLOAT R1rv = R1*rv;
+    MPM_FLOAT R2rv = R2*rv;
+    MPM_FLOAT Aw_R1rv = A*w/R1rv;
+    MPM_FLOAT Bw_R2rv = B*w/R2rv;
+    MPM_FLOAT exp_R1rv = VectorExp(-R1rv);
+    MPM_FLOAT exp_R2rv = VectorExp(-R2rv);
+
+    MPM_FLOAT ca = (R1*(A - Aw_R1rv) - Aw_R1rv/rv)*exp_R1rv;
+    MPM_FLOAT cb = (R2*(B - Bw_R2rv) - Bw_R2rv/rv)*exp_R2rv;
+
+    return rv*rv/rho0*(ca + cb + w/rv*E/rv) - mean_stress*w/density;
+}
+
+//!> Burning fraction of high explosive, same as "EOS_HighExpBurn::CalculateBurningFraction"
+static inline MPM_FLOAT BurningFraction(MPM_FLOAT mass, MPM_FLOAT volume, MPM_FLOAT light_time,
+    MPM_FLOAT rho0, MPM_FLOAT current_time, MPM_FLOAT F1_coefficient, MPM_FLOAT F2_coefficient)
+{
+    MPM_FLOAT F1 = current_time > light_time ? (current_time - light_time)*F1_coefficient : 0.0;
+    MPM_FLOAT F2 = F2_coefficient*(1.0 - volume/(mass/rho0));
+
+    F1 = F1 > 1.0 ? 1.0 : F1;
+    F2 = F2 > 0.95 ? 1.0 : F2;
+
+    MPM_FLOAT F = F1 > F2 ? F1 : F2;
+    return F < 0.0001 ? 0.0 : F;
+}
+
+MPM_TARGET_CLONES
+void JWL_PressureBatch(EOS_Batch& batch, MPM_FLOAT rho0, 
+    MPM_FLOAT A, MPM_FLOAT B, MPM_FLOAT R1, MPM_FLOAT R2, MPM_FLOAT w)
+{
+    const MPM_STATS number = batch.number;
+    const MPM_FLOAT* MPM_RESTRICT mass = batch.mass;
+    const MPM_FLOAT* MPM_RESTRICT density = batch.density;
+    const MPM_FLOAT* MPM_RESTRICT internal_energy = batch.internal_energy;
+    const MPM_FLOAT* MPM_RESTRICT delta_ie = batch.delta_ie;
+    const MPM_FLOAT* MPM_RESTRICT delta_vol_half = batch.delta_vol_half;
+    MPM_FLOAT* MPM_RESTRICT mean_stress = batch.mean_stress;
+
+    MPM_IVDEP
+    for (MPM_STATS i = 0; i < number; i++)
+        mean_stress[i] = -JWL_Pressure(mass[i], density[i], internal_energy[i], delta_ie[i], 
+            delta_vol_half[i], rho0, A, B, R1, R2, w);
+}
+
+MPM_TARGET_CLONES
+void JWL_SoundSpeedSquareBatch(EOS_Batch& batch, MPM_FLOAT rho0, 
+    MPM_FLOAT A, MPM_FLOAT B, MPM_FLOAT R1, MPM_FLOAT R2, MPM_FLOAT w)
+{
+    const MPM_STATS number = batch.number;
+    const MPM_FLOAT* MPM_RESTRICT mass = batch.mass;
+    const MPM_FLOAT* MPM_RESTRICT density = batch.density;
+    const MPM_FLOAT* MPM_RESTRICT internal_energy = batch.internal_energy;
+    const MPM_FLOAT* MPM_RESTRICT mean_stress = batch.mean_stress;
+    MPM_FLOAT* MPM_RESTRICT sound_speed_square = batch.sound_speed_square;
+
+    MPM_IVDEP
+    for (MPM_STATS i = 0; i < number; i++)
+        sound_speed_square[i] = JWL_SoundSpeedSquare(mass[i], density[i], internal_energy[i], 
+            mean_stress[i], rho0, A, B, R1, R2, w);
+}
+
+MPM_TARGET_CLONES
+void HighExpBurn_PressureBatch(EOS_Batch& batch, MPM_FLOAT rho0, 
+    MPM_FLOAT A, MPM_FLOAT B, MPM_FLOAT R1, MPM_FLOAT R2, MPM_FLOAT w,
+    MPM_FLOAT current_time, MPM_FLOAT F1_coefficient, MPM_FLOAT F2_coefficient)
+{
+    const MPM_STATS number = batch.number;
+    const MPM_FLOAT* MPM_RESTRICT mass = batch.mass;
+    const MPM_FLOAT* MPM_RESTRICT volume = batch.volume;
+    const MPM_FLOAT* MPM_RESTRICT density = batch.density;
+    const MPM_FLOAT* MPM_RESTRICT internal_energy = batch.internal_energy;
+    const MPM_FLOAT* MPM_RESTRICT light_time = batch.light_time;
+    const MPM_FLOAT* MPM_RESTRICT delta_ie = batch.delta_ie;
+    const MPM_FLOAT* MPM_RESTRICT delta_vol_half = batch.delta_vol_half;
+    MPM_FLOAT* MPM_RESTRICT mean_stress = batch.mean_stress;
+
+    MPM_IVDEP
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        MPM_FLOAT fraction = BurningFraction(mass[i], volume[i], light_time[i], rho0, 
+            current_time, F1_coefficient, F2_coefficient);
+        mean_stress[i] = -JWL_Pressure(mass[i], density[i], internal_energy[i], delta_ie[i], 
+            delta_vol_half[i], rho0, A, B, R1, R2, w)*fraction;
+    }
+}
+
+MPM_TARGET_CLONES
+void HighExpBurn_SoundSpeedSquareBatch(EOS_Batch& batch, MPM_FLOAT rho0, 
+    MPM_FLOAT A, MPM_FLOAT B, MPM_FLOAT R1, MPM_FLOAT R2, MPM_FLOAT w,
+    MPM_FLOAT current_time, MPM_FLOAT F1_coefficient, MPM_FLOAT F2_coefficient, MPM_FLOAT D)
+{
+    const MPM_STATS number = batch.number;
+    const MPM_FLOAT* MPM_RESTRICT mass = batch.mass;
+    const MPM_FLOAT* MPM_RESTRICT volume = batch.volume;
+    const MPM_FLOAT* MPM_RESTRICT density = batch.density;
+    const MPM_FLOAT* MPM_RESTRICT internal_energy = batch.internal_energy;
+    const MPM_FLOAT* MPM_RESTRICT light_time = batch.light_time;
+    const MPM_FLOAT* MPM_RESTRICT mean_stress = batch.mean_stress;
+    MPM_FLOAT* MPM_RESTRICT sound_speed_square = batch.sound_speed_square;
+
+    MPM_IVDEP
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        MPM_FLOAT fraction = 1.0 - BurningFraction(mass[i], volume[i], light_time[i], rho0, 
+            current_time, F1_coefficient, F2_coefficient);
+        MPM_FLOAT result = JWL_SoundSpeedSquare(mass[i], density[i], internal_energy[i], 
+            mean_stress[i], rho0, A, B, R1, R2, w);
+        MPM_FLOAT burning = D*D*fraction*fraction;
+        sound_speed_square[i] = result > burning ? result : burning;
+    }
+}
+
+MPM_TARGET_CLONES
+void Gruneisen_PressureBatch(EOS_Batch& batch, MPM_FLOAT rho0, 
+    MPM_FLOAT s, MPM_FLOAT gamma0, MPM_FLOAT impendence_0)
+{
+    const MPM_STATS number = batch.number;
+    const MPM_FLOAT* MPM_RESTRICT mass = batch.mass;
+    const MPM_FLOAT* MPM_RESTRICT density = batch.density;
+    const MPM_FLOAT* MPM_RESTRICT internal_energy = batch.internal_energy;
+    const MPM_FLOAT* MPM_RESTRICT delta_ie = batch.delta_ie;
+    const MPM_FLOAT* MPM_RESTRICT delta_vol_half = batch.delta_vol_half;
+    MPM_FLOAT* MPM_RESTRICT mean_stress = batch.mean_stress;
+
+    MPM_IVDEP
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        MPM_FLOAT V0 = mass[i]/rho0;
+        MPM_FLOAT E = (internal_energy[i] + delta_ie[i])/V0;
+        MPM_FLOAT mu = density[i]/rho0 - 1.0;
+        MPM_FLOAT gamma = gamma0*rho0/density[i];
+
+        //!> Compression
+        MPM_FLOAT denominator = 1.0 - (s - 1.0)*mu;
+        MPM_FLOAT pH = impendence_0*mu*(1.0 + mu)/(denominator*denominator);
+        MPM_FLOAT A_compression = pH*(1 - 0.5*gamma*mu);
+        //!> Tension
+        MPM_FLOAT A_tension = impendence_0*mu;
+
+        MPM_FLOAT A = mu > MPM_EPSILON ? A_compression : A_tension;
+        mean_stress[i] = -(A + gamma0*E)/(1 + gamma0*delta_vol_half[i]/V0);
+    }
+}
+
+MPM_TARGET_CLONES
+void Gruneisen_SoundSpeedSquareBatch(EOS_Batch& batch, MPM_FLOAT rho0, 
+    MPM_FLOAT s, MPM_FLOAT gamma0, MPM_FLOAT impendence_0, MPM_FLOAT c0)
+{
+    const MPM_STATS number = batch.number;
+    const MPM_FLOAT* MPM_RESTRICT density = batch.density;
+    const unsigned char* MPM_RESTRICT failure = MaskView(batch.failure);
+    const MPM_FLOAT* MPM_RESTRICT mean_stress = batch.mean_stress;
+    MPM_FLOAT* MPM_RESTRICT sound_speed_square = batch.sound_speed_square;
+
+    MPM_IVDEP
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        MPM_FLOAT pressure = -mean_stress[i];
+        MPM_FLOAT rv = rho0/density[i];
+        MPM_FLOAT mu = 1.0/rv - 1.0;
+        MPM_FLOAT gamma = gamma0*rv;
+
+        //!> Compression
+        MPM_FLOAT denominator = 1.0 - (s - 1.0)*mu;
+        MPM_FLOAT pH = impendence_0*mu*(1.0 + mu)/(denominator*denominator);
+        MPM_FLOAT DpH = impendence_0*(1.0 + (s + 1.0)*mu)/(denominator*denominator*denominator);
+        MPM_FLOAT result_compression = (DpH*(1 - 0.5*gamma*mu) - 0.5*pH*gamma)/rho0 
+            + pressure*rv*gamma/rho0;
+        //!> Tension
+        MPM_FLOAT result_tension = c0*c0 + pressure*rv*gamma/rho0;
+
+        MPM_FLOAT result = mu > MPM_EPSILON ? result_compression : result_tension;
+        sound_speed_square[i] = failure[i] != 0 ? 0.0 : result;
+    }
+}
+
+MPM_TARGET_CLONES
+void SimpleGruneisen_PressureBatch(EOS_Batch& batch, MPM_FLOAT rho0, 
+    MPM_FLOAT gamma0, MPM_FLOAT c1, MPM_FLOAT c2, MPM_FLOAT c3)
+{
+    const MPM_STATS number = batch.number;
+    const MPM_FLOAT* MPM_RESTRICT mass = batch.mass;
+    const MPM_FLOAT* MPM_RESTRICT density = batch.density;
+    const MPM_FLOAT* MPM_RESTRICT internal_energy = batch.internal_energy;
+    const MPM_FLOAT* MPM_RESTRICT delta_ie = batch.delta_ie;
+    const MPM_FLOAT* MPM_RESTRICT delta_vol_half = batch.delta_vol_half;
+    MPM_FLOAT* MPM_RESTRICT mean_stress = batch.mean_stress;
+
+    MPM_IVDEP
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        MPM_FLOAT V0 = mass[i]/rho0;
+        MPM_FLOAT E = (internal_energy[i] + delta_ie[i])/V0;
+        MPM_FLOAT mu = density[i]/rho0 - 1.0;
+        MPM_FLOAT gamma = gamma0*rho0/density[i];
+
+        MPM_FLOAT pH = c1*(mu + c2*mu*mu + c3*mu*mu*mu);
+        MPM_FLOAT A_compression = pH*(1 - 0.5*gamma*mu);
+        MPM_FLOAT A_tension = c1*mu;
+
+        MPM_FLOAT A = mu > MPM_EPSILON ? A_compression : A_tension;
+        mean_stress[i] = -(A + gamma0*E)/(1 + gamma0*delta_vol_half[i]/V0);
+    }
+}
+
+MPM_TARGET_CLONES
+void SimpleGruneisen_SoundSpeedSquareBatch(EOS_Batch& batch, MPM_FLOAT rho0, 
+    MPM_FLOAT gamma0, MPM_FLOAT c1, MPM_FLOAT c2, MPM_FLOAT c3, MPM_FLOAT c0)
+{
+    const MPM_STATS number = batch.number;
+    const MPM_FLOAT* MPM_RESTRICT density = batch.density;
+    const unsigned char* MPM_RESTRICT failure = MaskView(batch.failure);
+    const MPM_FLOAT* MPM_RESTRICT mean_stress = batch.mean_stress;
+    MPM_FLOAT* MPM_RESTRICT sound_speed_square = batch.sound_speed_square;
+
+    MPM_IVDEP
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        MPM_FLOAT pressure = -mean_stress[i];
+        MPM_FLOAT rv = rho0/density[i];
+        MPM_FLOAT mu = 1.0/rv - 1.0;
+        MPM_FLOAT gamma = gamma0*rv;
+
+        MPM_FLOAT pH = c1*(mu + c2*mu*mu + c3*mu*mu*mu);
+        MPM_FLOAT DpH = c1*(1.0 + 2.0*c2*mu + 3.0*c3*mu*mu);
+        MPM_FLOAT result_compression = (DpH*(1 - 0.5*gamma*mu) - 0.5*pH*gamma)/rho0 
+            + pressure*rv*gamma/rho0;
+        MPM_FLOAT result_tension = c0*c0 + pressure*rv*gamma/rho0;
+
+        MPM_FLOAT result = mu > MPM_EPSILON ? result_compression : result_tension;
+        sound_speed_square[i] = failure[i] != 0 ? 0.0 : result;
+    }
+}
+
+MPM_TARGET_CLONES
+void Polynomial_PressureBatch(EOS_Batch& batch, MPM_FLOAT rho0, const MPM_FLOAT (&c)[7])
+{
+    const MPM_STATS number = batch.number;
+    const MPM_FLOAT* MPM_RESTRICT mass = batch.mass;
+    const MPM_FLOAT* MPM_RESTRICT density = batch.density;
+    const MPM_FLOAT* MPM_RESTRICT internal_energy = batch.internal_energy;
+    const MPM_FLOAT* MPM_RESTRICT delta_ie = batch.delta_ie;
+    const MPM_FLOAT* MPM_RESTRICT delta_vol_half = batch.delta_vol_half;
+    MPM_FLOAT* MPM_RESTRICT mean_stress = batch.mean_stress;
+    const MPM_FLOAT c0 = c[0], c1 = c[1], c2 = c[2], c3 = c[3], c4 = c[4], c5 = c[5], c6 = c[6];
+
+    MPM_IVDEP
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        MPM_FLOAT V0 = mass[i]/rho0;
+        MPM_FLOAT E = (internal_energy[i] + delta_ie[i])/V0;
+        MPM_FLOAT mu = density[i]/rho0 - 1.0;
+
+        //!> c2 and c6 are set to zero when mu < 0 (material in tension)
+        bool tension = mu < -MPM_EPSILON;
+        MPM_FLOAT A = tension ? c0 + mu*(c1 + mu*mu*c3) : c0 + mu*(c1 + mu*(c2 + mu*c3));
+        MPM_FLOAT B = tension ? c4 + mu*c5 : c4 + mu*(c5 + mu*c6);
+
+        mean_stress[i] = -(A + B*E)/(1 + B*delta_vol_half[i]/V0);
+    }
+}
+
+MPM_TARGET_CLONES
+void Polynomial_SoundSpeedSquareBatch(EOS_Batch& batch, MPM_FLOAT rho0, const MPM_FLOAT (&c)[7])
+{
+    const MPM_STATS number = batch.number;
+    const MPM_FLOAT* MPM_RESTRICT mass = batch.mass;
+    const MPM_FLOAT* MPM_RESTRICT density = batch.density;
+    const MPM_FLOAT* MPM_RESTRICT internal_energy = batch.internal_energy;
+    const unsigned char* MPM_RESTRICT failure = MaskView(batch.failure);
+    const MPM_FLOAT* MPM_RESTRICT mean_stress = batch.mean_stress;
+    MPM_FLOAT* MPM_RESTRICT sound_speed_square = batch.sound_speed_square;
+    const MPM_FLOAT c1 = c[1], c2 = c[2], c3 = c[3], c4 = c[4], c5 = c[5], c6 = c[6];
+
+    MPM_IVDEP
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        MPM_FLOAT pressure = -mean_stress[i];
+        MPM_FLOAT rv = rho0/density[i];
+        MPM_FLOAT mu = 1.0/rv - 1.0;
+        MPM_FLOAT E = internal_energy[i]*rho0/mass[i];
+
+        bool tension = mu < -MPM_EPSILON;
+        MPM_FLOAT B = tension ? c4 + mu*c5 : c4 + mu*(c5 + mu*c6);
+        MPM_FLOAT C = tension ? c1 + mu*3.0*c3*mu : c1 + mu*(2.0*c2 + 3.0*c3*mu);
+        MPM_FLOAT D = tension ? c5 : c5 + 2.0*c6*mu;
+
+        MPM_FLOAT result = (C + D*E + B*pressure*rv*rv)/rho0;
+        sound_speed_square[i] = failure[i] != 0 ? 0.0 : result;
+    }
+}
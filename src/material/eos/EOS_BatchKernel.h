@@ -0,0 +1,69 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Vectorized kernels of EOS models on packed arrays.
+        Branches of the particle versions (mu < 0 or mu > 0,
+        failed particles, burning fraction) are evaluated on
+        both sides and selected per lane, so each loop runs
+        4/8/16 particles per instruction with AVX2/AVX-512.
+        Definitions are compiled for several instruction sets,
+        selected at runtime, see "utility/SIMD.h".
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _EOS_BATCHKERNEL_H_
+#define _EOS_BATCHKERNEL_H_
+
+#include "EOS_Base.h"
+#include "../../utility/SIMD.h"
+
+//!> Jones-Wilkins-Lee EOS
+void JWL_PressureBatch(EOS_Batch& batch, MPM_FLOAT rho0, 
+    MPM_FLOAT A, MPM_FLOAT B, MPM_FLOAT R1, MPM_FLOAT R2, MPM_FLOAT w);
+
+void JWL_SoundSpeedSquareBatch(EOS_Batch& batch, MPM_FLOAT rho0, 
+    MPM_FLOAT A, MPM_FLOAT B, MPM_FLOAT R1, MPM_FLOAT R2, MPM_FLOAT w);
+
+//!> High explosive burn, Jones-Wilkins-Lee EOS multiplied by the burning fraction
+//!> F1_coefficient (F2_coefficient) is zero if programed burning (beta burning) is not used
+void HighExpBurn_PressureBatch(EOS_Batch& batch, MPM_FLOAT rho0, 
+    MPM_FLOAT A, MPM_FLOAT B, MPM_FLOAT R1, MPM_FLOAT R2, MPM_FLOAT w,
+    MPM_FLOAT current_time, MPM_FLOAT F1_coefficient, MPM_FLOAT F2_coefficient);
+
+void HighExpBurn_SoundSpeedSquareBatch(EOS_Batch& batch, MPM_FLOAT rho0, 
+    MPM_FLOAT A, MPM_FLOAT B, MPM_FLOAT R1, MPM_FLOAT R2, MPM_FLOAT w,
+    MPM_FLOAT current_time, MPM_FLOAT F1_coefficient, MPM_FLOAT F2_coefficient, MPM_FLOAT D);
+
+//!> Mie-Gruneisen EOS
+void Gruneisen_PressureBatch(EOS_Batch& batch, MPM_FLOAT rho0, 
+    MPM_FLOAT s, MPM_FLOAT gamma0, MPM_FLOAT impendence_0);
+
+void Gruneisen_SoundSpeedSquareBatch(EOS_Batch& batch, MPM_FLOAT rho0, 
+    MPM_FLOAT s, MPM_FLOAT gamma0, MPM_FLOAT impendence_0, MPM_FLOAT c0);
+
+//!> Simplified Mie-Gruneisen EOS
+void SimpleGruneisen_PressureBatch(EOS_Batch& batch, MPM_FLOAT rho0, 
+    MPM_FLOAT gamma0, MPM_FLOAT c1, MPM_FLOAT c2, MPM_FLOAT c3);
+
+void SimpleGruneisen_SoundSpeedSquareBatch(EOS_Batch& batch, MPM_FLOAT rho0, 
+    MPM_FLOAT gamma0, MPM_FLOAT c1, MPM_FLOAT c2, MPM_FLOAT c3, MPM_FLOAT c0);
+
+//!> Polynomial EOS, c[7] = {c0, c1, c2, c3, c4, c5, c6}
+void Polynomial_PressureBatch(EOS_Batch& batch, MPM_FLOAT rho0, const MPM_FLOAT (&c)[7]);
+
+void Polynomial_SoundSpeedSquareBatch(EOS_Batch& batch, MPM_FLOAT rho0, const MPM_FLOAT (&c)[7]);
+
+#endif
@@ -19,6 +19,7 @@
 ==============================================================*/
 
 #include "EOS_Gruneisen.h"
+#include "EOS_BatchKernel.h"
 
 EOS_Gruneisen::EOS_Gruneisen()
 {
@@ -57,7 +58,7 @@ void EOS_Gruneisen::Write(ofstream& os)
 }
 
 void EOS_Gruneisen::UpdatePressure(PhysicalProperty* pp, MPM_FLOAT delta_vol_half, 
-    MPM_FLOAT delta_ie, map<string, MPM_FLOAT>& transfer)
+    MPM_FLOAT delta_ie, DataTransfer& transfer)
 {
     MPM_FLOAT V0 = pp->GetMass()/_density_0;
     MPM_FLOAT E = (pp->GetInternalEnergy() + delta_ie)/V0;
@@ -83,7 +84,7 @@ void EOS_Gruneisen::UpdatePressure(PhysicalProperty* pp, MPM_FLOAT delta_vol_hal
     return;
 }
 
-MPM_FLOAT EOS_Gruneisen::SoundSpeedSquare_EOS(PhysicalProperty* pp)
+MPM_FLOAT EOS_Gruneisen::SoundSpeedSquare_EOS(PhysicalProperty* pp, DataTransfer& transfer)
 {
     if (pp->is_Failed())
         return 0.0;
@@ -109,4 +110,16 @@ MPM_FLOAT EOS_Gruneisen::SoundSpeedSquare_EOS(PhysicalProperty* pp)
         result = _sound_speed_0*_sound_speed_0 + pressure*rv*gamma/_density_0;
     }
     return result;
+}
+
+bool EOS_Gruneisen::UpdatePressureBatch(EOS_Batch& batch)
+{
+    Gruneisen_PressureBatch(batch, _density_0, _s, _gamma0, _impendence_0);
+    return true;
+}
+
+bool EOS_Gruneisen::SoundSpeedSquareBatch_EOS(EOS_Batch& batch)
+{
+    Gruneisen_SoundSpeedSquareBatch(batch, _density_0, _s, _gamma0, _impendence_0, _sound_speed_0);
+    return true;
 }
\ No newline at end of file
@@ -19,7 +19,8 @@
 ==============================================================*/
 
 #include "EOS_HighExpBurn.h"
-#include "../../solver/Solver_Base.h"
+#include "EOS_BatchKernel.h"
+#include "../../solver/SimulationContext.h"
 
 EOS_HighExpBurn::EOS_HighExpBurn()
 {
@@ -107,25 +108,45 @@ void EOS_HighExpBurn::Write(ofstream& os)
 }
 
 void EOS_HighExpBurn::UpdatePressure(PhysicalProperty* pp, MPM_FLOAT delta_vol_half, 
-        MPM_FLOAT delta_ie, map<string, MPM_FLOAT>& transfer)
+        MPM_FLOAT delta_ie, DataTransfer& transfer)
 {
-    MPM_FLOAT fraction = CalculateBurningFraction(pp);
+    MPM_FLOAT fraction = CalculateBurningFraction(pp, transfer.context->GetCurrentTime());
     EOS_JWL::UpdatePressure(pp, delta_vol_half, delta_ie, transfer);
 
     MPM_FLOAT mean_stress = pp->GetMeanStress();
     pp->SetMeanStress(mean_stress*fraction);
 }
 
-MPM_FLOAT EOS_HighExpBurn::SoundSpeedSquare_EOS(PhysicalProperty* pp)
+MPM_FLOAT EOS_HighExpBurn::SoundSpeedSquare_EOS(PhysicalProperty* pp, DataTransfer& transfer)
 {
-    MPM_FLOAT fraction = 1.0 - CalculateBurningFraction(pp);
-    MPM_FLOAT result = EOS_JWL::SoundSpeedSquare_EOS(pp);
+    MPM_FLOAT fraction = 1.0 - CalculateBurningFraction(pp, transfer.context->GetCurrentTime());
+    MPM_FLOAT result = EOS_JWL::SoundSpeedSquare_EOS(pp, transfer);
     result = max(result, _detonation_velocity*_detonation_velocity*fraction*fraction);
     return result;
 }
 
+bool EOS_HighExpBurn::UpdatePressureBatch(EOS_Batch& batch)
+{
+    if (!batch.light_time)
+        return false;
+
+    HighExpBurn_PressureBatch(batch, _density_0, _A, _B, _R1, _R2, _w,
+        batch.context->GetCurrentTime(), _F1_coefficient, _F2_coefficient);
+    return true;
+}
+
+bool EOS_HighExpBurn::SoundSpeedSquareBatch_EOS(EOS_Batch& batch)
+{
+    if (!batch.light_time)
+        return false;
+
+    HighExpBurn_SoundSpeedSquareBatch(batch, _density_0, _A, _B, _R1, _R2, _w,
+        batch.context->GetCurrentTime(), _F1_coefficient, _F2_coefficient, _detonation_velocity);
+    return true;
+}
+
 bool EOS_HighExpBurn::AddExtraParticleProperty_EOS(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer)
+        DataTransfer& transfer)
 {
     if (!EOS_JWL::AddExtraParticleProperty_EOS(ExtraProp, transfer))
         return false;
@@ -134,12 +155,11 @@ bool EOS_HighExpBurn::AddExtraParticleProperty_EOS(vector<MPM::ExtraParticleProp
     return true;
 }
 
-MPM_FLOAT EOS_HighExpBurn::CalculateBurningFraction(PhysicalProperty* pp)
+MPM_FLOAT EOS_HighExpBurn::CalculateBurningFraction(PhysicalProperty* pp, MPM_FLOAT current_time)
 {
     MPM_FLOAT F = 0.0;
     MPM_FLOAT F1 = 0.0;
     MPM_FLOAT F2 = 0.0;
-    MPM_FLOAT current_time = Solver_Base::GetCurrentTime();
 
     if (_programed_burning)
         if (current_time > (*pp)[MPM::LT])
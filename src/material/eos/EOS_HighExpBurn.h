@@ -37,14 +37,18 @@ public:
 
     //!> Update the pressure of the particle
     virtual void UpdatePressure(PhysicalProperty* pp, MPM_FLOAT delta_vol_half, 
-        MPM_FLOAT delta_ie, map<string, MPM_FLOAT>& transfer);
+        MPM_FLOAT delta_ie, DataTransfer& transfer);
 
     //!> Calculate the squared adabatic sound speed of EOS part
-    virtual MPM_FLOAT SoundSpeedSquare_EOS(PhysicalProperty* pp);
+    virtual MPM_FLOAT SoundSpeedSquare_EOS(PhysicalProperty* pp, DataTransfer& transfer);
+
+    //!> Vectorized versions on packed arrays, see "EOS_BatchKernel.h"
+    virtual bool UpdatePressureBatch(EOS_Batch& batch);
+    virtual bool SoundSpeedSquareBatch_EOS(EOS_Batch& batch);
 
     //!> Add extra particle properties based on different failure model
     virtual bool AddExtraParticleProperty_EOS(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer);
+        DataTransfer& transfer);
 private:
     MPM_FLOAT _detonation_velocity;
     MPM_FLOAT _F1_coefficient;
@@ -55,7 +59,8 @@ private:
     bool _beta_burning;         //!< beta burn option
     bool _programed_burning;    //!< programed burning option
 private:
-    MPM_FLOAT CalculateBurningFraction(PhysicalProperty* pp);
+    //!> Burning fraction of the particle at "current_time" of the simulation
+    MPM_FLOAT CalculateBurningFraction(PhysicalProperty* pp, MPM_FLOAT current_time);
 };
 
 #endif
\ No newline at end of file
@@ -19,6 +19,7 @@
 ==============================================================*/
 
 #include "EOS_JWL.h"
+#include "EOS_BatchKernel.h"
 
 EOS_JWL::EOS_JWL()
 {
@@ -50,7 +51,7 @@ void EOS_JWL::Write(ofstream& os)
 }
 
 void EOS_JWL::UpdatePressure(PhysicalProperty* pp, MPM_FLOAT delta_vol_half, 
-    MPM_FLOAT delta_ie, map<string, MPM_FLOAT>& transfer)
+    MPM_FLOAT delta_ie, DataTransfer& transfer)
 {
     MPM_FLOAT V0 = pp->GetMass()/_density_0;
     MPM_FLOAT E = (pp->GetInternalEnergy() + delta_ie)/V0;
@@ -78,7 +79,7 @@ void EOS_JWL::UpdatePressure(PhysicalProperty* pp, MPM_FLOAT delta_vol_half,
     return;
 }
 
-MPM_FLOAT EOS_JWL::SoundSpeedSquare_EOS(PhysicalProperty* pp)
+MPM_FLOAT EOS_JWL::SoundSpeedSquare_EOS(PhysicalProperty* pp, DataTransfer& transfer)
 {
     MPM_FLOAT pressure = -pp->GetMeanStress();
     MPM_FLOAT rv = _density_0/pp->GetDensity();     //!< Relative volume
@@ -100,4 +101,16 @@ MPM_FLOAT EOS_JWL::SoundSpeedSquare_EOS(PhysicalProperty* pp)
 
     MPM_FLOAT result = rv*rv/_density_0*(ca + cb + B*E/rv) + pressure*_w/pp->GetDensity();
     return result;
+}
+
+bool EOS_JWL::UpdatePressureBatch(EOS_Batch& batch)
+{
+    JWL_PressureBatch(batch, _density_0, _A, _B, _R1, _R2, _w);
+    return true;
+}
+
+bool EOS_JWL::SoundSpeedSquareBatch_EOS(EOS_Batch& batch)
+{
+    JWL_SoundSpeedSquareBatch(batch, _density_0, _A, _B, _R1, _R2, _w);
+    return true;
 }
\ No newline at end of file
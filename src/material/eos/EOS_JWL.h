@@ -37,10 +37,14 @@ public:
 
     //!> Update the pressure of the particle
     virtual void UpdatePressure(PhysicalProperty* pp, MPM_FLOAT delta_vol_half, 
-        MPM_FLOAT delta_ie, map<string, MPM_FLOAT>& transfer);
+        MPM_FLOAT delta_ie, DataTransfer& transfer);
 
     //!> Calculate the squared adabatic sound speed of EOS part
-    virtual MPM_FLOAT SoundSpeedSquare_EOS(PhysicalProperty* pp);
+    virtual MPM_FLOAT SoundSpeedSquare_EOS(PhysicalProperty* pp, DataTransfer& transfer);
+
+    //!> Vectorized versions on packed arrays, see "EOS_BatchKernel.h"
+    virtual bool UpdatePressureBatch(EOS_Batch& batch);
+    virtual bool SoundSpeedSquareBatch_EOS(EOS_Batch& batch);
 protected:
     //!> parameters for Jones-Wilkins-Lee EOS
     //!> p = A*(1 - w/R1/V)*exp(-R1*V) + B*(1 - w/R2/V)*exp(-R2*V) + wE/V
@@ -19,6 +19,7 @@
 ==============================================================*/
 
 #include "EOS_Polynomial.h"
+#include "EOS_BatchKernel.h"
 
 EOS_Polynomial::EOS_Polynomial(/* args */)
 {
@@ -54,7 +55,7 @@ void EOS_Polynomial::Write(ofstream& os)
 }
 
 void EOS_Polynomial::UpdatePressure(PhysicalProperty* pp, MPM_FLOAT delta_vol_half, 
-    MPM_FLOAT delta_ie, map<string, MPM_FLOAT>& transfer)
+    MPM_FLOAT delta_ie, DataTransfer& transfer)
 {
     MPM_FLOAT V0 = pp->GetMass()/_density_0;
     MPM_FLOAT E = (pp->GetInternalEnergy() + delta_ie)/V0;
@@ -78,7 +79,7 @@ void EOS_Polynomial::UpdatePressure(PhysicalProperty* pp, MPM_FLOAT delta_vol_ha
     return;
 }
 
-MPM_FLOAT EOS_Polynomial::SoundSpeedSquare_EOS(PhysicalProperty* pp)
+MPM_FLOAT EOS_Polynomial::SoundSpeedSquare_EOS(PhysicalProperty* pp, DataTransfer& transfer)
 {
     if (pp->is_Failed() || _density_0 <= MPM_EPSILON)
         return 0.0;
@@ -104,4 +105,21 @@ MPM_FLOAT EOS_Polynomial::SoundSpeedSquare_EOS(PhysicalProperty* pp)
 
     MPM_FLOAT result = (C + D*E + B*pressure*rv*rv)/_density_0;
     return result;
+}
+
+bool EOS_Polynomial::UpdatePressureBatch(EOS_Batch& batch)
+{
+    MPM_FLOAT c[7] = {_c0, _c1, _c2, _c3, _c4, _c5, _c6};
+    Polynomial_PressureBatch(batch, _density_0, c);
+    return true;
+}
+
+bool EOS_Polynomial::SoundSpeedSquareBatch_EOS(EOS_Batch& batch)
+{
+    if (_density_0 <= MPM_EPSILON)
+        return false;
+
+    MPM_FLOAT c[7] = {_c0, _c1, _c2, _c3, _c4, _c5, _c6};
+    Polynomial_SoundSpeedSquareBatch(batch, _density_0, c);
+    return true;
 }
\ No newline at end of file
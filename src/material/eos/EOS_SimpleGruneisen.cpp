@@ -19,6 +19,7 @@
 ==============================================================*/
 
 #include "EOS_SimpleGruneisen.h"
+#include "EOS_BatchKernel.h"
 
 EOS_SimpleGruneisen::EOS_SimpleGruneisen()
 {
@@ -58,7 +59,7 @@ void EOS_SimpleGruneisen::Write(ofstream& os)
 }
 
 void EOS_SimpleGruneisen::UpdatePressure(PhysicalProperty* pp, MPM_FLOAT delta_vol_half, 
-    MPM_FLOAT delta_ie, map<string, MPM_FLOAT>& transfer)
+    MPM_FLOAT delta_ie, DataTransfer& transfer)
 {
     MPM_FLOAT V0 = pp->GetMass()/_density_0;
     MPM_FLOAT E = (pp->GetInternalEnergy() + delta_ie)/V0;
@@ -83,7 +84,7 @@ void EOS_SimpleGruneisen::UpdatePressure(PhysicalProperty* pp, MPM_FLOAT delta_v
     return;
 }
 
-MPM_FLOAT EOS_SimpleGruneisen::SoundSpeedSquare_EOS(PhysicalProperty* pp)
+MPM_FLOAT EOS_SimpleGruneisen::SoundSpeedSquare_EOS(PhysicalProperty* pp, DataTransfer& transfer)
 {
     if (pp->is_Failed())
         return 0.0;
@@ -108,4 +109,16 @@ MPM_FLOAT EOS_SimpleGruneisen::SoundSpeedSquare_EOS(PhysicalProperty* pp)
         result = _sound_speed_0*_sound_speed_0 + pressure*rv*gamma/_density_0;
     }
     return result;
+}
+
+bool EOS_SimpleGruneisen::UpdatePressureBatch(EOS_Batch& batch)
+{
+    SimpleGruneisen_PressureBatch(batch, _density_0, _gamma0, _c1, _c2, _c3);
+    return true;
+}
+
+bool EOS_SimpleGruneisen::SoundSpeedSquareBatch_EOS(EOS_Batch& batch)
+{
+    SimpleGruneisen_SoundSpeedSquareBatch(batch, _density_0, _gamma0, _c1, _c2, _c3, _sound_speed_0);
+    return true;
 }
\ No newline at end of file
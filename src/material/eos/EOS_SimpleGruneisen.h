@@ -37,10 +37,14 @@ public:
 
     //!> Update the pressure of the particle
     virtual void UpdatePressure(PhysicalProperty* pp, MPM_FLOAT delta_vol_half, 
-        MPM_FLOAT delta_ie, map<string, MPM_FLOAT>& transfer);
+        MPM_FLOAT delta_ie, DataTransfer& transfer);
 
     //!> Calculate the squared adabatic sound speed of EOS part
-    virtual MPM_FLOAT SoundSpeedSquare_EOS(PhysicalProperty* pp);
+    virtual MPM_FLOAT SoundSpeedSquare_EOS(PhysicalProperty* pp, DataTransfer& transfer);
+
+    //!> Vectorized versions on packed arrays, see "EOS_BatchKernel.h"
+    virtual bool UpdatePressureBatch(EOS_Batch& batch);
+    virtual bool SoundSpeedSquareBatch_EOS(EOS_Batch& batch);
 private:
     //!> parameters for Gruneisen EOS
     //!> p = rho0*c0^2*(mu + (2*s - 1)*mu^2 + (s - 1)*(3*s - 1)*mu^3)
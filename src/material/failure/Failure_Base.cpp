@@ -24,6 +24,7 @@ Failure_Base::Failure_Base()
 {
     Type = "";
     Erosion = false;
+    _fast_math = false;
 }
 
 Failure_Base::~Failure_Base()
@@ -52,8 +53,14 @@ bool Failure_Base::Initialize(map<string, MPM_FLOAT> &failure_para)
     return true;
 }
 
+void Failure_Base::CheckFailureBatch(PhysicalProperty* pp, DataTransfer* transfer, MPM_STATS number)
+{
+    for (MPM_STATS i = 0; i < number; i++)
+        CheckFailure(pp + i, transfer[i]);
+}
+
 bool Failure_Base::AddExtraParticleProperty_Failure(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer)
+        DataTransfer& transfer)
 {
     // Nothing needs to be added
     return true;
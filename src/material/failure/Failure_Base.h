@@ -24,17 +24,35 @@
 
 #include "../../main/MPM3D_MACRO.h"
 #include "../../body/PhysicalProperty.h"
+#include "../DataTransfer.h"
+#include "../../utility/mathfunction/FastMath.h"
+
+//!> Symmetric tensors packed into arrays for the batch failure kernels, each array has "number" entries
+struct Failure_Batch
+{
+    MPM_STATS number;
+    const MPM_FLOAT* tensor[6];         //!< xx, yy, zz, yz, xz, xy, shear in tensor components
+    bool* failure;                      //!< output
+};
 
 class Failure_Base
 {
 public:
     Failure_Base();
-    ~Failure_Base();
+    virtual ~Failure_Base();
 
     inline string GetName() {return Type;};
 
+    //!> Use polynomial approximations of pow/log/exp, set by the material parameter "FastMath"
+    inline void SetFastMath(bool fast_math) {_fast_math = fast_math;}
+
     //!> Identify if the particle fails according to its physical property
-    virtual bool CheckFailure(PhysicalProperty* pp, map<string, MPM_FLOAT>& transfer) = 0;
+    virtual bool CheckFailure(PhysicalProperty* pp, DataTransfer& transfer) = 0;
+
+    //!> Vectorized version of "CheckFailure" on "number" particles with the same results
+    //!> Called by the stress update when "HasBatchKernel" is true, the default loops "CheckFailure"
+    virtual void CheckFailureBatch(PhysicalProperty* pp, DataTransfer* transfer, MPM_STATS number);
+    virtual bool HasBatchKernel() {return false;}
 
     //!> Write failure model information into file
     virtual void Write(ofstream &os) = 0;
@@ -44,10 +62,13 @@ public:
 
     //!> Add extra particle properties based on different failure model
     virtual bool AddExtraParticleProperty_Failure(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer);
+        DataTransfer& transfer);
 protected:
     string Type;                            //!< Failure Behavior Type
     bool Erosion;                           //!< whether to erode particles when failed
+    bool _fast_math;                        //!< whether to use "FastExp"
+
+    inline MPM_FLOAT _Exp(MPM_FLOAT x) {return _fast_math ? FastExp(x) : exp(x);}
     
     //!> Failure model parameters for initialization
     map<string, MPM_FLOAT*> ParameterMap_Failure;   
@@ -0,0 +1,86 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of vectorized failure kernels
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "Failure_BatchKernel.h"
+#include "../../utility/MathFunctionList.h"
+
+MPM_TARGET_CLONES
+void PrincipalFailureBatch(Failure_Batch& batch, MPM_FLOAT min_limit, MPM_FLOAT max_limit, MPM_FLOAT shear_limit)
+{
+    const MPM_STATS number = batch.number;
+    const MPM_FLOAT* MPM_RESTRICT t0 = batch.tensor[0];
+    const MPM_FLOAT* MPM_RESTRICT t1 = batch.tensor[1];
+    const MPM_FLOAT* MPM_RESTRICT t2 = batch.tensor[2];
+    const MPM_FLOAT* MPM_RESTRICT t3 = batch.tensor[3];
+    const MPM_FLOAT* MPM_RESTRICT t4 = batch.tensor[4];
+    const MPM_FLOAT* MPM_RESTRICT t5 = batch.tensor[5];
+    unsigned char* MPM_RESTRICT failure = MaskView(batch.failure);
+
+    //!> Bound pass, a particle is a candidate if its bounds exceed any limit
+    alignas(MPM::MemoryAlignment) unsigned char candidate[MPM::ParticleChunkSize];
+    MPM_IVDEP
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        MPM_FLOAT lower, upper;
+        SymmetricEigenvalueBounds(t0[i], t1[i], t2[i], t3[i], t4[i], t5[i], lower, upper);
+        candidate[i] = PrincipalLimitExceeded(lower, upper, min_limit, max_limit, shear_limit);
+        failure[i] = 0;
+    }
+
+    MPM_STATS index[MPM::ParticleChunkSize];
+    MPM_STATS candidate_number = 0;
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        index[candidate_number] = i;
+        candidate_number += candidate[i];
+    }
+    if (candidate_number == 0)
+        return;
+
+    //!> Exact pass on the gathered candidates
+    alignas(MPM::MemoryAlignment) MPM_FLOAT c0[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT c1[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT c2[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT c3[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT c4[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) MPM_FLOAT c5[MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) unsigned char exceeded[MPM::ParticleChunkSize];
+    for (MPM_STATS k = 0; k < candidate_number; k++)
+    {
+        MPM_STATS i = index[k];
+        c0[k] = t0[i];
+        c1[k] = t1[i];
+        c2[k] = t2[i];
+        c3[k] = t3[i];
+        c4[k] = t4[i];
+        c5[k] = t5[i];
+    }
+
+    MPM_IVDEP
+    for (MPM_STATS k = 0; k < candidate_number; k++)
+    {
+        MPM_FLOAT lambda_max, lambda_mid, lambda_min;
+        SymmetricEigenvalues(c0[k], c1[k], c2[k], c3[k], c4[k], c5[k], lambda_max, lambda_mid, lambda_min);
+        exceeded[k] = PrincipalLimitExceeded(lambda_min, lambda_max, min_limit, max_limit, shear_limit);
+    }
+
+    for (MPM_STATS k = 0; k < candidate_number; k++)
+        failure[index[k]] = exceeded[k];
+}
@@ -0,0 +1,51 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Vectorized principal value check of the failure
+        models on packed symmetric tensors. A bound pass on
+        the mean value and the invariant radius marks the
+        particles which may exceed any limit, only these are
+        gathered and solved by "SymmetricEigenvalues", so
+        the common case of stresses far below the limits
+        costs one square root per particle.
+        Definitions are compiled for several instruction sets,
+        selected at runtime, see "utility/SIMD.h".
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _FAILURE_BATCHKERNEL_H_
+#define _FAILURE_BATCHKERNEL_H_
+
+#include "Failure_Base.h"
+#include "../../utility/SIMD.h"
+#include "../../utility/AlignedMemory.h"
+
+//!> Whether the principal values exceed any limit, thresholds follow "Failure_PriStress::CheckFailure"
+//!> Monotonic in both values, so the eigenvalue bounds can be checked in place of the eigenvalues
+inline bool PrincipalLimitExceeded(MPM_FLOAT min_value, MPM_FLOAT max_value, 
+    MPM_FLOAT min_limit, MPM_FLOAT max_limit, MPM_FLOAT shear_limit)
+{
+    MPM_FLOAT shear = (max_value - min_value)*0.5;
+    bool exceeded_min = min_limit < -MPM_EPSILON && min_value < -MPM_EPSILON && min_value < min_limit;
+    bool exceeded_max = max_limit > MPM_EPSILON && max_value > MPM_EPSILON && max_value > max_limit;
+    bool exceeded_shear = shear_limit > MPM_EPSILON && shear > MPM_EPSILON && shear > shear_limit;
+    return exceeded_min | exceeded_max | exceeded_shear;
+}
+
+//!> "PrincipalLimitExceeded" on the eigenvalues of each tensor, "number" <= MPM::ParticleChunkSize
+void PrincipalFailureBatch(Failure_Batch& batch, MPM_FLOAT min_limit, MPM_FLOAT max_limit, MPM_FLOAT shear_limit);
+
+#endif
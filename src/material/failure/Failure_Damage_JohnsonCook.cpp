@@ -40,17 +40,17 @@ Failure_Damage_JohnsonCook::~Failure_Damage_JohnsonCook()
 {
 }
 
-bool Failure_Damage_JohnsonCook::CheckFailure(PhysicalProperty* pp, map<string, MPM_FLOAT>& transfer)
+bool Failure_Damage_JohnsonCook::CheckFailure(PhysicalProperty* pp, DataTransfer& transfer)
 {
     if (pp->is_Failed())
         return true;
     
-    MPM_FLOAT lsrate = transfer["lsrate"];      //!< log(strain rate)
-    MPM_FLOAT tstar = transfer["tstar"];        //!< dimensionless temperature
-    MPM_FLOAT depeff = transfer["depeff"];      //!< plastic strain increment
+    MPM_FLOAT lsrate = transfer.lsrate;     //!< log(strain rate)
+    MPM_FLOAT tstar = transfer.tstar;       //!< dimensionless temperature
+    MPM_FLOAT depeff = transfer.depeff;     //!< plastic strain increment
 
     MPM_FLOAT sigma_star = pp->GetMeanStress()/(pp->GetEquivalentStress() + MPM_EPSILON);
-    MPM_FLOAT strain_fracture = (_D1 + _D2*exp(_D3*sigma_star))*(1 + _D4*lsrate)*(1 + _D5*tstar);
+    MPM_FLOAT strain_fracture = (_D1 + _D2*_Exp(_D3*sigma_star))*(1 + _D4*lsrate)*(1 + _D5*tstar);
 
     if (strain_fracture > MPM_EPSILON)
     {
@@ -93,7 +93,7 @@ bool Failure_Damage_JohnsonCook::Initialize(map<string, MPM_FLOAT> &failure_para
 }
 
 bool Failure_Damage_JohnsonCook::AddExtraParticleProperty_Failure(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer)
+        DataTransfer& transfer)
 {
     ExtraProp.push_back(MPM::DMG);
     return true;
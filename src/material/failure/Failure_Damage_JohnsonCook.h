@@ -31,7 +31,7 @@ public:
     ~Failure_Damage_JohnsonCook();
 
     //!> Identify if the particle fails according to its physical property
-    virtual bool CheckFailure(PhysicalProperty* pp, map<string, MPM_FLOAT>& transfer);
+    virtual bool CheckFailure(PhysicalProperty* pp, DataTransfer& transfer);
 
     //!> Write failure model information into file
     virtual void Write(ofstream &os);
@@ -41,7 +41,7 @@ public:
 
     //!> Add extra particle properties based on different failure model
     virtual bool AddExtraParticleProperty_Failure(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer);
+        DataTransfer& transfer);
 private:
     //!> Parameters for damage update
     MPM_FLOAT _D1, _D2, _D3, _D4, _D5;
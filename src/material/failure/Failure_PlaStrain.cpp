@@ -31,7 +31,7 @@ Failure_PlaStrain::~Failure_PlaStrain()
 {
 }
 
-bool Failure_PlaStrain::CheckFailure(PhysicalProperty* pp, map<string, MPM_FLOAT>& transfer)
+bool Failure_PlaStrain::CheckFailure(PhysicalProperty* pp, DataTransfer& transfer)
 {
     if (pp->is_Failed())
         return true;
@@ -68,7 +68,7 @@ bool Failure_PlaStrain::Initialize(map<string, MPM_FLOAT> &failure_para)
 }
 
 bool Failure_PlaStrain::AddExtraParticleProperty_Failure(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer)
+        DataTransfer& transfer)
 {
     ExtraProp.push_back(MPM::epeff);
     return true;
@@ -30,7 +30,7 @@ public:
     ~Failure_PlaStrain();
 
     //!> Identify if the particle fails according to its physical property
-    virtual bool CheckFailure(PhysicalProperty* pp, map<string, MPM_FLOAT>& transfer);
+    virtual bool CheckFailure(PhysicalProperty* pp, DataTransfer& transfer);
 
     //!> Write failure model information into file
     virtual void Write(ofstream &os);
@@ -40,7 +40,7 @@ public:
 
     //!> Add extra particle properties based on different failure model
     virtual bool AddExtraParticleProperty_Failure(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer);
+        DataTransfer& transfer);
 private:
     //!> Threshold of effective plastic strain
     MPM_FLOAT _epmax;
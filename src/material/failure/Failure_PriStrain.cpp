@@ -19,6 +19,7 @@
 ==============================================================*/
 
 #include "Failure_PriStrain.h"
+#include "Failure_BatchKernel.h"
 #include "../../utility/MathFunctionList.h"
 
 Failure_PriStrain::Failure_PriStrain()
@@ -37,44 +38,26 @@ Failure_PriStrain::~Failure_PriStrain()
 {
 }
 
-bool Failure_PriStrain::CheckFailure(PhysicalProperty* pp, map<string, MPM_FLOAT>& transfer)
+bool Failure_PriStrain::CheckFailure(PhysicalProperty* pp, DataTransfer& transfer)
 {
     if (pp->is_Failed())
         return true;
     
-    Array3D principle_strain;
-    MPM_FLOAT I_1 = (*pp)[MPM::Exx] + (*pp)[MPM::Eyy] + (*pp)[MPM::Ezz];
-    MPM_FLOAT I_2 = -0.5*(I_1*I_1 - ((*pp)[MPM::Exx]*(*pp)[MPM::Exx] +
-        (*pp)[MPM::Eyy]*(*pp)[MPM::Eyy] + (*pp)[MPM::Ezz]*(*pp)[MPM::Ezz] +
-        2.0*((*pp)[MPM::Exy]*(*pp)[MPM::Exy] + (*pp)[MPM::Exz]*(*pp)[MPM::Exz] +
-             (*pp)[MPM::Eyz]*(*pp)[MPM::Eyz])));
-    MPM_FLOAT I_3 = (*pp)[MPM::Exx]*(*pp)[MPM::Eyy]*(*pp)[MPM::Ezz] + 
-        2.0*(*pp)[MPM::Exy]*(*pp)[MPM::Eyz]*(*pp)[MPM::Exz] - 
-            (*pp)[MPM::Exx]*(*pp)[MPM::Eyz]*(*pp)[MPM::Eyz] - 
-            (*pp)[MPM::Eyy]*(*pp)[MPM::Exz]*(*pp)[MPM::Exz] - 
-            (*pp)[MPM::Ezz]*(*pp)[MPM::Exy]*(*pp)[MPM::Exy];
-              
-    CubicFunctionRoots(1.0, -I_1, -I_2, -I_3, principle_strain);
-    bool failure;
-    MPM_FLOAT min_principle_strain = *min_element(principle_strain.begin(), principle_strain.end());
-    MPM_FLOAT max_principle_strain = *max_element(principle_strain.begin(), principle_strain.end());
-    MPM_FLOAT max_shear_strain = (max_principle_strain - min_principle_strain)*0.5;
-    if (_min_principle_strain < -MPM_EPSILON &&
-        min_principle_strain < -MPM_EPSILON &&
-        min_principle_strain < _min_principle_strain)
-        failure = true;
-
-    if (_max_principle_strain > MPM_EPSILON &&
-        max_principle_strain > MPM_EPSILON && 
-        max_principle_strain > _min_principle_strain)
-        failure = true;
-
-    if (_max_shear_strain > MPM_EPSILON &&
-        max_shear_strain > MPM_EPSILON && 
-        max_shear_strain > _max_shear_strain)
-        failure = true;
-
-    if (failure)
+    PhysicalProperty& p = *pp;
+
+    //!> No limit can be exceeded if the bounds of principle strain are within the limits
+    MPM_FLOAT lower, upper;
+    SymmetricEigenvalueBounds(p[MPM::Exx], p[MPM::Eyy], p[MPM::Ezz], p[MPM::Eyz], p[MPM::Exz], p[MPM::Exy],
+        lower, upper);
+    if (!PrincipalLimitExceeded(lower, upper, _min_principle_strain, _max_principle_strain, _max_shear_strain))
+        return false;
+
+    MPM_FLOAT max_principle_strain, mid_principle_strain, min_principle_strain;
+    SymmetricEigenvalues(p[MPM::Exx], p[MPM::Eyy], p[MPM::Ezz], p[MPM::Eyz], p[MPM::Exz], p[MPM::Exy],
+        max_principle_strain, mid_principle_strain, min_principle_strain);
+
+    if (PrincipalLimitExceeded(min_principle_strain, max_principle_strain, 
+        _min_principle_strain, _max_principle_strain, _max_shear_strain))
     {
         pp->Failed();
         if(Erosion)
@@ -83,6 +66,40 @@ bool Failure_PriStrain::CheckFailure(PhysicalProperty* pp, map<string, MPM_FLOAT
     return pp->is_Failed();
 }
 
+void Failure_PriStrain::CheckFailureBatch(PhysicalProperty* pp, DataTransfer* transfer, MPM_STATS number)
+{
+    const MPM::ExtraParticleProperty component[6] = {MPM::Exx, MPM::Eyy, MPM::Ezz, MPM::Eyz, MPM::Exz, MPM::Exy};
+    alignas(MPM::MemoryAlignment) MPM_FLOAT strain[6][MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) bool failure[MPM::ParticleChunkSize];
+    Failure_Batch batch;
+    for (int k = 0; k < 6; k++)
+        batch.tensor[k] = strain[k];
+    batch.failure = failure;
+
+    for (MPM_STATS start = 0; start < number; start += MPM::ParticleChunkSize)
+    {
+        batch.number = min(number - start, MPM::ParticleChunkSize);
+        PhysicalProperty* chunk_pp = pp + start;
+        for (MPM_STATS i = 0; i < batch.number; i++)
+        {
+            for (int k = 0; k < 6; k++)
+                strain[k][i] = chunk_pp[i][component[k]];
+        }
+
+        PrincipalFailureBatch(batch, _min_principle_strain, _max_principle_strain, _max_shear_strain);
+
+        for (MPM_STATS i = 0; i < batch.number; i++)
+        {
+            if (failure[i] && !chunk_pp[i].is_Failed())
+            {
+                chunk_pp[i].Failed();
+                if(Erosion)
+                    chunk_pp[i].Eroded();
+            }
+        }
+    }
+}
+
 void Failure_PriStrain::Write(ofstream &os)
 {
     os << "Failure model: " << Type << endl;
@@ -121,7 +138,7 @@ bool Failure_PriStrain::Initialize(map<string, MPM_FLOAT> &failure_para)
 }
 
 bool Failure_PriStrain::AddExtraParticleProperty_Failure(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer)
+        DataTransfer& transfer)
 {
     ExtraProp.push_back(MPM::Exx);
     ExtraProp.push_back(MPM::Exy);
@@ -31,7 +31,11 @@ public:
     ~Failure_PriStrain();
 
     //!> Identify if the particle fails according to its physical property
-    virtual bool CheckFailure(PhysicalProperty* pp, map<string, MPM_FLOAT>& transfer);
+    virtual bool CheckFailure(PhysicalProperty* pp, DataTransfer& transfer);
+
+    //!> Principal values are solved only for particles whose bounds exceed any limit, see "Failure_BatchKernel.h"
+    virtual void CheckFailureBatch(PhysicalProperty* pp, DataTransfer* transfer, MPM_STATS number);
+    virtual bool HasBatchKernel() {return true;}
 
     //!> Write failure model information into file
     virtual void Write(ofstream &os);
@@ -41,7 +45,7 @@ public:
 
     //!> Add extra particle properties based on different failure model
     virtual bool AddExtraParticleProperty_Failure(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer);
+        DataTransfer& transfer);
 private:
     //!> Threshold of principle strain
     MPM_FLOAT _min_principle_strain;
@@ -19,6 +19,8 @@
 ==============================================================*/
 
 #include "Failure_PriStress.h"
+#include "Failure_BatchKernel.h"
+#include "../../utility/MathFunctionList.h"
 
 Failure_PriStress::Failure_PriStress()
 {
@@ -36,33 +38,29 @@ Failure_PriStress::~Failure_PriStress()
 {
 }
 
-bool Failure_PriStress::CheckFailure(PhysicalProperty* pp, map<string, MPM_FLOAT>& transfer)
+bool Failure_PriStress::CheckFailure(PhysicalProperty* pp, DataTransfer& transfer)
 {
     if (pp->is_Failed()) 
         return true;
 
-    Array3D principle_stress = pp->CalculatePrincipleStress();
-    MPM_FLOAT min_principle_stress = *min_element(principle_stress.begin(), principle_stress.end());
-    MPM_FLOAT max_principle_stress = *max_element(principle_stress.begin(), principle_stress.end());
-    MPM_FLOAT max_shear_stress = (max_principle_stress - min_principle_stress)*0.5;
+    SymTensor sd = pp->GetDeviatoricStress();
+    MPM_FLOAT pressure_part = pp->GetMeanStress() - pp->GetBulkViscosity();
+    MPM_FLOAT stress_x = sd[0] + pressure_part;
+    MPM_FLOAT stress_y = sd[1] + pressure_part;
+    MPM_FLOAT stress_z = sd[2] + pressure_part;
 
-    bool failure = false;
-    if (_min_principle_stress < -MPM_EPSILON &&
-        min_principle_stress < -MPM_EPSILON &&
-        min_principle_stress < _min_principle_stress)
-        failure = true;
-    
-    if (_max_principle_stress > MPM_EPSILON &&
-        max_principle_stress > MPM_EPSILON &&
-        max_principle_stress > _max_principle_stress)
-        failure = true;
-
-    if (_max_shear_stress > MPM_EPSILON &&
-        max_shear_stress > MPM_EPSILON &&
-        max_shear_stress > _max_shear_stress)
-        failure = true;
+    //!> No limit can be exceeded if the bounds of principle stress are within the limits
+    MPM_FLOAT lower, upper;
+    SymmetricEigenvalueBounds(stress_x, stress_y, stress_z, sd[3], sd[4], sd[5], lower, upper);
+    if (!PrincipalLimitExceeded(lower, upper, _min_principle_stress, _max_principle_stress, _max_shear_stress))
+        return false;
+
+    MPM_FLOAT max_principle_stress, mid_principle_stress, min_principle_stress;
+    SymmetricEigenvalues(stress_x, stress_y, stress_z, sd[3], sd[4], sd[5], 
+        max_principle_stress, mid_principle_stress, min_principle_stress);
     
-    if (failure)
+    if (PrincipalLimitExceeded(min_principle_stress, max_principle_stress, 
+        _min_principle_stress, _max_principle_stress, _max_shear_stress))
     {
         pp->Failed();
         if(Erosion)
@@ -71,6 +69,45 @@ bool Failure_PriStress::CheckFailure(PhysicalProperty* pp, map<string, MPM_FLOAT
     return pp->is_Failed();
 }
 
+void Failure_PriStress::CheckFailureBatch(PhysicalProperty* pp, DataTransfer* transfer, MPM_STATS number)
+{
+    alignas(MPM::MemoryAlignment) MPM_FLOAT stress[6][MPM::ParticleChunkSize];
+    alignas(MPM::MemoryAlignment) bool failure[MPM::ParticleChunkSize];
+    Failure_Batch batch;
+    for (int k = 0; k < 6; k++)
+        batch.tensor[k] = stress[k];
+    batch.failure = failure;
+
+    for (MPM_STATS start = 0; start < number; start += MPM::ParticleChunkSize)
+    {
+        batch.number = min(number - start, MPM::ParticleChunkSize);
+        PhysicalProperty* chunk_pp = pp + start;
+        for (MPM_STATS i = 0; i < batch.number; i++)
+        {
+            SymTensor sd = chunk_pp[i].GetDeviatoricStress();
+            MPM_FLOAT pressure_part = chunk_pp[i].GetMeanStress() - chunk_pp[i].GetBulkViscosity();
+            stress[0][i] = sd[0] + pressure_part;
+            stress[1][i] = sd[1] + pressure_part;
+            stress[2][i] = sd[2] + pressure_part;
+            stress[3][i] = sd[3];
+            stress[4][i] = sd[4];
+            stress[5][i] = sd[5];
+        }
+
+        PrincipalFailureBatch(batch, _min_principle_stress, _max_principle_stress, _max_shear_stress);
+
+        for (MPM_STATS i = 0; i < batch.number; i++)
+        {
+            if (failure[i] && !chunk_pp[i].is_Failed())
+            {
+                chunk_pp[i].Failed();
+                if(Erosion)
+                    chunk_pp[i].Eroded();
+            }
+        }
+    }
+}
+
 void Failure_PriStress::Write(ofstream &os)
 {
     os << "Failure model: " << Type << endl;
@@ -31,7 +31,11 @@ public:
     ~Failure_PriStress();
 
     //!> Identify if the particle fails according to its physical property
-    virtual bool CheckFailure(PhysicalProperty* pp, map<string, MPM_FLOAT>& transfer);
+    virtual bool CheckFailure(PhysicalProperty* pp, DataTransfer& transfer);
+
+    //!> Principal values are solved only for particles whose bounds exceed any limit, see "Failure_BatchKernel.h"
+    virtual void CheckFailureBatch(PhysicalProperty* pp, DataTransfer* transfer, MPM_STATS number);
+    virtual bool HasBatchKernel() {return true;}
 
     //!> Write failure model information into file
     virtual void Write(ofstream &os);
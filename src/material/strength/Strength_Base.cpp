@@ -25,6 +25,7 @@ Strength_Base::Strength_Base()
     Type = "";
     _density_0 = 0.0;
     _compute_temperature = false;
+    _fast_math = false;
 }
 
 Strength_Base::~Strength_Base()
@@ -55,8 +56,13 @@ bool Strength_Base::Initialize(map<string, MPM_FLOAT> &strength_para, MPM_FLOAT
     return true;
 }
 
+void Strength_Base::UpdateDeviatoricStressBatch(Strength_Batch& batch)
+{
+    // No batch kernel, see "HasBatchKernel"
+}
+
 bool Strength_Base::AddExtraParticleProperty_Strength(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer)
+        DataTransfer& transfer)
 {
     // Nothing to be added
     return true;
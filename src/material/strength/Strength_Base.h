@@ -24,15 +24,47 @@
 
 #include "../../main/MPM3D_MACRO.h"
 #include "../../body/PhysicalProperty.h"
+#include "../DataTransfer.h"
+#include "../../utility/mathfunction/FastMath.h"
+
+//!> Particle data packed into arrays for the batch strength kernels, each array has "number" entries
+struct Strength_Batch
+{
+    MPM_STATS number;
+    const MPM_FLOAT* delta_strain[6];
+    MPM_FLOAT* deviatoric_stress[6];    //!< input and output
+    MPM_FLOAT* equivalent_stress;       //!< output
+    const MPM_FLOAT* mean_stress;
+    const MPM_FLOAT* bulk_viscosity;
+    bool* failure;                      //!< input and output
+
+    //!> Extra particle properties, nullptr if not enabled
+    MPM_FLOAT* epeff;
+    MPM_FLOAT* sigma_y;
+    MPM_FLOAT* kelvin;
+    MPM_FLOAT* damage;
+
+    //!> Output of "DataTransfer", initialized as "DataTransfer::Reset"
+    bool* yield;
+    MPM_FLOAT* depeff;
+    MPM_FLOAT* lsrate;
+    MPM_FLOAT* tstar;
+
+    //!> Time steps and current time of the simulation
+    const SimulationContext* context;
+};
 
 class Strength_Base
 {
 public:
     Strength_Base();
-    ~Strength_Base();
+    virtual ~Strength_Base();
 
     inline string GetName() {return Type;}
 
+    //!> Use polynomial approximations of pow/log/exp, set by the material parameter "FastMath"
+    inline void SetFastMath(bool fast_math) {_fast_math = fast_math;}
+
     //!> Initial the strength model with parameters' map
     virtual bool Initialize(map<string, MPM_FLOAT> &strength_para, MPM_FLOAT rho0);
 
@@ -40,13 +72,19 @@ public:
     virtual void Write(ofstream &os) = 0;
 
     //!> Update the deviatoric stress of the particle
-    //!> the map named transfer is used to tansfer data between Strength/EOS/Failure model
+    //!> the record named transfer is used to tansfer data between Strength/EOS/Failure model
     virtual void UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor& delta_strain, 
-        SymTensor& delta_vortex, map<string, MPM_FLOAT>& transfer) = 0;
+        SymTensor& delta_vortex, DataTransfer& transfer) = 0;
+
+    //!> Vectorized version of "UpdateDeviatoricStress" on packed arrays with the same results
+    //!> Only called when "HasBatchKernel" is true, a model overriding "UpdateDeviatoricStress" 
+    //!>    should override both of them
+    virtual void UpdateDeviatoricStressBatch(Strength_Batch& batch);
+    virtual bool HasBatchKernel() {return false;}
 
     //!> Update the pressure of the particle with elastic assumption
     virtual void ElasticPressure(PhysicalProperty* pp, MPM_FLOAT delta_vol,
-        map<string, MPM_FLOAT>& transfer) = 0;
+        DataTransfer& transfer) = 0;
 
     //!> Calculate the squared adabatic sound speed of deviatoric part
     virtual MPM_FLOAT SoundSpeedSquare_Strength(PhysicalProperty* pp) = 0;
@@ -56,19 +94,23 @@ public:
 
     //!> Update the temperature of the particle
     virtual void UpdateTemperature(PhysicalProperty* pp, MPM_FLOAT delta_vol,
-        map<string, MPM_FLOAT>& transfer) = 0;
+        DataTransfer& transfer) = 0;
 
     //!> Modify the mean stress with temperature coefficient
     virtual void ModifyPressureByTemperature(PhysicalProperty* pp) = 0;
 
     //!> Add extra particle properties based on different strength model
     virtual bool AddExtraParticleProperty_Strength(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer);
+        DataTransfer& transfer);
 protected:
     string Type;
     MPM_FLOAT _density_0;       //!< initial density
 
     bool _compute_temperature;  //!< Whether to update temperature or not
+    bool _fast_math;            //!< Whether to use "FastPow" and "FastLog"
+
+    inline MPM_FLOAT _Pow(MPM_FLOAT x, MPM_FLOAT y) {return _fast_math ? FastPow(x, y) : pow(x, y);}
+    inline MPM_FLOAT _Log(MPM_FLOAT x) {return _fast_math ? FastLog(x) : log(x);}
 
     //!> Parameter list for initialization
     map<string, MPM_FLOAT*> ParameterMap_Strength;
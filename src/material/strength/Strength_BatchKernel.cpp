@@ -0,0 +1,268 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of vectorized radial return kernels
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "Strength_BatchKernel.h"
+#include "../../utility/mathfunction/FastMath.h"
+
+//!> Trial stress of one lane, same as "Strength_Isotropic::_ElasticDeviatoricStress" 
+//!>    and "PhysicalProperty::EquivalentStress"
+static inline void ElasticTrial(MPM_FLOAT shear_modulus, MPM_FLOAT d0, MPM_FLOAT d1, MPM_FLOAT d2,
+    MPM_FLOAT d3, MPM_FLOAT d4, MPM_FLOAT d5, MPM_FLOAT& s0, MPM_FLOAT& s1, MPM_FLOAT& s2,
+    MPM_FLOAT& s3, MPM_FLOAT& s4, MPM_FLOAT& s5, MPM_FLOAT& seqv)
+{
+    MPM_FLOAT delta_strain_mean = (d0 + d1 + d2)/3.0;
+
+    s0 += 2.0*shear_modulus*(d0 - delta_strain_mean);
+    s1 += 2.0*shear_modulus*(d1 - delta_strain_mean);
+    s2 += 2.0*shear_modulus*(d2 - delta_strain_mean);
+    s3 += shear_modulus*d3;
+    s4 += shear_modulus*d4;
+    s5 += shear_modulus*d5;
+
+    MPM_FLOAT J2 = 0.5*(s0*s0 + s1*s1 + s2*s2) + s3*s3 + s4*s4 + s5*s5;
+    seqv = sqrt(J2*3.0);
+}
+
+MPM_TARGET_CLONES
+void ElasticTrialBatch(Strength_Batch& batch, MPM_FLOAT shear_modulus)
+{
+    const MPM_STATS number = batch.number;
+    const MPM_FLOAT* MPM_RESTRICT d0 = batch.delta_strain[0];
+    const MPM_FLOAT* MPM_RESTRICT d1 = batch.delta_strain[1];
+    const MPM_FLOAT* MPM_RESTRICT d2 = batch.delta_strain[2];
+    const MPM_FLOAT* MPM_RESTRICT d3 = batch.delta_strain[3];
+    const MPM_FLOAT* MPM_RESTRICT d4 = batch.delta_strain[4];
+    const MPM_FLOAT* MPM_RESTRICT d5 = batch.delta_strain[5];
+    MPM_FLOAT* MPM_RESTRICT s0 = batch.deviatoric_stress[0];
+    MPM_FLOAT* MPM_RESTRICT s1 = batch.deviatoric_stress[1];
+    MPM_FLOAT* MPM_RESTRICT s2 = batch.deviatoric_stress[2];
+    MPM_FLOAT* MPM_RESTRICT s3 = batch.deviatoric_stress[3];
+    MPM_FLOAT* MPM_RESTRICT s4 = batch.deviatoric_stress[4];
+    MPM_FLOAT* MPM_RESTRICT s5 = batch.deviatoric_stress[5];
+    MPM_FLOAT* MPM_RESTRICT seqv = batch.equivalent_stress;
+
+    MPM_IVDEP
+    for (MPM_STATS i = 0; i < number; i++)
+        ElasticTrial(shear_modulus, d0[i], d1[i], d2[i], d3[i], d4[i], d5[i],
+            s0[i], s1[i], s2[i], s3[i], s4[i], s5[i], seqv[i]);
+}
+
+MPM_TARGET_CLONES
+void DamageElasticTrialBatch(Strength_Batch& batch, MPM_FLOAT shear_modulus)
+{
+    const MPM_STATS number = batch.number;
+    const MPM_FLOAT* MPM_RESTRICT d0 = batch.delta_strain[0];
+    const MPM_FLOAT* MPM_RESTRICT d1 = batch.delta_strain[1];
+    const MPM_FLOAT* MPM_RESTRICT d2 = batch.delta_strain[2];
+    const MPM_FLOAT* MPM_RESTRICT d3 = batch.delta_strain[3];
+    const MPM_FLOAT* MPM_RESTRICT d4 = batch.delta_strain[4];
+    const MPM_FLOAT* MPM_RESTRICT d5 = batch.delta_strain[5];
+    MPM_FLOAT* MPM_RESTRICT s0 = batch.deviatoric_stress[0];
+    MPM_FLOAT* MPM_RESTRICT s1 = batch.deviatoric_stress[1];
+    MPM_FLOAT* MPM_RESTRICT s2 = batch.deviatoric_stress[2];
+    MPM_FLOAT* MPM_RESTRICT s3 = batch.deviatoric_stress[3];
+    MPM_FLOAT* MPM_RESTRICT s4 = batch.deviatoric_stress[4];
+    MPM_FLOAT* MPM_RESTRICT s5 = batch.deviatoric_stress[5];
+    MPM_FLOAT* MPM_RESTRICT seqv = batch.equivalent_stress;
+    const MPM_FLOAT* MPM_RESTRICT mean_stress = batch.mean_stress;
+    const MPM_FLOAT* MPM_RESTRICT bulk_viscosity = batch.bulk_viscosity;
+    const MPM_FLOAT* MPM_RESTRICT damage = batch.damage;
+
+    MPM_IVDEP
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        bool tension = mean_stress[i] - bulk_viscosity[i] >= -MPM_EPSILON;
+        MPM_FLOAT damage_shear_modulus = tension ? shear_modulus*(1 - damage[i]) : shear_modulus;
+        ElasticTrial(damage_shear_modulus, d0[i], d1[i], d2[i], d3[i], d4[i], d5[i],
+            s0[i], s1[i], s2[i], s3[i], s4[i], s5[i], seqv[i]);
+    }
+}
+
+MPM_TARGET_CLONES
+void ElaPlasticReturnBatch(Strength_Batch& batch, MPM_FLOAT shear_modulus, MPM_FLOAT yield_0)
+{
+    const MPM_STATS number = batch.number;
+    MPM_FLOAT* MPM_RESTRICT s0 = batch.deviatoric_stress[0];
+    MPM_FLOAT* MPM_RESTRICT s1 = batch.deviatoric_stress[1];
+    MPM_FLOAT* MPM_RESTRICT s2 = batch.deviatoric_stress[2];
+    MPM_FLOAT* MPM_RESTRICT s3 = batch.deviatoric_stress[3];
+    MPM_FLOAT* MPM_RESTRICT s4 = batch.deviatoric_stress[4];
+    MPM_FLOAT* MPM_RESTRICT s5 = batch.deviatoric_stress[5];
+    MPM_FLOAT* MPM_RESTRICT seqv = batch.equivalent_stress;
+    MPM_FLOAT* MPM_RESTRICT epeff = batch.epeff;
+    const MPM_FLOAT* MPM_RESTRICT sigma_y = batch.sigma_y;
+    unsigned char* MPM_RESTRICT yield = MaskView(batch.yield);
+    MPM_FLOAT* MPM_RESTRICT depeff = batch.depeff;
+
+    MPM_IVDEP
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        bool yield_i = seqv[i] > yield_0;
+        MPM_FLOAT depeff_i = (seqv[i] - sigma_y[i])/(3.0*shear_modulus);
+        MPM_FLOAT ratio = yield_0/seqv[i];
+
+        epeff[i] = yield_i ? epeff[i] + depeff_i : epeff[i];
+        s0[i] = yield_i ? s0[i]*ratio : s0[i];
+        s1[i] = yield_i ? s1[i]*ratio : s1[i];
+        s2[i] = yield_i ? s2[i]*ratio : s2[i];
+        s3[i] = yield_i ? s3[i]*ratio : s3[i];
+        s4[i] = yield_i ? s4[i]*ratio : s4[i];
+        s5[i] = yield_i ? s5[i]*ratio : s5[i];
+        seqv[i] = yield_i ? seqv[i]*ratio : seqv[i];
+
+        yield[i] = yield_i;
+        depeff[i] = yield_i ? depeff_i : 0.0;
+    }
+}
+
+MPM_TARGET_CLONES
+void IsoHardenReturnBatch(Strength_Batch& batch, MPM_FLOAT shear_modulus, MPM_FLOAT plastic_modulus, 
+    MPM_FLOAT yield_0)
+{
+    const MPM_STATS number = batch.number;
+    MPM_FLOAT* MPM_RESTRICT s0 = batch.deviatoric_stress[0];
+    MPM_FLOAT* MPM_RESTRICT s1 = batch.deviatoric_stress[1];
+    MPM_FLOAT* MPM_RESTRICT s2 = batch.deviatoric_stress[2];
+    MPM_FLOAT* MPM_RESTRICT s3 = batch.deviatoric_stress[3];
+    MPM_FLOAT* MPM_RESTRICT s4 = batch.deviatoric_stress[4];
+    MPM_FLOAT* MPM_RESTRICT s5 = batch.deviatoric_stress[5];
+    MPM_FLOAT* MPM_RESTRICT seqv = batch.equivalent_stress;
+    MPM_FLOAT* MPM_RESTRICT epeff = batch.epeff;
+    MPM_FLOAT* MPM_RESTRICT sigma_y = batch.sigma_y;
+    unsigned char* MPM_RESTRICT yield = MaskView(batch.yield);
+    MPM_FLOAT* MPM_RESTRICT depeff = batch.depeff;
+
+    MPM_IVDEP
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        bool plastic = seqv[i] > yield_0;     //!< when the yield condition is violated
+        MPM_FLOAT depeff_i = (seqv[i] - sigma_y[i])/(3.0*shear_modulus + plastic_modulus);
+        MPM_FLOAT sigma_y_i = sigma_y[i] + plastic_modulus*depeff_i;
+        MPM_FLOAT ratio = sigma_y_i/seqv[i];
+        bool yield_i = plastic && ratio < 1.0;
+
+        epeff[i] = plastic ? epeff[i] + depeff_i : epeff[i];
+        sigma_y[i] = plastic ? sigma_y_i : sigma_y[i];
+        s0[i] = yield_i ? s0[i]*ratio : s0[i];
+        s1[i] = yield_i ? s1[i]*ratio : s1[i];
+        s2[i] = yield_i ? s2[i]*ratio : s2[i];
+        s3[i] = yield_i ? s3[i]*ratio : s3[i];
+        s4[i] = yield_i ? s4[i]*ratio : s4[i];
+        s5[i] = yield_i ? s5[i]*ratio : s5[i];
+        seqv[i] = yield_i ? sigma_y_i : seqv[i];
+
+        yield[i] = yield_i;
+        depeff[i] = plastic ? depeff_i : 0.0;
+    }
+}
+
+MPM_TARGET_CLONES
+void RadialReturnBatch(Strength_Batch& batch)
+{
+    const MPM_STATS number = batch.number;
+    MPM_FLOAT* MPM_RESTRICT s0 = batch.deviatoric_stress[0];
+    MPM_FLOAT* MPM_RESTRICT s1 = batch.deviatoric_stress[1];
+    MPM_FLOAT* MPM_RESTRICT s2 = batch.deviatoric_stress[2];
+    MPM_FLOAT* MPM_RESTRICT s3 = batch.deviatoric_stress[3];
+    MPM_FLOAT* MPM_RESTRICT s4 = batch.deviatoric_stress[4];
+    MPM_FLOAT* MPM_RESTRICT s5 = batch.deviatoric_stress[5];
+    MPM_FLOAT* MPM_RESTRICT seqv = batch.equivalent_stress;
+    const MPM_FLOAT* MPM_RESTRICT sigma_y = batch.sigma_y;
+    const unsigned char* MPM_RESTRICT yield = MaskView(batch.yield);
+
+    MPM_IVDEP
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        MPM_FLOAT ratio = sigma_y[i]/seqv[i];
+        s0[i] = yield[i] != 0 ? s0[i]*ratio : s0[i];
+        s1[i] = yield[i] != 0 ? s1[i]*ratio : s1[i];
+        s2[i] = yield[i] != 0 ? s2[i]*ratio : s2[i];
+        s3[i] = yield[i] != 0 ? s3[i]*ratio : s3[i];
+        s4[i] = yield[i] != 0 ? s4[i]*ratio : s4[i];
+        s5[i] = yield[i] != 0 ? s5[i]*ratio : s5[i];
+        seqv[i] = yield[i] != 0 ? sigma_y[i] : seqv[i];
+    }
+}
+
+MPM_TARGET_CLONES
+void JohnsonCookFastReturnBatch(Strength_Batch& batch, const JohnsonCook_Parameter& jc)
+{
+    const MPM_STATS number = batch.number;
+    const MPM_FLOAT* MPM_RESTRICT seqv = batch.equivalent_stress;
+    MPM_FLOAT* MPM_RESTRICT epeff = batch.epeff;
+    MPM_FLOAT* MPM_RESTRICT sigma_y = batch.sigma_y;
+    unsigned char* MPM_RESTRICT failure = MaskView(batch.failure);
+    unsigned char* MPM_RESTRICT yield = MaskView(batch.yield);
+    MPM_FLOAT* MPM_RESTRICT depeff = batch.depeff;
+    MPM_FLOAT* MPM_RESTRICT lsrate = batch.lsrate;
+    MPM_FLOAT* MPM_RESTRICT tstar = batch.tstar;
+    //!> Any finite values when not thermal, the result is multiplied by zero
+    const MPM_FLOAT* MPM_RESTRICT kelvin = jc.thermal ? batch.kelvin : batch.equivalent_stress;
+
+    const MPM_FLOAT shear_modulus = jc.shear_modulus;
+    const MPM_FLOAT yield_0 = jc.yield_0;
+    const MPM_FLOAT B = jc.B;
+    const MPM_FLOAT n = jc.n;
+    const MPM_FLOAT C = jc.C;
+    const MPM_FLOAT m = jc.m;
+    const MPM_FLOAT epso = jc.epso;
+    const MPM_FLOAT dt = jc.dt;
+    const MPM_FLOAT room_temperature = jc.room_temperature;
+    const MPM_FLOAT melt_temperature = jc.melt_temperature;
+
+    //!> Loop invariant switches as factors, GCC does not vectorize a select on a scalar bool
+    const MPM_FLOAT thermal_factor = jc.thermal ? 1.0 : 0.0;
+    const MPM_FLOAT melt_tstar = jc.thermal ? 1.0 : numeric_limits<MPM_FLOAT>::max();
+
+    MPM_IVDEP
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        bool plastic = seqv[i] > sigma_y[i];
+
+        MPM_FLOAT tstar_i = (kelvin[i] - room_temperature)/(melt_temperature - room_temperature);
+        bool melt = tstar_i > melt_tstar;
+        tstar_i = tstar_i > 1.0 ? 1.0 : tstar_i;
+        tstar_i = tstar_i < -MPM_EPSILON ? 0.0 : tstar_i;
+
+        MPM_FLOAT epeff_i = epeff[i] + 0.0001;    //!< avoid zero
+        MPM_FLOAT plastic_modulus = B*n*FastPow(epeff_i, n-1);
+        epeff_i -= 0.0001;
+        MPM_FLOAT depeff_i = (seqv[i] - sigma_y[i])/(3.0*shear_modulus + plastic_modulus);
+        epeff_i += depeff_i;
+
+        MPM_FLOAT srate = depeff_i/epso/dt;
+        srate = srate < 1.0 ? 1.0 : srate;
+        MPM_FLOAT lsrate_i = FastLog(srate);
+        MPM_FLOAT sigma_y_i = (yield_0 + B*FastPow(epeff_i, n))*(1 + C*lsrate_i)*
+            (1 - thermal_factor*FastPow(tstar_i, m));
+
+        bool elastic = sigma_y_i > seqv[i];     //!< the new yield stress is not reached
+        epeff_i = elastic ? epeff_i - depeff_i : epeff_i;
+        depeff_i = elastic ? 0.0 : depeff_i;
+
+        epeff[i] = plastic ? epeff_i : epeff[i];
+        sigma_y[i] = plastic ? sigma_y_i : sigma_y[i];
+        failure[i] = failure[i] | (unsigned char)(plastic && melt);
+        yield[i] = plastic && !elastic ? 1 : 0;
+        depeff[i] = plastic ? depeff_i : 0.0;
+        lsrate[i] = plastic ? thermal_factor*lsrate_i : 0.0;
+        tstar[i] = plastic ? thermal_factor*tstar_i : 0.0;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Vectorized radial return kernels of the isotropic
+        plasticity family on packed arrays. The yield check is
+        a per-lane mask and the scale-back is selected by it,
+        so all lanes run the same instructions. Operations are
+        in the same order as the particle versions and the file
+        is compiled without FMA contraction, so the results are
+        bitwise identical to "UpdateDeviatoricStress".
+        Definitions are compiled for several instruction sets,
+        selected at runtime, see "utility/SIMD.h".
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _STRENGTH_BATCHKERNEL_H_
+#define _STRENGTH_BATCHKERNEL_H_
+
+#include "Strength_Base.h"
+#include "../../utility/SIMD.h"
+
+//!> Elastic trial stress and equivalent stress, same as "Strength_Isotropic::_ElasticDeviatoricStress"
+void ElasticTrialBatch(Strength_Batch& batch, MPM_FLOAT shear_modulus);
+
+//!> Elastic trial stress with damaged shear modulus in tension, same as "Strength_Isotropic::_DamageDeviatoricStress"
+void DamageElasticTrialBatch(Strength_Batch& batch, MPM_FLOAT shear_modulus);
+
+//!> Yield check and scale-back of elastic-perfectly plasticity
+void ElaPlasticReturnBatch(Strength_Batch& batch, MPM_FLOAT shear_modulus, MPM_FLOAT yield_0);
+
+//!> Yield check, linear hardening and scale-back of isotropic hardening plasticity
+void IsoHardenReturnBatch(Strength_Batch& batch, MPM_FLOAT shear_modulus, MPM_FLOAT plastic_modulus, 
+    MPM_FLOAT yield_0);
+
+//!> Scale the stress back to "sigma_y" for the lanes with "yield"
+void RadialReturnBatch(Strength_Batch& batch);
+
+//!> Parameters of "JohnsonCookFastReturnBatch"
+struct JohnsonCook_Parameter
+{
+    MPM_FLOAT shear_modulus, yield_0;
+    MPM_FLOAT B, n, C, m;
+    MPM_FLOAT epso, dt;
+    MPM_FLOAT room_temperature, melt_temperature;
+    bool thermal;       //!< false for the simplified model without thermal softening and melting
+};
+
+//!> Johnson-Cook plastic correction of all lanes with "FastPow" and "FastLog", selected by the 
+//!>    yield check. Same results as "_ReturnMapping" of the models with "FastMath"
+void JohnsonCookFastReturnBatch(Strength_Batch& batch, const JohnsonCook_Parameter& jc);
+
+#endif
@@ -19,7 +19,6 @@
 ==============================================================*/
 
 #include "Strength_DruckerPrager.h"
-#include "../../solver/Solver_Base.h"
 
 Strength_DruckerPrager::Strength_DruckerPrager()
 {
@@ -48,7 +47,7 @@ void Strength_DruckerPrager::Write(ofstream& os)
 }
 
 void Strength_DruckerPrager::UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor& delta_strain,
-    SymTensor& delta_vortex, map<string, MPM_FLOAT>& transfer)
+    SymTensor& delta_vortex, DataTransfer& transfer)
 {
     _ElasticDeviatoricStress(pp, delta_strain);
     pp->EquivalentStress();
@@ -75,13 +74,13 @@ void Strength_DruckerPrager::UpdateDeviatoricStress(PhysicalProperty* pp, SymTen
     MPM_FLOAT _DP_hfai = 0.0;
     MPM_FLOAT _Tau_p = 0.0;
     MPM_FLOAT _alpha_p = 0.0;
-    transfer["yield"] = -1.0;
+    transfer.yield = false;
     if (_DP_sig <-MPM_EPSILON)
     {
         if (_DP_Fi > MPM_EPSILON)
         {
             iplas = 1;
-            transfer["yield"] = 1.0;
+            transfer.yield = true;
             _dlamd = _DP_Fi / (_G_modulus + _K_modulus * _q_fai * _q_psi);
             _new_mean_stress = _new_mean_stress - _K_modulus * _q_psi * _dlamd;
             _new_Tau = _k_fai - _q_fai * _new_mean_stress;
@@ -92,7 +91,7 @@ void Strength_DruckerPrager::UpdateDeviatoricStress(PhysicalProperty* pp, SymTen
             pp->SetMeanStress(_new_mean_stress);
 
             depeff = _dlamd * sqrt(1.0 / 3.0 + (2.0 / 9.0) * pow(_q_psi, 2));
-            transfer["depeff"] = depeff;
+            transfer.depeff = depeff;
             (*pp)[MPM::epeff] += depeff;
         }
     }
@@ -105,7 +104,7 @@ void Strength_DruckerPrager::UpdateDeviatoricStress(PhysicalProperty* pp, SymTen
         if (_DP_hfai > MPM_EPSILON) // same as _DP_Fi > 0.0
         {
             iplas = 1;
-            transfer["yield"] = 1.0;
+            transfer.yield = true;
             _dlamd = _DP_Fi / (_G_modulus + _K_modulus * _q_fai * _q_psi);
             _new_mean_stress = _new_mean_stress - _K_modulus * _q_psi * _dlamd;
             _new_Tau = _k_fai - _q_fai * _new_mean_stress;
@@ -116,18 +115,18 @@ void Strength_DruckerPrager::UpdateDeviatoricStress(PhysicalProperty* pp, SymTen
             pp->SetMeanStress(_new_mean_stress);
 
             depeff = _dlamd * sqrt(1.0 / 3.0 + (2.0 / 9.0) * pow(_q_psi, 2));
-            transfer["depeff"] = depeff;
+            transfer.depeff = depeff;
             (*pp)[MPM::epeff] += depeff;
         }
         else // _DP_hfai <= 0.0
         {
             iplas = 2;
-            transfer["yield"] = 1.0;
+            transfer.yield = true;
             _dlamd = (_new_mean_stress - tenf) / _K_modulus;
             pp->SetMeanStress(tenf); // update Mean Stress only
             
             depeff = _dlamd * (1.0 / 3.0) * sqrt(2.0);
-            transfer["depeff"] = depeff;
+            transfer.depeff = depeff;
             (*pp)[MPM::epeff] += depeff;
         }
     }
@@ -135,7 +134,7 @@ void Strength_DruckerPrager::UpdateDeviatoricStress(PhysicalProperty* pp, SymTen
 }
 
 void Strength_DruckerPrager::ElasticPressure(PhysicalProperty* pp, MPM_FLOAT delta_vol,
-    map<string, MPM_FLOAT>& transfer)
+    DataTransfer& transfer)
 {
     _ElasticPressure(pp, delta_vol);
 }
\ No newline at end of file
@@ -36,11 +36,14 @@ public:
 
     //!> Update the deviatoric stress of the particle
     virtual void UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor& delta_strain,
-        SymTensor& delta_vortex, map<string, MPM_FLOAT>& transfer);
+        SymTensor& delta_vortex, DataTransfer& transfer);
+
+    //!> No batch kernel, the return mapping differs from "Strength_ElaPlastic"
+    virtual bool HasBatchKernel() {return false;}
 
     //!> Update the pressure of the particle with elastic assumption
     virtual void ElasticPressure(PhysicalProperty* pp, MPM_FLOAT delta_vol,
-        map<string, MPM_FLOAT>& transfer);
+        DataTransfer& transfer);
 
 private:
     //!> Parameters for Johnson-Cook material
@@ -19,6 +19,7 @@
 ==============================================================*/
 
 #include "Strength_ElaPlastic.h"
+#include "Strength_BatchKernel.h"
 
 Strength_ElaPlastic::Strength_ElaPlastic()
 {
@@ -48,7 +49,7 @@ void Strength_ElaPlastic::Write(ofstream& os)
 }
 
 void Strength_ElaPlastic::UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor& delta_strain, 
-        SymTensor& delta_vortex, map<string, MPM_FLOAT>& transfer)
+        SymTensor& delta_vortex, DataTransfer& transfer)
 {
     _ElasticDeviatoricStress(pp, delta_strain);
 
@@ -57,13 +58,13 @@ void Strength_ElaPlastic::UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor
 
     MPM_FLOAT depeff = 0.0;
     bool yield = (seqv > _yield_0);
-    transfer["yield"] = -1.0;   //!< means not yield, used for temperature update
+    transfer.yield = false;
     if (yield)
     {
-        transfer["yield"] = 1.0;
+        transfer.yield = true;
 
         depeff = (seqv - (*pp)[MPM::sigma_y])/(3.0*_shear_modulus);
-        transfer["depeff"] = depeff;
+        transfer.depeff = depeff;
 
         (*pp)[MPM::epeff] += depeff;
         MPM_FLOAT ratio = _yield_0/seqv;
@@ -72,35 +73,41 @@ void Strength_ElaPlastic::UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor
     }
 }
 
+void Strength_ElaPlastic::UpdateDeviatoricStressBatch(Strength_Batch& batch)
+{
+    ElasticTrialBatch(batch, _shear_modulus);
+    ElaPlasticReturnBatch(batch, _shear_modulus, _yield_0);
+}
+
 void Strength_ElaPlastic::ElasticPressure(PhysicalProperty* pp, MPM_FLOAT delta_vol,
-        map<string, MPM_FLOAT>& transfer)
+        DataTransfer& transfer)
 {
     _ElasticPressure(pp, delta_vol);
 }
 
 void Strength_ElaPlastic::UpdateTemperature(PhysicalProperty* pp, MPM_FLOAT delta_vol,
-        map<string, MPM_FLOAT>& transfer)
+        DataTransfer& transfer)
 {
     if (_compute_temperature)
     {
         if (pp->is_Failed())
             return;
         
-        if (transfer["yield"] < 0.0)    //!< must be available because of  "UpdateDeviatoricStress" function
+        if (!transfer.yield)    //!< set by "UpdateDeviatoricStress" function
             return;
         
         (*pp)[MPM::kelvin] += _plastic_work_coefficient*pp->GetEquivalentStress()*
-            transfer["depeff"]/pp->GetDensity()/_specific_heat;
+            transfer.depeff/pp->GetDensity()/_specific_heat;
     }
 }
 
 bool Strength_ElaPlastic::AddExtraParticleProperty_Strength(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer)
+        DataTransfer& transfer)
 {
     if (!Strength_Isotropic::AddExtraParticleProperty_Strength(ExtraProp, transfer))
         return false;
     ExtraProp.push_back(MPM::epeff);
     ExtraProp.push_back(MPM::sigma_y);
-    transfer["sigma_y"] = _yield_0;     //!< for particle property "sigma_y" initialization
+    transfer.sigma_y = _yield_0;     //!< for particle property "sigma_y" initialization
     return true;
 }
\ No newline at end of file
@@ -34,21 +34,25 @@ public:
     virtual void Write(ofstream &os);
 
     //!> Update the deviatoric stress of the particle
-    //!> the map named transfer is used to tansfer data between Strength/EOS/Failure model
+    //!> the record named transfer is used to tansfer data between Strength/EOS/Failure model
     virtual void UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor& delta_strain, 
-        SymTensor& delta_vortex, map<string, MPM_FLOAT>& transfer);
+        SymTensor& delta_vortex, DataTransfer& transfer);
+
+    //!> Vectorized version of "UpdateDeviatoricStress"
+    virtual void UpdateDeviatoricStressBatch(Strength_Batch& batch);
+    virtual bool HasBatchKernel() {return true;}
 
     //!> Update the pressure of the particle with elastic assumption
     virtual void ElasticPressure(PhysicalProperty* pp, MPM_FLOAT delta_vol,
-        map<string, MPM_FLOAT>& transfer);
+        DataTransfer& transfer);
 
     //!> Update the temperature of the particle
     virtual void UpdateTemperature(PhysicalProperty* pp, MPM_FLOAT delta_vol,
-        map<string, MPM_FLOAT>& transfer);
+        DataTransfer& transfer);
 
     //!> Add extra particle properties based on different strength model
     virtual bool AddExtraParticleProperty_Strength(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer);
+        DataTransfer& transfer);
 protected:
     MPM_FLOAT _yield_0;     //!< Initial yield stress
     MPM_FLOAT _plastic_work_coefficient;
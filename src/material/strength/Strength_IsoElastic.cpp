@@ -43,7 +43,7 @@ void Strength_IsoElastic::Write(ofstream& os)
 }
 
 void Strength_IsoElastic::UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor& delta_strain, 
-        SymTensor& delta_vortex, map<string, MPM_FLOAT>& transfer)
+        SymTensor& delta_vortex, DataTransfer& transfer)
 {
     _ElasticDeviatoricStress(pp, delta_strain);
 
@@ -51,13 +51,13 @@ void Strength_IsoElastic::UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor
 }
 
 void Strength_IsoElastic::ElasticPressure(PhysicalProperty* pp, MPM_FLOAT delta_vol,
-        map<string, MPM_FLOAT>& transfer)
+        DataTransfer& transfer)
 {
     _ElasticPressure(pp, delta_vol);
 }
 
 void Strength_IsoElastic::UpdateTemperature(PhysicalProperty* pp, MPM_FLOAT delta_vol,
-        map<string, MPM_FLOAT>& transfer)
+        DataTransfer& transfer)
 {
     if (_compute_temperature)
         (*pp)[MPM::kelvin] -= _temperature_coefficient*(*pp)[MPM::kelvin]*delta_vol/pp->GetDensity()/_specific_heat;
@@ -19,6 +19,7 @@
 ==============================================================*/
 
 #include "Strength_IsoHarden.h"
+#include "Strength_BatchKernel.h"
 
 Strength_IsoHarden::Strength_IsoHarden()
 {
@@ -55,7 +56,7 @@ void Strength_IsoHarden::Write(ofstream& os)
 }
 
 void Strength_IsoHarden::UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor& delta_strain, 
-        SymTensor& delta_vortex, map<string, MPM_FLOAT>& transfer)
+        SymTensor& delta_vortex, DataTransfer& transfer)
 {
     _ElasticDeviatoricStress(pp, delta_strain);
 
@@ -63,20 +64,26 @@ void Strength_IsoHarden::UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor&
     MPM_FLOAT seqv = pp->GetEquivalentStress();
 
     MPM_FLOAT depeff = 0.0;
-    transfer["yield"] = -1.0;
+    transfer.yield = false;
     if (seqv > _yield_0)    //!< when the yield condition is violated
     {
         depeff = (seqv - (*pp)[MPM::sigma_y])/(3.0*_shear_modulus + _plastic_modulus);
-        transfer["depeff"] = depeff;
+        transfer.depeff = depeff;
 
         (*pp)[MPM::epeff] += depeff;
         (*pp)[MPM::sigma_y] += _plastic_modulus*depeff;
         MPM_FLOAT ratio = (*pp)[MPM::sigma_y]/seqv;
         if (ratio < 1.0)
         {
-            transfer["yield"] = 1.0;
+            transfer.yield = true;
             pp->DeviatoricStressMultiplyScalar(ratio);
             pp->SetEquivalentStress((*pp)[MPM::sigma_y]);
         }
     }
+}
+
+void Strength_IsoHarden::UpdateDeviatoricStressBatch(Strength_Batch& batch)
+{
+    ElasticTrialBatch(batch, _shear_modulus);
+    IsoHardenReturnBatch(batch, _shear_modulus, _plastic_modulus, _yield_0);
 }
\ No newline at end of file
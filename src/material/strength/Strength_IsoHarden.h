@@ -38,7 +38,10 @@ public:
 
     //!> Update the deviatoric stress of the particle
     virtual void UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor& delta_strain, 
-        SymTensor& delta_vortex, map<string, MPM_FLOAT>& transfer);
+        SymTensor& delta_vortex, DataTransfer& transfer);
+
+    //!> Vectorized version of "UpdateDeviatoricStress"
+    virtual void UpdateDeviatoricStressBatch(Strength_Batch& batch);
 protected:
     MPM_FLOAT _tangential_modulus;
     MPM_FLOAT _plastic_modulus;
@@ -74,12 +74,12 @@ void Strength_Isotropic::ModifyPressureByTemperature(PhysicalProperty* pp)
 }
 
 bool Strength_Isotropic::AddExtraParticleProperty_Strength(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer)
+        DataTransfer& transfer)
 {
     if (_compute_temperature)
     {
         ExtraProp.push_back(MPM::kelvin);
-        transfer["roomt"] = _room_temperature;
+        transfer.roomt = _room_temperature;
     }
     return true;
 }
@@ -37,13 +37,13 @@ public:
     virtual void Write(ofstream &os) = 0;
 
     //!> Update the deviatoric stress of the particle
-    //!> the map named transfer is used to tansfer data between Strength/EOS/Failure model
+    //!> the record named transfer is used to tansfer data between Strength/EOS/Failure model
     virtual void UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor& delta_strain, 
-        SymTensor& delta_vortex, map<string, MPM_FLOAT>& transfer) = 0;
+        SymTensor& delta_vortex, DataTransfer& transfer) = 0;
 
     //!> Update the pressure of the particle with elastic assumption
     virtual void ElasticPressure(PhysicalProperty* pp, MPM_FLOAT delta_vol,
-        map<string, MPM_FLOAT>& transfer) = 0;
+        DataTransfer& transfer) = 0;
 
     //!> Calculate the squared adabatic sound speed of deviatoric part
     virtual MPM_FLOAT SoundSpeedSquare_Strength(PhysicalProperty* pp);
@@ -53,14 +53,14 @@ public:
 
     //!> Update the temperature of the particle
     virtual void UpdateTemperature(PhysicalProperty* pp, MPM_FLOAT delta_vol,
-        map<string, MPM_FLOAT>& transfer) = 0;
+        DataTransfer& transfer) = 0;
 
     //!> Modify the mean stress with temperature coefficient
     virtual void ModifyPressureByTemperature(PhysicalProperty* pp);
 
     //!> Add extra particle properties based on different strength model
     virtual bool AddExtraParticleProperty_Strength(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer);
+        DataTransfer& transfer);
 protected:
     //!> Isotropic constitution consists of two parameters
     //!>    Young's Modulus and Poisson Rate
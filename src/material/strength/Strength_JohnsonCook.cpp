@@ -19,7 +19,8 @@
 ==============================================================*/
 
 #include "Strength_JohnsonCook.h"
-#include "../../solver/Solver_Base.h"
+#include "Strength_BatchKernel.h"
+#include "../../solver/SimulationContext.h"
 
 Strength_JohnsonCook::Strength_JohnsonCook(/* args */)
 {
@@ -63,66 +64,107 @@ void Strength_JohnsonCook::Write(ofstream& os)
 }
 
 void Strength_JohnsonCook::UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor& delta_strain, 
-        SymTensor& delta_vortex, map<string, MPM_FLOAT>& transfer)
+        SymTensor& delta_vortex, DataTransfer& transfer)
 {
     _DamageDeviatoricStress(pp, delta_strain);
     pp->EquivalentStress();
     MPM_FLOAT seqv = pp->GetEquivalentStress();
 
-    MPM_FLOAT depeff = 0.0;
-    MPM_FLOAT lsrate = 0.0;
-    MPM_FLOAT tstar = 0.0;
-    transfer["yield"] = -1.0;
-    MPM_FLOAT dt = Solver_Base::GetDTn_I();
+    transfer.yield = false;
+    transfer.depeff = 0.0;
+    transfer.lsrate = 0.0;
+    transfer.tstar = 0.0;
+    MPM_FLOAT dt = transfer.context->GetDTn_I();
     if (seqv > (*pp)[MPM::sigma_y])
     {
-        tstar = ((*pp)[MPM::kelvin] - _room_temperature)/(_melt_temperature - _room_temperature);
-        if (tstar > 1.0)    //!< melting
-        {
-            tstar = 1.0;
+        bool failure = false;
+        transfer.yield = _ReturnMapping(seqv, (*pp)[MPM::kelvin], dt, (*pp)[MPM::epeff], (*pp)[MPM::sigma_y],
+            failure, transfer.depeff, transfer.lsrate, transfer.tstar);
+        if (failure)
             pp->Failed();
-        }
-        else if (tstar < -MPM_EPSILON)
-            tstar = 0.0;
-
-        (*pp)[MPM::epeff] += 0.0001;    //!< avoid zero
-        MPM_FLOAT plastic_modulus = _B_jc*_n_jc*pow((*pp)[MPM::epeff], _n_jc-1);    //!< Simplified
-        (*pp)[MPM::epeff] -= 0.0001;
-        depeff = (seqv - (*pp)[MPM::sigma_y])/(3.0*_shear_modulus + plastic_modulus);
-        (*pp)[MPM::epeff] += depeff;
-
-        MPM_FLOAT srate = depeff/_epso/dt;
-        if (srate < 1.0)
-            srate = 1.0;
-        lsrate = log(srate);
-        (*pp)[MPM::sigma_y] = (_yield_0 + _B_jc*pow((*pp)[MPM::epeff], _n_jc))*
-            (1 + _C_jc*lsrate)*(1 - pow(tstar, _m_jc));
-        if ((*pp)[MPM::sigma_y] < -MPM_EPSILON)
+
+        if (transfer.yield)
         {
-            cout << "*** Warning: yield stress less than ZERO in Johnson-Cook Strength: "
-                << (*pp)[MPM::sigma_y] << " with temperature of " << (*pp)[MPM::kelvin] << " K."<< endl;
+            MPM_FLOAT ratio = (*pp)[MPM::sigma_y]/seqv;
+            pp->DeviatoricStressMultiplyScalar(ratio);
+            pp->SetEquivalentStress((*pp)[MPM::sigma_y]);
         }
+    }
+}
 
-        if ((*pp)[MPM::sigma_y] > seqv)
+void Strength_JohnsonCook::UpdateDeviatoricStressBatch(Strength_Batch& batch)
+{
+    DamageElasticTrialBatch(batch, _shear_modulus);
+
+    MPM_FLOAT dt = batch.context->GetDTn_I();
+    if (_fast_math)
+    {
+        JohnsonCook_Parameter jc = {_shear_modulus, _yield_0, _B_jc, _n_jc, _C_jc, _m_jc, _epso, dt,
+            _room_temperature, _melt_temperature, true};
+        JohnsonCookFastReturnBatch(batch, jc);
+
+        //!> Only the lanes beyond the yield stress can get a negative one
+        for (MPM_STATS i = 0; i < batch.number; i++)
         {
-            (*pp)[MPM::epeff] -= depeff;
-            depeff = 0.0;
+            if (batch.sigma_y[i] < -MPM_EPSILON)
+                cout << "*** Warning: yield stress less than ZERO in Johnson-Cook Strength: "
+                    << batch.sigma_y[i] << " with temperature of " << batch.kelvin[i] << " K."<< endl;
         }
-        else
+    }
+    else
+    {
+        //!> pow and log of the yield stress are only evaluated for the lanes beyond the yield surface
+        for (MPM_STATS i = 0; i < batch.number; i++)
         {
-            transfer["yield"] = 1.0;
-            MPM_FLOAT ratio = (*pp)[MPM::sigma_y]/seqv;
-            pp->DeviatoricStressMultiplyScalar(ratio);
-            pp->SetEquivalentStress((*pp)[MPM::sigma_y]);
+            if (batch.equivalent_stress[i] > batch.sigma_y[i])
+                batch.yield[i] = _ReturnMapping(batch.equivalent_stress[i], batch.kelvin[i], dt, batch.epeff[i], 
+                    batch.sigma_y[i], batch.failure[i], batch.depeff[i], batch.lsrate[i], batch.tstar[i]);
         }
     }
-    transfer["depeff"] = depeff;
-    transfer["lsrate"] = lsrate;
-    transfer["tstar"] = tstar;
+
+    RadialReturnBatch(batch);
+}
+
+bool Strength_JohnsonCook::_ReturnMapping(MPM_FLOAT seqv, MPM_FLOAT kelvin, MPM_FLOAT dt, MPM_FLOAT& epeff,
+    MPM_FLOAT& sigma_y, bool& failure, MPM_FLOAT& depeff, MPM_FLOAT& lsrate, MPM_FLOAT& tstar)
+{
+    tstar = (kelvin - _room_temperature)/(_melt_temperature - _room_temperature);
+    if (tstar > 1.0)    //!< melting
+    {
+        tstar = 1.0;
+        failure = true;
+    }
+    else if (tstar < -MPM_EPSILON)
+        tstar = 0.0;
+
+    epeff += 0.0001;    //!< avoid zero
+    MPM_FLOAT plastic_modulus = _B_jc*_n_jc*_Pow(epeff, _n_jc-1);    //!< Simplified
+    epeff -= 0.0001;
+    depeff = (seqv - sigma_y)/(3.0*_shear_modulus + plastic_modulus);
+    epeff += depeff;
+
+    MPM_FLOAT srate = depeff/_epso/dt;
+    if (srate < 1.0)
+        srate = 1.0;
+    lsrate = _Log(srate);
+    sigma_y = (_yield_0 + _B_jc*_Pow(epeff, _n_jc))*(1 + _C_jc*lsrate)*(1 - _Pow(tstar, _m_jc));
+    if (sigma_y < -MPM_EPSILON)
+    {
+        cout << "*** Warning: yield stress less than ZERO in Johnson-Cook Strength: "
+            << sigma_y << " with temperature of " << kelvin << " K."<< endl;
+    }
+
+    if (sigma_y > seqv)
+    {
+        epeff -= depeff;
+        depeff = 0.0;
+        return false;
+    }
+    return true;
 }
 
 bool Strength_JohnsonCook::AddExtraParticleProperty_Strength(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer)
+        DataTransfer& transfer)
 {
     if (!Strength_ElaPlastic::AddExtraParticleProperty_Strength(ExtraProp, transfer))
         return false;
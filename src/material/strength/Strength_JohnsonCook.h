@@ -35,16 +35,24 @@ public:
 
     //!> Update the deviatoric stress of the particle
     virtual void UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor& delta_strain, 
-        SymTensor& delta_vortex, map<string, MPM_FLOAT>& transfer);
+        SymTensor& delta_vortex, DataTransfer& transfer);
+
+    //!> Vectorized version of "UpdateDeviatoricStress"
+    virtual void UpdateDeviatoricStressBatch(Strength_Batch& batch);
 
     //!> Add extra particle properties based on different strength model
     virtual bool AddExtraParticleProperty_Strength(vector<MPM::ExtraParticleProperty> &ExtraProp,
-        map<string, MPM_FLOAT>& transfer);
+        DataTransfer& transfer);
 private:
     //!> Parameters for Johnson-Cook material
     MPM_FLOAT _B_jc, _n_jc, _C_jc, _m_jc;
     MPM_FLOAT _epso;    //!< strain rate normalization factor used in J-C model
     MPM_FLOAT _melt_temperature;
+
+    //!> Plastic correction of a particle beyond the yield stress, shared by the scalar and batch versions
+    //!> Return whether the stress should be scaled back to the new "sigma_y"
+    bool _ReturnMapping(MPM_FLOAT seqv, MPM_FLOAT kelvin, MPM_FLOAT dt, MPM_FLOAT& epeff, MPM_FLOAT& sigma_y, 
+        bool& failure, MPM_FLOAT& depeff, MPM_FLOAT& lsrate, MPM_FLOAT& tstar);
 };
 
 #endif
\ No newline at end of file
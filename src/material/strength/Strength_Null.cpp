@@ -19,7 +19,7 @@
 ==============================================================*/
 
 #include "Strength_Null.h"
-#include "../../solver/Solver_Base.h"
+#include "../../solver/SimulationContext.h"
 
 Strength_Null::Strength_Null()
 {
@@ -61,13 +61,13 @@ void Strength_Null::Write(ofstream& os)
 }
 
 void Strength_Null::UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor& delta_strain, 
-        SymTensor& delta_vortex, map<string, MPM_FLOAT>& transfer)
+        SymTensor& delta_vortex, DataTransfer& transfer)
 {
     if (_mu > MPM_EPSILON)
     {
         MPM_FLOAT delta_strain_mean = (delta_strain[0] + delta_strain[1] + delta_strain[2])/3.0;
         MPM_FLOAT mu_half = _mu*0.5;
-        MPM_FLOAT dt = Solver_Base::GetDTn_I();
+        MPM_FLOAT dt = transfer.context->GetDTn_I();
         SymTensor sd;
 
         sd[0] = _mu*(delta_strain[0] - delta_strain_mean)/dt;
@@ -82,7 +82,7 @@ void Strength_Null::UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor& delt
     else if (_ck > MPM_EPSILON)
     {
         MPM_FLOAT delta_strain_mean = (delta_strain[0] + delta_strain[1] + delta_strain[2])/3.0;
-        MPM_FLOAT dt = Solver_Base::GetDTn_I();
+        MPM_FLOAT dt = transfer.context->GetDTn_I();
         Array3D sde;
         sde[0] = delta_strain[0] - delta_strain_mean;
         sde[1] = delta_strain[1] - delta_strain_mean;
@@ -106,7 +106,7 @@ void Strength_Null::UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor& delt
 }
 
 void Strength_Null::ElasticPressure(PhysicalProperty* pp, MPM_FLOAT delta_vol,
-        map<string, MPM_FLOAT>& transfer)
+        DataTransfer& transfer)
 {
     string error_msg = "*** Error *** Null strength model should be used with EOS!";
     MPM3D_ErrorMessage(__FILE__, __LINE__, error_msg);
@@ -126,7 +126,7 @@ MPM_FLOAT Strength_Null::SoundSpeedSquare_Elastic(PhysicalProperty* pp)
 }
 
 void Strength_Null::UpdateTemperature(PhysicalProperty* pp, MPM_FLOAT delta_vol,
-        map<string, MPM_FLOAT>& transfer)
+        DataTransfer& transfer)
 {
     //!> Leave to be implemented
     return;
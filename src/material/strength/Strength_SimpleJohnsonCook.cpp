@@ -19,7 +19,8 @@
 ==============================================================*/
 
 #include "Strength_SimpleJohnsonCook.h"
-#include "../../solver/Solver_Base.h"
+#include "Strength_BatchKernel.h"
+#include "../../solver/SimulationContext.h"
 
 Strength_SimpleJohnsonCook::Strength_SimpleJohnsonCook()
 {
@@ -55,46 +56,94 @@ void Strength_SimpleJohnsonCook::Write(ofstream& os)
 }
 
 void Strength_SimpleJohnsonCook::UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor& delta_strain, 
-        SymTensor& delta_vortex, map<string, MPM_FLOAT>& transfer)
+        SymTensor& delta_vortex, DataTransfer& transfer)
 {
     _ElasticDeviatoricStress(pp, delta_strain);
     pp->EquivalentStress();
     MPM_FLOAT seqv = pp->GetEquivalentStress();
 
-    MPM_FLOAT depeff = 0.0;
-    transfer["yield"] = -1.0;
-    MPM_FLOAT dt = Solver_Base::GetDTn_I();
+    transfer.yield = false;
+    transfer.depeff = 0.0;
+    MPM_FLOAT dt = transfer.context->GetDTn_I();
     if (seqv > (*pp)[MPM::sigma_y])
     {
-        (*pp)[MPM::epeff] += 0.0001;    //!< avoid zero
-        MPM_FLOAT plastic_modulus = _B_jc*_n_jc*pow((*pp)[MPM::epeff], _n_jc-1);    //!< Simplified
-        (*pp)[MPM::epeff] -= 0.0001;
-        depeff = (seqv - (*pp)[MPM::sigma_y])/(3.0*_shear_modulus + plastic_modulus);
-        (*pp)[MPM::epeff] += depeff;
-
-        MPM_FLOAT srate = depeff/_epso/dt;
-        if (srate < 1.0)
-            srate = 1.0;
-        (*pp)[MPM::sigma_y] = (_yield_0 + _B_jc*pow((*pp)[MPM::epeff], _n_jc))*
-            (1 + _C_jc*log(srate));
-        if ((*pp)[MPM::sigma_y] < -MPM_EPSILON)
+        MPM_FLOAT* kelvin = pp->HasExtraParticleProperty(MPM::kelvin) ? &(*pp)[MPM::kelvin] : nullptr;
+        transfer.yield = _ReturnMapping(seqv, kelvin, dt, (*pp)[MPM::epeff], (*pp)[MPM::sigma_y], 
+            transfer.depeff);
+        if (transfer.yield)
         {
-            cout << "*** Warning: yield stress less than ZERO in Simplified Johnson-Cook Strength: "
-                << (*pp)[MPM::sigma_y] << " with temperature of " << (*pp)[MPM::kelvin] << " K."<< endl;
+            MPM_FLOAT ratio = (*pp)[MPM::sigma_y]/seqv;
+            pp->DeviatoricStressMultiplyScalar(ratio);
+            pp->SetEquivalentStress((*pp)[MPM::sigma_y]);
         }
+    }
+}
+
+void Strength_SimpleJohnsonCook::UpdateDeviatoricStressBatch(Strength_Batch& batch)
+{
+    ElasticTrialBatch(batch, _shear_modulus);
+
+    MPM_FLOAT dt = batch.context->GetDTn_I();
+    if (_fast_math)
+    {
+        //!> No thermal softening, the temperatures only keep the unused lane values finite
+        JohnsonCook_Parameter jc = {_shear_modulus, _yield_0, _B_jc, _n_jc, _C_jc, 1.0, _epso, dt,
+            _room_temperature, _room_temperature + 1, false};
+        JohnsonCookFastReturnBatch(batch, jc);
 
-        if ((*pp)[MPM::sigma_y] > seqv)
+        //!> Only the lanes beyond the yield stress can get a negative one
+        for (MPM_STATS i = 0; i < batch.number; i++)
         {
-            (*pp)[MPM::epeff] -= depeff;
-            depeff = 0.0;
+            if (batch.sigma_y[i] < -MPM_EPSILON)
+            {
+                cout << "*** Warning: yield stress less than ZERO in Simplified Johnson-Cook Strength: " 
+                    << batch.sigma_y[i];
+                if (batch.kelvin)
+                    cout << " with temperature of " << batch.kelvin[i] << " K.";
+                cout << endl;
+            }
         }
-        else
+    }
+    else
+    {
+        //!> pow and log of the yield stress are only evaluated for the lanes beyond the yield surface
+        for (MPM_STATS i = 0; i < batch.number; i++)
         {
-            transfer["yield"] = 1.0;
-            MPM_FLOAT ratio = (*pp)[MPM::sigma_y]/seqv;
-            pp->DeviatoricStressMultiplyScalar(ratio);
-            pp->SetEquivalentStress((*pp)[MPM::sigma_y]);
+            if (batch.equivalent_stress[i] > batch.sigma_y[i])
+                batch.yield[i] = _ReturnMapping(batch.equivalent_stress[i], batch.kelvin ? batch.kelvin + i : nullptr,
+                    dt, batch.epeff[i], batch.sigma_y[i], batch.depeff[i]);
         }
     }
-    transfer["depeff"] = depeff;
+
+    RadialReturnBatch(batch);
+}
+
+bool Strength_SimpleJohnsonCook::_ReturnMapping(MPM_FLOAT seqv, MPM_FLOAT* kelvin, MPM_FLOAT dt, MPM_FLOAT& epeff,
+    MPM_FLOAT& sigma_y, MPM_FLOAT& depeff)
+{
+    epeff += 0.0001;    //!< avoid zero
+    MPM_FLOAT plastic_modulus = _B_jc*_n_jc*_Pow(epeff, _n_jc-1);    //!< Simplified
+    epeff -= 0.0001;
+    depeff = (seqv - sigma_y)/(3.0*_shear_modulus + plastic_modulus);
+    epeff += depeff;
+
+    MPM_FLOAT srate = depeff/_epso/dt;
+    if (srate < 1.0)
+        srate = 1.0;
+    sigma_y = (_yield_0 + _B_jc*_Pow(epeff, _n_jc))*(1 + _C_jc*_Log(srate));
+    if (sigma_y < -MPM_EPSILON)
+    {
+        cout << "*** Warning: yield stress less than ZERO in Simplified Johnson-Cook Strength: " << sigma_y;
+        if (kelvin)
+            cout << " with temperature of " << *kelvin << " K.";
+        cout << endl;
+    }
+
+    if (sigma_y > seqv)
+    {
+        epeff -= depeff;
+        depeff = 0.0;
+        return false;
+    }
+    return true;
 }
\ No newline at end of file
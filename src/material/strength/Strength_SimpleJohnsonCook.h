@@ -36,11 +36,20 @@ public:
 
     //!> Update the deviatoric stress of the particle
     virtual void UpdateDeviatoricStress(PhysicalProperty* pp, SymTensor& delta_strain, 
-        SymTensor& delta_vortex, map<string, MPM_FLOAT>& transfer);
+        SymTensor& delta_vortex, DataTransfer& transfer);
+
+    //!> Vectorized version of "UpdateDeviatoricStress"
+    virtual void UpdateDeviatoricStressBatch(Strength_Batch& batch);
 private:
     //!> Parameters for Johnson-Cook material
     MPM_FLOAT _B_jc, _n_jc, _C_jc;
     MPM_FLOAT _epso;    //!< strain rate normalization factor used in J-C model
+
+    //!> Plastic correction of a particle beyond the yield stress, shared by the scalar and batch versions
+    //!> "kelvin" is only used for the warning, nullptr if the temperature is not computed
+    //!> Return whether the stress should be scaled back to the new "sigma_y"
+    bool _ReturnMapping(MPM_FLOAT seqv, MPM_FLOAT* kelvin, MPM_FLOAT dt, MPM_FLOAT& epeff, MPM_FLOAT& sigma_y,
+        MPM_FLOAT& depeff);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,313 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of class "DomainDecomposition"
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "DomainDecomposition.h"
+#include "../utility/Profiler.h"
+#include <cstring>
+
+DomainDecomposition::DomainDecomposition()
+{
+    _transport = nullptr;
+    _grid = nullptr;
+    for (int k = 0; k < 3; k++)
+    {
+        _division[k] = 1;
+        _index[k] = 0;
+    }
+    _migrated = 0;
+    _ghost_number = 0;
+
+    _profile_migrate = Profiler::Register("Domain/Migrate");
+    _profile_reduce = Profiler::Register("Domain/Reduce");
+}
+
+DomainDecomposition::~DomainDecomposition()
+{
+}
+
+bool DomainDecomposition::Initialize(Transport_Base* transport, SparseGrid* grid, const Array3D& low, 
+    const Array3D& high, const int (&division)[3])
+{
+    if (!transport || !grid)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Transport and grid are required by the domain "
+            "decomposition.");
+        return false;
+    }
+    if (division[0] <= 0 || division[1] <= 0 || division[2] <= 0 || 
+        division[0]*division[1]*division[2] != transport->GetSize())
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** INPUT ERROR *** The number of subdomains should be the number "
+            "of ranks of the transport.");
+        return false;
+    }
+    _transport = transport;
+    _grid = grid;
+
+    int low_cell[3], high_cell[3];
+    grid->Cell(low[0], low[1], low[2], low_cell);
+    grid->Cell(high[0], high[1], high[2], high_cell);
+    int rank = transport->GetRank();
+    for (int k = 0; k < 3; k++)
+    {
+        //!> Subdomains narrower than a stencil would have ghost nodes owned by ranks which are not neighbours
+        int cells = high_cell[k] - low_cell[k] + 1;
+        if (cells < division[k]*MPM::MaxStencilWidth)
+        {
+            MPM3D_ErrorMessage(__FILE__, __LINE__, "*** INPUT ERROR *** Subdomains should be at least "
+                "MPM::MaxStencilWidth cells wide.");
+            return false;
+        }
+        _division[k] = division[k];
+        _bound[k].resize(division[k] + 1);
+        for (int i = 0; i <= division[k]; i++)
+            _bound[k][i] = low_cell[k] + (int)((int64_t)cells*i/division[k]);
+    }
+    _index[0] = rank % division[0];
+    _index[1] = rank/division[0] % division[1];
+    _index[2] = rank/division[0]/division[1];
+
+    //!> Ranks of the 26 surrounding subdomains
+    _neighbour.clear();
+    _neighbour_index.assign(transport->GetSize(), -1);
+    for (int k = max(_index[2] - 1, 0); k <= min(_index[2] + 1, division[2] - 1); k++)
+        for (int j = max(_index[1] - 1, 0); j <= min(_index[1] + 1, division[1] - 1); j++)
+            for (int i = max(_index[0] - 1, 0); i <= min(_index[0] + 1, division[0] - 1); i++)
+            {
+                int neighbour = i + division[0]*(j + division[1]*k);
+                if (neighbour != rank)
+                    _neighbour.push_back(neighbour);
+            }
+    sort(_neighbour.begin(), _neighbour.end());
+    for (size_t n = 0; n < _neighbour.size(); n++)
+        _neighbour_index[_neighbour[n]] = (int)n;
+
+    _send.assign(_neighbour.size(), vector<char>());
+    _receive.assign(_neighbour.size(), vector<char>());
+    _ghost_node.assign(_neighbour.size(), vector<MPM_STATS>());
+    _owned_entry.assign(_neighbour.size(), vector<MPM_STATS>());
+    return true;
+}
+
+int DomainDecomposition::CellOwner(const int (&cell)[3])
+{
+    return _AxisIndex(0, cell[0]) + _division[0]*(_AxisIndex(1, cell[1]) + _division[1]*_AxisIndex(2, cell[2]));
+}
+
+int DomainDecomposition::Owner(MPM_FLOAT x, MPM_FLOAT y, MPM_FLOAT z)
+{
+    int cell[3];
+    _grid->Cell(x, y, z, cell);
+    return CellOwner(cell);
+}
+
+bool DomainDecomposition::Distribute(ParticleStore& store)
+{
+    int rank = _transport->GetRank();
+    vector<MPM_STATS> leaving;
+    for (MPM_STATS p = 0; p < store.GetActiveNumber(); p++)
+        if (Owner(store.GetPosition(0)[p], store.GetPosition(1)[p], store.GetPosition(2)[p]) != rank)
+            leaving.push_back(p);
+    return store.Migrate(leaving, nullptr, 0);
+}
+
+bool DomainDecomposition::Migrate(ParticleStore& store)
+{
+    ProfileScope profile(_profile_migrate, store.GetActiveNumber());
+    int rank = _transport->GetRank();
+    size_t packed_bytes = store.GetPackedBytes();
+    for (auto& buffer : _send)
+        buffer.clear();
+
+    vector<MPM_STATS> leaving;
+    for (MPM_STATS p = 0; p < store.GetActiveNumber(); p++)
+    {
+        int owner = Owner(store.GetPosition(0)[p], store.GetPosition(1)[p], store.GetPosition(2)[p]);
+        if (owner == rank)
+            continue;
+        int n = _neighbour_index[owner];
+        if (n < 0)
+        {
+            MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** A particle moved beyond the neighbouring "
+                "subdomains in a step.");
+            return false;
+        }
+        leaving.push_back(p);
+        size_t offset = _send[n].size();
+        _send[n].resize(offset + packed_bytes);
+        store.Pack(p, _send[n].data() + offset);
+    }
+    _migrated = (MPM_STATS)leaving.size();
+    if (!_Exchange())
+        return false;
+
+    vector<char> arrival;
+    for (auto& buffer : _receive)
+    {
+        if (buffer.size() % packed_bytes != 0)
+        {
+            MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Wrong message size of migrating particles.");
+            return false;
+        }
+        arrival.insert(arrival.end(), buffer.begin(), buffer.end());
+    }
+    return store.Migrate(leaving, arrival.data(), (MPM_STATS)(arrival.size()/packed_bytes));
+}
+
+bool DomainDecomposition::ReduceNodes(int quantity)
+{
+    ProfileScope profile(_profile_reduce, _grid->GetNodeNumber());
+    vector<MPM_FLOAT*> value;
+    if (quantity & ParticleToGrid::Mass)
+        value.push_back(_grid->GetMass());
+    for (int k = 0; k < 3 && (quantity & ParticleToGrid::Momentum); k++)
+        value.push_back(_grid->GetMomentum(k));
+    for (int k = 0; k < 3 && (quantity & ParticleToGrid::Force); k++)
+        value.push_back(_grid->GetForce(k));
+    const size_t value_number = value.size();
+    const size_t record_bytes = 3*sizeof(int) + value_number*sizeof(MPM_FLOAT);
+
+    //!> Values of the ghost nodes to their owners, as records of the node coordinate and the values
+    int rank = _transport->GetRank();
+    for (size_t n = 0; n < _neighbour.size(); n++)
+    {
+        _send[n].clear();
+        _ghost_node[n].clear();
+    }
+    _ghost_number = 0;
+    const int edge = MPM::GridBlockEdge;
+    for (MPM_STATS b = 0; b < _grid->GetBlockNumber(); b++)
+    {
+        int first[3];
+        bool inside = true;
+        for (int k = 0; k < 3; k++)
+        {
+            first[k] = _grid->GetBlockCoordinate(k)[b]*edge;
+            inside = inside && _AxisIndex(k, first[k]) == _index[k] && _AxisIndex(k, first[k] + edge - 1) == _index[k];
+        }
+        if (inside)
+            continue;
+
+        for (int local = 0; local < MPM::GridBlockNodes; local++)
+        {
+            int node[3] = {first[0] + local % edge, first[1] + local/edge % edge, first[2] + local/edge/edge};
+            int owner = CellOwner(node);
+            if (owner == rank)
+                continue;
+            int n = _neighbour_index[owner];
+            if (n < 0)
+            {
+                MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** A ghost node is not owned by a neighbouring "
+                    "subdomain.");
+                return false;
+            }
+            MPM_STATS index = b*MPM::GridBlockNodes + local;
+            _ghost_node[n].push_back(index);
+            size_t offset = _send[n].size();
+            _send[n].resize(offset + record_bytes);
+            char* record = _send[n].data() + offset;
+            memcpy(record, node, 3*sizeof(int));
+            for (size_t v = 0; v < value_number; v++)
+                memcpy(record + 3*sizeof(int) + v*sizeof(MPM_FLOAT), &value[v][index], sizeof(MPM_FLOAT));
+        }
+    }
+    for (auto& ghost : _ghost_node)
+        _ghost_number += (MPM_STATS)ghost.size();
+    if (!_Exchange())
+        return false;
+
+    //!> Owned nodes add the values received, in the order of neighbours, nodes not in the grid of this rank
+    //!>    are summed in "_extra_sum"
+    _extra_node.clear();
+    _extra_sum.clear();
+    for (size_t n = 0; n < _neighbour.size(); n++)
+    {
+        if (_receive[n].size() % record_bytes != 0)
+        {
+            MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Wrong message size of ghost nodes.");
+            return false;
+        }
+        size_t record_number = _receive[n].size()/record_bytes;
+        _owned_entry[n].resize(record_number);
+        for (size_t r = 0; r < record_number; r++)
+        {
+            const char* record = _receive[n].data() + r*record_bytes;
+            int node[3];
+            memcpy(node, record, 3*sizeof(int));
+            MPM_FLOAT* sum[7];
+            MPM_STATS index = _grid->NodeIndex(node[0], node[1], node[2]);
+            if (index >= 0)
+            {
+                for (size_t v = 0; v < value_number; v++)
+                    sum[v] = &value[v][index];
+                _owned_entry[n][r] = index;
+            }
+            else
+            {
+                auto inserted = _extra_node.emplace(_NodeKey(node), (MPM_STATS)(_extra_sum.size()/value_number));
+                MPM_STATS entry = inserted.first->second;
+                if (inserted.second)
+                    _extra_sum.resize(_extra_sum.size() + value_number, 0.0);
+                for (size_t v = 0; v < value_number; v++)
+                    sum[v] = &_extra_sum[entry*value_number + v];
+                _owned_entry[n][r] = -1 - entry;
+            }
+            for (size_t v = 0; v < value_number; v++)
+            {
+                MPM_FLOAT received;
+                memcpy(&received, record + 3*sizeof(int) + v*sizeof(MPM_FLOAT), sizeof(MPM_FLOAT));
+                *sum[v] += received;
+            }
+        }
+    }
+
+    //!> Sums back to the ranks of the ghost nodes, in the order they were received
+    for (size_t n = 0; n < _neighbour.size(); n++)
+    {
+        _send[n].resize(_owned_entry[n].size()*value_number*sizeof(MPM_FLOAT));
+        MPM_FLOAT* sum = (MPM_FLOAT*)_send[n].data();
+        for (MPM_STATS entry : _owned_entry[n])
+            for (size_t v = 0; v < value_number; v++)
+                *sum++ = entry >= 0 ? value[v][entry] : _extra_sum[(-1 - entry)*value_number + v];
+    }
+    if (!_Exchange())
+        return false;
+
+    for (size_t n = 0; n < _neighbour.size(); n++)
+    {
+        if (_receive[n].size() != _ghost_node[n].size()*value_number*sizeof(MPM_FLOAT))
+        {
+            MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Wrong message size of node sums.");
+            return false;
+        }
+        const char* sum = _receive[n].data();
+        for (MPM_STATS index : _ghost_node[n])
+            for (size_t v = 0; v < value_number; v++, sum += sizeof(MPM_FLOAT))
+                memcpy(&value[v][index], sum, sizeof(MPM_FLOAT));
+    }
+    return true;
+}
+
+bool DomainDecomposition::_Exchange()
+{
+    if (_neighbour.empty())
+        return true;
+    return _transport->Exchange(_neighbour, _send, _receive);
+}
@@ -0,0 +1,124 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Spatial domain decomposition of one body and its
+        sparse grid over the ranks of a Transport. The cells
+        of a box are split into a Cartesian array of
+        subdomains, one per rank, and a rank owns the particles
+        in the cells of its subdomain and the nodes at the low
+        corner of them. Particles outside the box belong to the
+        nearest subdomain.
+        Each rank rebuilds its grid from its own particles, the
+        nodes of other subdomains in it are its ghost nodes.
+        After a particle-to-grid transfer "ReduceNodes" sends
+        the ghost node values to their owners, which add them
+        up and send the totals back, so that every rank has
+        the values of a single-process run on all its nodes.
+        "Migrate" moves the particles which have left the
+        subdomain to the neighbour that owns them.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _DOMAINDECOMPOSITION_H_
+#define _DOMAINDECOMPOSITION_H_
+
+#include "../main/MPM3D_MACRO.h"
+#include "../grid/ParticleToGrid.h"
+#include "Transport_Base.h"
+#include <cstdint>
+#include <unordered_map>
+
+class DomainDecomposition
+{
+public:
+    DomainDecomposition();
+    ~DomainDecomposition();
+
+    //!> Split the cells of the box [low, high] of "grid" into division[0]*division[1]*division[2] subdomains,
+    //!>    as even as possible, subdomain (i, j, k) is owned by rank i + division[0]*(j + division[1]*k)
+    //!> The transport should have one rank per subdomain, and subdomains should be at least
+    //!>    "MPM::MaxStencilWidth" cells wide, so that the ghost nodes of a rank are owned by its neighbours
+    bool Initialize(Transport_Base* transport, SparseGrid* grid, const Array3D& low, const Array3D& high, 
+        const int (&division)[3]);
+
+    //!> Rank owning a cell or a position
+    int CellOwner(const int (&cell)[3]);
+    int Owner(MPM_FLOAT x, MPM_FLOAT y, MPM_FLOAT z);
+
+    //!> Remove the active particles owned by other ranks, when every rank starts with all particles
+    bool Distribute(ParticleStore& store);
+
+    //!> Send the active particles owned by other ranks to them and add the particles received
+    //!> Particles should not move beyond the neighbouring subdomains in a step
+    bool Migrate(ParticleStore& store);
+
+    //!> Sum the node values "quantity" (see "ParticleToGrid::TransferQuantity") of the ghost nodes and
+    //!>    the owned nodes over all ranks, after the transfer of each rank to its grid
+    bool ReduceNodes(int quantity);
+
+    //!> Minimum of the critical time step over all ranks
+    inline bool ReduceTimeStep(MPM_FLOAT& critical_dt) {return _transport->AllReduceMin(critical_dt);}
+private:
+    //!> Subdomain index along axis "k" of cell or node index "index"
+    inline int _AxisIndex(int k, int index)
+    {
+        return (int)(upper_bound(_bound[k].begin() + 1, _bound[k].end() - 1, index) - _bound[k].begin()) - 1;
+    }
+
+    //!> Key of a node of "_extra_node"
+    static inline uint64_t _NodeKey(const int (&node)[3])
+    {
+        const uint64_t mask = (1 << 21) - 1;
+        return ((uint64_t)(node[0] + (1 << 20)) & mask) << 42 | ((uint64_t)(node[1] + (1 << 20)) & mask) << 21 | 
+            ((uint64_t)(node[2] + (1 << 20)) & mask);
+    }
+
+    //!> Exchange with all neighbours, "_send" to "_receive"
+    bool _Exchange();
+private:
+    Transport_Base* _transport;
+    SparseGrid* _grid;
+    int _division[3];
+    int _index[3];                      //!< subdomain of this rank
+    vector<int> _bound[3];              //!< cells [_bound[k][i], _bound[k][i + 1]) of subdomain i along axis k
+
+    vector<int> _neighbour;             //!< ranks of the neighbouring subdomains, ascending
+    vector<int> _neighbour_index;       //!< index in "_neighbour" of each rank, -1 if not a neighbour
+    vector< vector<char> > _send;       //!< message to each neighbour
+    vector< vector<char> > _receive;    //!< message from each neighbour
+
+    //!> Nodes of "ReduceNodes"
+    vector< vector<MPM_STATS> > _ghost_node;    //!< ghost nodes sent to each neighbour, in order
+    vector< vector<MPM_STATS> > _owned_entry;   //!< sum of each node received from each neighbour, a node 
+                                                //!<    index, or -1 - i for entry i of "_extra_sum"
+    unordered_map<uint64_t, MPM_STATS> _extra_node; //!< owned nodes not in the grid of this rank
+    vector<MPM_FLOAT> _extra_sum;       //!< values of those nodes
+
+    MPM_STATS _migrated;                //!< particles sent by the last "Migrate"
+    MPM_STATS _ghost_number;            //!< ghost nodes of the last "ReduceNodes"
+
+    //!> Profiler entries
+    int _profile_migrate;
+    int _profile_reduce;
+
+public:
+    inline Transport_Base* GetTransport() {return _transport;}
+    inline const vector<int>& GetNeighbours() {return _neighbour;}
+    inline MPM_STATS GetMigrated() {return _migrated;}
+    inline MPM_STATS GetGhostNumber() {return _ghost_number;}
+};
+
+#endif
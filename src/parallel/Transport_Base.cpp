@@ -0,0 +1,79 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of class "Transport_Base"
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "Transport_Base.h"
+#include <cstring>
+
+Transport_Base::Transport_Base()
+{
+    _rank = 0;
+    _size = 1;
+}
+
+Transport_Base::~Transport_Base()
+{
+}
+
+bool Transport_Base::AllReduceMin(MPM_FLOAT& value)
+{
+    vector<MPM_FLOAT> values;
+    if (!_AllGather(value, values))
+        return false;
+    value = *min_element(values.begin(), values.end());
+    return true;
+}
+
+bool Transport_Base::AllReduceSum(MPM_FLOAT& value)
+{
+    //!> Summed in the order of ranks, so that all ranks get the same value
+    vector<MPM_FLOAT> values;
+    if (!_AllGather(value, values))
+        return false;
+    value = 0.0;
+    for (MPM_FLOAT v : values)
+        value += v;
+    return true;
+}
+
+bool Transport_Base::_AllGather(MPM_FLOAT value, vector<MPM_FLOAT>& values)
+{
+    vector<int> ranks;
+    for (int r = 0; r < _size; r++)
+        if (r != _rank)
+            ranks.push_back(r);
+
+    vector< vector<char> > send(ranks.size(), vector<char>(sizeof(MPM_FLOAT))), receive;
+    for (auto& buffer : send)
+        memcpy(buffer.data(), &value, sizeof(MPM_FLOAT));
+    if (!Exchange(ranks, send, receive))
+        return false;
+
+    values.assign(_size, value);
+    for (size_t i = 0; i < ranks.size(); i++)
+    {
+        if (receive[i].size() != sizeof(MPM_FLOAT))
+        {
+            MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Wrong message size in a reduction.");
+            return false;
+        }
+        memcpy(&values[ranks[i]], receive[i].data(), sizeof(MPM_FLOAT));
+    }
+    return true;
+}
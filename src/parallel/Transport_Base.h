@@ -0,0 +1,66 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Base class of the message transports between the
+        processes of a domain decomposition. A transport
+        connects "GetSize()" processes, each of them has a rank
+        in [0, GetSize()). Messages are byte buffers exchanged
+        with a list of ranks at once, so that a backend can
+        post all sends and receives before waiting, e.g.
+        MPI_Isend/MPI_Irecv and MPI_Waitall. Reductions are
+        built on "Exchange" and may be overridden by a backend
+        with collective operations.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _TRANSPORT_BASE_H_
+#define _TRANSPORT_BASE_H_
+
+#include "../main/MPM3D_MACRO.h"
+
+class Transport_Base
+{
+public:
+    Transport_Base();
+    virtual ~Transport_Base();
+
+    //!> Send "send[i]" to rank "ranks[i]" and receive "receive[i]" from it, for all i at once
+    //!> A rank listed by this rank should list this rank in the same call, messages between two ranks are
+    //!>    received in the order they are sent. The calling rank should not be listed
+    virtual bool Exchange(const vector<int>& ranks, const vector< vector<char> >& send, 
+        vector< vector<char> >& receive) = 0;
+
+    //!> Minimum and sum of "value" over all ranks, called by all ranks
+    virtual bool AllReduceMin(MPM_FLOAT& value);
+    virtual bool AllReduceSum(MPM_FLOAT& value);
+
+    virtual string GetName() = 0;
+
+    Transport_Base(const Transport_Base&) = delete;
+    Transport_Base& operator=(const Transport_Base&) = delete;
+protected:
+    //!> "value" of all ranks in the order of ranks, by "Exchange" with all other ranks
+    bool _AllGather(MPM_FLOAT value, vector<MPM_FLOAT>& values);
+protected:
+    int _rank;
+    int _size;
+
+public:
+    inline int GetRank() {return _rank;}
+    inline int GetSize() {return _size;}
+};
+
+#endif
@@ -0,0 +1,256 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of class "Transport_Socket"
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "Transport_Socket.h"
+#ifndef _WIN32
+#include <cerrno>
+#include <cstdint>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+Transport_Socket::Transport_Socket()
+{
+}
+
+Transport_Socket::~Transport_Socket()
+{
+    Finalize();
+}
+
+#ifdef _WIN32
+bool Transport_Socket::Initialize(int size)
+{
+    MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Socket transport is not available on Windows.");
+    return false;
+}
+
+bool Transport_Socket::Finalize()
+{
+    return true;
+}
+
+bool Transport_Socket::Exchange(const vector<int>& ranks, const vector< vector<char> >& send, 
+    vector< vector<char> >& receive)
+{
+    return ranks.empty();
+}
+#else
+bool Transport_Socket::Initialize(int size)
+{
+    if (size < 1)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** INPUT ERROR *** Number of processes should be positive.");
+        return false;
+    }
+    Finalize();
+
+    //!> pair[i][j] is the end of rank i of the socket pair between rank i and j
+    vector< vector<int> > pair(size, vector<int>(size, -1));
+    for (int i = 0; i < size; i++)
+        for (int j = i + 1; j < size; j++)
+        {
+            int ends[2];
+            if (socketpair(AF_UNIX, SOCK_STREAM, 0, ends) != 0)
+            {
+                MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Failed to create the socket pairs.");
+                for (auto& row : pair)
+                    for (int fd : row)
+                        if (fd >= 0)
+                            close(fd);
+                return false;
+            }
+            pair[i][j] = ends[0];
+            pair[j][i] = ends[1];
+        }
+
+    //!> Buffered output would be written again by each new process
+    cout << flush;
+    int rank = 0;
+    for (int r = 1; r < size; r++)
+    {
+        pid_t process = fork();
+        if (process == 0)
+        {
+            rank = r;
+            _process.clear();
+            break;
+        }
+        if (process < 0)
+        {
+            //!> The processes already started get end-of-file on their sockets and fail
+            MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Failed to start the processes.");
+            for (auto& row : pair)
+                for (int fd : row)
+                    if (fd >= 0)
+                        close(fd);
+            for (int started : _process)
+                waitpid(started, nullptr, 0);
+            _process.clear();
+            return false;
+        }
+        _process.push_back(process);
+    }
+
+    //!> Each process keeps its own ends
+    for (int i = 0; i < size; i++)
+        for (int j = 0; j < size; j++)
+            if (i != rank && pair[i][j] >= 0)
+                close(pair[i][j]);
+    _socket = pair[rank];
+    for (int fd : _socket)
+        if (fd >= 0)
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    _rank = rank;
+    _size = size;
+    return true;
+}
+
+bool Transport_Socket::Finalize()
+{
+    for (int fd : _socket)
+        if (fd >= 0)
+            close(fd);
+    _socket.clear();
+
+    bool succeeded = true;
+    for (int process : _process)
+    {
+        int status = 0;
+        if (waitpid(process, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+            succeeded = false;
+    }
+    _process.clear();
+    _rank = 0;
+    _size = 1;
+    return succeeded;
+}
+
+bool Transport_Socket::Exchange(const vector<int>& ranks, const vector< vector<char> >& send, 
+    vector< vector<char> >& receive)
+{
+    const size_t number = ranks.size();
+    receive.assign(number, vector<char>());
+    for (int rank : ranks)
+    {
+        if (rank < 0 || rank >= _size || rank == _rank)
+        {
+            MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Invalid rank " + to_string(rank) + 
+                " in a message exchange.");
+            return false;
+        }
+    }
+
+    //!> Bytes of each message sent and received so far, the length first
+    vector<uint64_t> send_length(number), receive_length(number, 0);
+    vector<size_t> sent(number, 0), received(number, 0);
+    for (size_t i = 0; i < number; i++)
+        send_length[i] = send[i].size();
+
+    const size_t header = sizeof(uint64_t);
+    vector<pollfd> poll_list;
+    vector<size_t> poll_peer;
+    while (true)
+    {
+        poll_list.clear();
+        poll_peer.clear();
+        for (size_t i = 0; i < number; i++)
+        {
+            short events = 0;
+            if (sent[i] < header + send_length[i])
+                events |= POLLOUT;
+            if (received[i] < header || received[i] < header + receive_length[i])
+                events |= POLLIN;
+            if (events)
+            {
+                poll_list.push_back({_socket[ranks[i]], events, 0});
+                poll_peer.push_back(i);
+            }
+        }
+        if (poll_list.empty())
+            return true;
+
+        if (poll(poll_list.data(), poll_list.size(), -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Failed to wait for the sockets.");
+            return false;
+        }
+
+        for (size_t k = 0; k < poll_list.size(); k++)
+        {
+            size_t i = poll_peer[k];
+            int fd = poll_list[k].fd;
+            short revents = poll_list[k].revents;
+            if ((revents & POLLOUT) && sent[i] < header + send_length[i])
+            {
+                const char* data = sent[i] < header ? (const char*)&send_length[i] + sent[i] : 
+                    send[i].data() + (sent[i] - header);
+                size_t bytes = sent[i] < header ? header - sent[i] : header + send_length[i] - sent[i];
+                ssize_t written = ::send(fd, data, bytes, MSG_NOSIGNAL);
+                if (written < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                {
+                    MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Failed to send to rank " + 
+                        to_string(ranks[i]) + ".");
+                    return false;
+                }
+                if (written > 0)
+                    sent[i] += written;
+            }
+            if (revents & (POLLIN | POLLHUP | POLLERR))
+            {
+                char* data;
+                size_t bytes;
+                if (received[i] < header)
+                {
+                    data = (char*)&receive_length[i] + received[i];
+                    bytes = header - received[i];
+                }
+                else
+                {
+                    data = receive[i].data() + (received[i] - header);
+                    bytes = header + receive_length[i] - received[i];
+                }
+                if (bytes == 0)
+                    continue;
+
+                ssize_t read_bytes = recv(fd, data, bytes, 0);
+                if (read_bytes == 0 || (read_bytes < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+                {
+                    MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Failed to receive from rank " + 
+                        to_string(ranks[i]) + ".");
+                    return false;
+                }
+                if (read_bytes > 0)
+                {
+                    received[i] += read_bytes;
+                    if (received[i] == header)
+                        receive[i].resize(receive_length[i]);
+                }
+            }
+        }
+    }
+}
+#endif
@@ -0,0 +1,60 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Transport between processes on one Linux machine by
+        Unix domain sockets, for testing the domain
+        decomposition without MPI. "Initialize" forks the
+        processes, every pair of them is connected by a socket
+        pair created before the fork. "Exchange" writes and
+        reads all messages together by poll() on non-blocking
+        sockets, so that large messages in both directions do
+        not block each other. Each message is its length
+        (8 bytes) followed by the bytes.
+        Not available on Windows.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _TRANSPORT_SOCKET_H_
+#define _TRANSPORT_SOCKET_H_
+
+#include "Transport_Base.h"
+
+class Transport_Socket : public Transport_Base
+{
+public:
+    Transport_Socket();
+    virtual ~Transport_Socket();
+
+    //!> Fork "size - 1" processes, the calling process is rank 0 and the new ones continue from this
+    //!>    call with ranks [1, size). Should be called before any thread is started, e.g. by ThreadPool,
+    //!>    since only the calling thread exists in the new processes
+    //!> Return false in the calling process if the sockets or processes are not created
+    bool Initialize(int size);
+
+    //!> Close the sockets, rank 0 waits for the other processes to exit
+    //!> Return false on rank 0 if any of them failed or was killed
+    bool Finalize();
+
+    virtual bool Exchange(const vector<int>& ranks, const vector< vector<char> >& send, 
+        vector< vector<char> >& receive);
+
+    virtual string GetName() {return "Socket";}
+private:
+    vector<int> _socket;    //!< socket connected to each rank, -1 for the rank itself
+    vector<int> _process;   //!< process ID of ranks [1, size) on rank 0
+};
+
+#endif
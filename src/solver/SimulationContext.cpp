@@ -0,0 +1,91 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of class "SimulationContext"
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "SimulationContext.h"
+#include <sstream>
+
+SimulationContext::SimulationContext()
+{
+    ResetTime();
+}
+
+bool SimulationContext::SetTimeStepControl(const TimeStepControl& control)
+{
+    if (control.cfl <= 0.0 || control.cfl > 1.0)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** INPUT ERROR *** CFL number should be in (0, 1].");
+        return false;
+    }
+    if (control.max_growth < 1.0)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** INPUT ERROR *** Growth ratio of time step should not be "
+            "less than 1.");
+        return false;
+    }
+    if (control.min_dt < 0.0 || control.max_dt <= 0.0 || control.min_dt > control.max_dt)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** INPUT ERROR *** Time step bounds should satisfy "
+            "0 <= minimum <= maximum and maximum > 0.");
+        return false;
+    }
+
+    _time_step_control = control;
+    return true;
+}
+
+void SimulationContext::ResetTime()
+{
+    _dtn = 0.0;
+    _dtn1 = 0.0;
+    _dtn1_half = 0.0;
+    _dtx = 0.0;
+    _current_time = 0.0;
+}
+
+void SimulationContext::SetTimeStep(MPM_FLOAT dt)
+{
+    _dtn = dt;
+    _dtn1 = dt;
+    _dtn1_half = dt*0.5;
+    _dtx = dt;
+}
+
+bool SimulationContext::UpdateTimeStep(MPM_FLOAT critical_dt)
+{
+    MPM_FLOAT dt = _time_step_control.cfl*critical_dt;
+    if (_dtn1 > 0.0)
+        dt = min(dt, _time_step_control.max_growth*_dtn1);
+    dt = min(dt, _time_step_control.max_dt);
+
+    if (dt < _time_step_control.min_dt)
+    {
+        ostringstream error_msg;
+        error_msg << "*** Error *** Time step " << dt << " is less than the minimum " << _time_step_control.min_dt
+                  << " at time " << _current_time << ".";
+        MPM3D_ErrorMessage(__FILE__, __LINE__, error_msg.str());
+        return false;
+    }
+
+    _dtn = _dtn1;
+    _dtn1 = dt;
+    _dtn1_half = _dtn1*0.5;
+    _dtx = (_dtn + _dtn1)*0.5;
+    return true;
+}
@@ -0,0 +1,91 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Time state of one simulation, the time steps, the
+        current time and the adaptive time step control. Each
+        solver owns its context and passes it through the
+        stress update to the material models, so that several
+        simulations can run in parallel threads without shared
+        mutable state.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _SIMULATIONCONTEXT_H_
+#define _SIMULATIONCONTEXT_H_
+
+#include "../main/MPM3D_MACRO.h"
+
+//!> Parameters of the adaptive time step, see "SimulationContext::UpdateTimeStep"
+struct TimeStepControl
+{
+    MPM_FLOAT cfl;          //!< Courant number, scale of the critical time step in (0, 1]
+    MPM_FLOAT max_growth;   //!< largest ratio of a time step to the previous one, not less than 1
+    MPM_FLOAT min_dt;       //!< smallest time step, the run should be stopped below it
+    MPM_FLOAT max_dt;       //!< largest time step
+
+    TimeStepControl()
+    {
+        cfl = 0.9;
+        max_growth = 1.1;
+        min_dt = 0.0;
+        max_dt = numeric_limits<MPM_FLOAT>::max();
+    }
+};
+
+class SimulationContext
+{
+public:
+    SimulationContext();
+
+    //!> Parameters of the adaptive time step, return false if they are not valid
+    bool SetTimeStepControl(const TimeStepControl& control);
+
+    //!> Start a new run at time zero without a previous time step
+    void ResetTime();
+
+    //!> Constant time step "dt" without the adaptive control, e.g. for prescribed strain paths
+    void SetTimeStep(MPM_FLOAT dt);
+
+    //!> Advance the time steps with the critical time step of all particles, the minimum returned by
+    //!>    "MaterialFactory::UpdateStressBatch" over all particle ranges, which includes the limits of
+    //!>    each material. The new step is cfl*critical_dt, growing by "max_growth" at most from the
+    //!>    previous one and not larger than "max_dt"
+    //!> Return false if it is less than "min_dt", the time steps are not changed then
+    bool UpdateTimeStep(MPM_FLOAT critical_dt);
+
+    //!> Advance the current time by the time step t^(n+1/2)
+    inline void AdvanceTime() {_current_time += _dtn1;}
+private:
+    MPM_FLOAT _dtn,             //!< Time step: t^(n-1/2) = t^n - t^(n-1)
+              _dtn1,            //!< Time step: t^(n+1/2) = t^(n+1) - t^n
+              _dtn1_half,       //!< Time step: _dtn1*0.5
+              _dtx,             //!< (_dtn + _dtn1)*0.5
+              _current_time;
+    TimeStepControl _time_step_control;
+
+//!> Various Get/Set function
+public:
+    inline MPM_FLOAT GetDTn() const {return _dtn;}
+    inline MPM_FLOAT GetDTn_I() const {return _dtn1;}
+    inline MPM_FLOAT GetDTn_I_Half() const {return _dtn1_half;}
+    inline MPM_FLOAT GetDTx() const {return _dtx;}
+    inline MPM_FLOAT GetCurrentTime() const {return _current_time;}
+    inline void SetCurrentTime(MPM_FLOAT time) {_current_time = time;}
+
+    inline const TimeStepControl& GetTimeStepControl() const {return _time_step_control;}
+};
+
+#endif
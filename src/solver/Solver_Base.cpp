@@ -20,15 +20,10 @@
 
 #include "Solver_Base.h"
 
-MPM_FLOAT Solver_Base::_dtn = 0.0;
-MPM_FLOAT Solver_Base::_dtn1 = 0.0;
-MPM_FLOAT Solver_Base::_dtn1_half = 0.0;
-MPM_FLOAT Solver_Base::_current_time = 0.0;
-
 Solver_Base::Solver_Base()
 {
 }
 
 Solver_Base::~Solver_Base()
 {
-}
\ No newline at end of file
+}
@@ -21,7 +21,7 @@
 #ifndef _SOLVER_BASE_H
 #define _SOLVER_BASE_H
 
-#include "../main/MPM3D_MACRO.h"
+#include "SimulationContext.h"
 
 class Solver_Base
 {
@@ -29,20 +29,12 @@ public:
     Solver_Base();
     ~Solver_Base();
 protected:
-    //!> Global variables which can be obtained by static Get() function
-    static MPM_FLOAT _dtn,             //!< Time step: t^(n-1/2) = t^n - t^(n-1)
-                     _dtn1,            //!< Time step: t^(n+1/2) = t^(n+1) - t^n
-                     _dtn1_half,       //!< Time step: _dtn1*0.5
-                     _dtx,             //!< (_dtn + _dtn1)*0.5
-                     _current_time;
+    //!> Time steps and current time of this simulation, passed to the material models
+    SimulationContext _context;
 
 //!> Various Get/Set function
 public:
-    inline static MPM_FLOAT GetDTn() {return _dtn;}
-    inline static MPM_FLOAT GetDTn_I() {return _dtn1;}
-    inline static MPM_FLOAT GetDTn_I_Half() {return _dtn1_half;}
-    inline static MPM_FLOAT GetDTx() {return _dtx;}
-    inline static MPM_FLOAT GetCurrentTime() {return _current_time;}
+    inline SimulationContext& GetContext() {return _context;}
 };
 
 #endif
\ No newline at end of file
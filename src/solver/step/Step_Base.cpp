@@ -0,0 +1,321 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of class "Step_Base"
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "Step_Base.h"
+#include "../../utility/Profiler.h"
+
+Step_Base::Step_Base()
+{
+    _store = nullptr;
+    _material = nullptr;
+    _grid = nullptr;
+    _shape = nullptr;
+    _transfer = nullptr;
+    _reorder = nullptr;
+    _pool = nullptr;
+    _domain = nullptr;
+    _gravity.fill(0.0);
+    _step = 0;
+
+    _profile_grid = Profiler::Register("Step/Grid");
+    _profile_pass = Profiler::Register("Step/ParticlePass");
+}
+
+Step_Base::~Step_Base()
+{
+}
+
+bool Step_Base::Initialize(ParticleStore* store, MaterialFactory* material, SparseGrid* grid, 
+    ShapeFunction* shape, ParticleToGrid* transfer, const Array3D& gravity)
+{
+    if (!store || !material || !grid || !shape || !transfer)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Particle store, material, grid, shape function "
+            "and transfer are required by the step.");
+        return false;
+    }
+
+    _store = store;
+    _material = material;
+    _grid = grid;
+    _shape = shape;
+    _transfer = transfer;
+    _gravity = gravity;
+    _step = 0;
+
+    //!> Sound speed of the initial state and the first time step
+    PhysicalProperty view;
+    MPM_FLOAT view_extra[MPM::ExtraParticlePropertySum];
+    view.BindExtraParticleProperty(view_extra, _store->GetExtraPropertyPositions());
+    MPM_FLOAT critical_dt = numeric_limits<MPM_FLOAT>::max();
+    for (MPM_STATS p = 0; p < _store->GetActiveNumber(); p++)
+    {
+        _store->Gather(p, &view);
+        _material->SoundSpeed(&view, _context);
+        _store->Scatter(p, &view);
+
+        if (!view.is_Eroded())
+        {
+            MPM_FLOAT speed = sqrt(_store->GetVelocity(0)[p]*_store->GetVelocity(0)[p] + 
+                _store->GetVelocity(1)[p]*_store->GetVelocity(1)[p] + 
+                _store->GetVelocity(2)[p]*_store->GetVelocity(2)[p]);
+            MPM_FLOAT particle_dt = cbrt(view.GetVolume())/(view.GetSoundSpeed() + speed);
+            critical_dt = min(critical_dt, _material->LimitTimeStep(particle_dt));
+        }
+    }
+    if (_domain && !_domain->ReduceTimeStep(critical_dt))
+        return false;
+    if (critical_dt == numeric_limits<MPM_FLOAT>::max())
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** There is no active particle to set the time step.");
+        return false;
+    }
+    _context.ResetTime();
+    return _context.UpdateTimeStep(critical_dt);
+}
+
+void Step_Base::WriteMemory(ostream& os)
+{
+    const double megabyte = 1.0/(1024.0*1024.0);
+    size_t particle_bytes = _store ? _store->GetMemoryBytes() : 0;
+    size_t grid_bytes = _grid ? _grid->GetMemoryBytes() : 0;
+    size_t shape_bytes = _shape ? _shape->GetMemoryBytes() : 0;
+    os << "Memory (MB): particles " << particle_bytes*megabyte << ", grid " << grid_bytes*megabyte
+       << ", shape function cache " << shape_bytes*megabyte << ", total " 
+       << (particle_bytes + grid_bytes + shape_bytes)*megabyte << endl;
+}
+
+bool Step_Base::_BeginStep(ostream& log)
+{
+    if (_domain && !_domain->Migrate(*_store))
+        return false;
+    if (_reorder)
+        _reorder->Update(*_store, _step, log);
+    if (!_grid->Rebuild(*_store, _shape->GetStencilLow(), _shape->GetStencilHigh(), _pool))
+        return false;
+    return _shape->Update(*_store, *_grid, _pool);
+}
+
+bool Step_Base::_EndStep(MPM_FLOAT critical_dt)
+{
+    _store->CompactEroded();
+    _context.AdvanceTime();
+    _step++;
+    if (_domain && !_domain->ReduceTimeStep(critical_dt))
+        return false;
+    //!> The time step is kept if all particles are eroded
+    if (critical_dt < numeric_limits<MPM_FLOAT>::max())
+        return _context.UpdateTimeStep(critical_dt);
+    return true;
+}
+
+bool Step_Base::_TransferToGrid(int quantity)
+{
+    if (!_transfer->Transfer(*_store, *_grid, *_shape, _gravity, quantity))
+        return false;
+    return !_domain || _domain->ReduceNodes(quantity);
+}
+
+template<int Pass>
+MPM_FLOAT Step_Base::_ParticlePass()
+{
+    switch (_shape->GetWidth())
+    {
+    case 2:
+        return _ParticlePassWidth<Pass, 2>();
+    case 3:
+        return _ParticlePassWidth<Pass, 3>();
+    case 4:
+        return _ParticlePassWidth<Pass, 4>();
+    }
+    return numeric_limits<MPM_FLOAT>::max();
+}
+
+template<int Pass, int W>
+MPM_FLOAT Step_Base::_ParticlePassWidth()
+{
+    MPM_STATS active_number = _store->GetActiveNumber();
+    if (!_pool)
+        return _ParticleRange<Pass, W>(0, active_number);
+
+    //!> Passes with the stress update are split by the particle costs of the last update, which differ by
+    //!>    materials and by yielding, others by number
+    _thread_critical_dt.assign(_pool->GetThreadNumber(), numeric_limits<MPM_FLOAT>::max());
+    auto range = [this](MPM_STATS begin, MPM_STATS end, int thread_id)
+    {
+        MPM_FLOAT range_dt = _ParticleRange<Pass, W>(begin, end);
+        _thread_critical_dt[thread_id] = min(_thread_critical_dt[thread_id], range_dt);
+    };
+    if (Pass & Stress)
+        _pool->ParallelForBalanced(0, active_number, _store->GetCost(), range);
+    else
+        _pool->ParallelFor(0, active_number, range);
+    return *min_element(_thread_critical_dt.begin(), _thread_critical_dt.end());
+}
+
+template<int Pass, int W>
+MPM_FLOAT Step_Base::_ParticleRange(MPM_STATS begin, MPM_STATS end)
+{
+    const MPM_FLOAT dt = _context.GetDTn_I();
+
+    MPM_FLOAT* position[3] = {_store->GetPosition(0), _store->GetPosition(1), _store->GetPosition(2)};
+    MPM_FLOAT* velocity[3] = {_store->GetVelocity(0), _store->GetVelocity(1), _store->GetVelocity(2)};
+    MPM_FLOAT* mass = _store->GetMass();
+    MPM_FLOAT* volume = _store->GetVolume();
+    MPM_FLOAT* density = _store->GetDensity();
+
+    MPM_FLOAT* node_mass = _grid->GetMass();
+    MPM_FLOAT* node_momentum[3] = {_grid->GetMomentum(0), _grid->GetMomentum(1), _grid->GetMomentum(2)};
+    MPM_FLOAT* node_force[3] = {_grid->GetForce(0), _grid->GetForce(1), _grid->GetForce(2)};
+    MPM_FLOAT* node_velocity[3] = {_grid->GetVelocity(0), _grid->GetVelocity(1), _grid->GetVelocity(2)};
+
+    //!> Views and increments of one chunk for the stress update, all on stack
+    PhysicalProperty view[MPM::ParticleChunkSize];
+    MPM_FLOAT view_extra[MPM::ParticleChunkSize*MPM::ExtraParticlePropertySum];
+    SymTensor delta_strain[MPM::ParticleChunkSize];
+    SymTensor delta_vortex[MPM::ParticleChunkSize];
+    MPM_FLOAT volume_old[MPM::ParticleChunkSize];
+    MPM_FLOAT speed[MPM::ParticleChunkSize];
+    if (Pass & Stress)
+    {
+        for (MPM_STATS k = 0; k < MPM::ParticleChunkSize; k++)
+            view[k].BindExtraParticleProperty(view_extra + k*MPM::ExtraParticlePropertySum, 
+                _store->GetExtraPropertyPositions());
+    }
+
+    MPM_FLOAT critical_dt = numeric_limits<MPM_FLOAT>::max();
+    for (MPM_STATS chunk_begin = begin; chunk_begin < end; chunk_begin += MPM::ParticleChunkSize)
+    {
+        MPM_STATS number = min(MPM::ParticleChunkSize, end - chunk_begin);
+        {
+            ProfileScope profile(_profile_pass, number);
+            for (MPM_STATS k = 0; k < number; k++)
+            {
+                MPM_STATS p = chunk_begin + k;
+
+                //!> Cached shape functions at the position before the pass
+                const MPM_FLOAT* row = _shape->GetWeight(p);
+                const MPM_FLOAT* wx = row;
+                const MPM_FLOAT* wy = row + W;
+                const MPM_FLOAT* wz = row + 2*W;
+                const MPM_FLOAT* gx = row + 3*W;
+                const MPM_FLOAT* gy = row + 4*W;
+                const MPM_FLOAT* gz = row + 5*W;
+                const MPM_STATS* nodes = _shape->GetNode(p);
+
+                //!> Gather of the node values, L[i][j] = dv_i/dx_j
+                MPM_FLOAT acceleration[3] = {0.0, 0.0, 0.0};
+                MPM_FLOAT moving[3] = {0.0, 0.0, 0.0};
+                MPM_FLOAT L[3][3] = {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+                for (int oz = 0; oz < W; oz++)
+                    for (int oy = 0; oy < W; oy++)
+                    {
+                        MPM_FLOAT weight_yz = wy[oy]*wz[oz];
+                        MPM_FLOAT gradient_y = gy[oy]*wz[oz];
+                        MPM_FLOAT gradient_z = wy[oy]*gz[oz];
+                        const MPM_STATS* line = nodes + W*(oy + W*oz);
+                        for (int ox = 0; ox < W; ox++)
+                        {
+                            MPM_STATS node = line[ox];
+                            if (node_mass[node] <= 0.0)
+                                continue;
+
+                            MPM_FLOAT weight = wx[ox]*weight_yz;
+                            if (Pass & Acceleration)
+                            {
+                                MPM_FLOAT factor = weight/node_mass[node];
+                                for (int i = 0; i < 3; i++)
+                                    acceleration[i] += factor*node_force[i][node];
+                            }
+                            if (Pass & Position)
+                            {
+                                for (int i = 0; i < 3; i++)
+                                    moving[i] += weight*node_velocity[i][node];
+                            }
+                            if (Pass & Stress)
+                            {
+                                MPM_FLOAT grad[3] = {gx[ox]*weight_yz, wx[ox]*gradient_y, wx[ox]*gradient_z};
+                                for (int i = 0; i < 3; i++)
+                                {
+                                    MPM_FLOAT v = (Pass & RemappedGradient) ? 
+                                        node_momentum[i][node]/node_mass[node] : node_velocity[i][node];
+                                    for (int j = 0; j < 3; j++)
+                                        L[i][j] += v*grad[j];
+                                }
+                            }
+                        }
+                    }
+                if (Pass & Acceleration)
+                {
+                    for (int i = 0; i < 3; i++)
+                        velocity[i][p] += dt*acceleration[i];
+                }
+                if (Pass & Position)
+                {
+                    for (int i = 0; i < 3; i++)
+                        position[i][p] += dt*moving[i];
+                }
+                if (Pass & Stress)
+                {
+                    //!> Engineering shear strain, and the spin in the convention of "StressRotationJaumann"
+                    SymTensor& de = delta_strain[k];
+                    de[0] = L[0][0]*dt;
+                    de[1] = L[1][1]*dt;
+                    de[2] = L[2][2]*dt;
+                    de[3] = (L[1][2] + L[2][1])*dt;
+                    de[4] = (L[0][2] + L[2][0])*dt;
+                    de[5] = (L[0][1] + L[1][0])*dt;
+                    SymTensor& dv = delta_vortex[k];
+                    dv[0] = 0.5*(L[2][1] - L[1][2])*dt;
+                    dv[1] = 0.5*(L[0][2] - L[2][0])*dt;
+                    dv[2] = 0.5*(L[1][0] - L[0][1])*dt;
+                    dv[3] = dv[4] = dv[5] = 0.0;
+
+                    volume_old[k] = volume[p];
+                    volume[p] *= 1.0 + de[0] + de[1] + de[2];
+                    density[p] = mass[p]/volume[p];
+                    speed[k] = sqrt(velocity[0][p]*velocity[0][p] + velocity[1][p]*velocity[1][p] + 
+                        velocity[2][p]*velocity[2][p]);
+                    _store->Gather(p, view + k);
+                }
+            }
+        }
+
+        if (Pass & Stress)
+        {
+            MPM_FLOAT chunk_dt = _material->UpdateStressBatch(view, delta_strain, delta_vortex, volume_old, 
+                number, _context, speed, _store->GetCost() + chunk_begin);
+            critical_dt = min(critical_dt, chunk_dt);
+            for (MPM_STATS k = 0; k < number; k++)
+                _store->Scatter(chunk_begin + k, view + k);
+        }
+    }
+    return critical_dt;
+}
+
+//!> Passes of the schemes, see "Step_USL", "Step_MUSL" and "Step_USF"
+template MPM_FLOAT Step_Base::_ParticlePass<Step_Base::Acceleration | Step_Base::Position | Step_Base::Stress>();
+template MPM_FLOAT Step_Base::_ParticlePass<Step_Base::Acceleration>();
+template MPM_FLOAT Step_Base::_ParticlePass<Step_Base::Position | Step_Base::Stress | Step_Base::RemappedGradient>();
+template MPM_FLOAT Step_Base::_ParticlePass<Step_Base::Stress>();
+template MPM_FLOAT Step_Base::_ParticlePass<Step_Base::Acceleration | Step_Base::Position>();
+//!> Passes of single operations, which run the fused passes above one after another
+template MPM_FLOAT Step_Base::_ParticlePass<Step_Base::Position>();
+template MPM_FLOAT Step_Base::_ParticlePass<Step_Base::Stress | Step_Base::RemappedGradient>();
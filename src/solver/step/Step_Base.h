@@ -0,0 +1,125 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Base class of the time step drivers of the MPM
+        schemes (USL, MUSL, USF) on one body and the sparse
+        background grid. The grid-to-particle gather is fused
+        with the particle updates of the scheme: velocity and
+        velocity gradient at the nodes of the particle,
+        strain and vorticity increments, volume and density,
+        the stress update by MaterialFactory, and the particle
+        velocity and position, in one pass over the particles
+        in chunks of "MPM::ParticleChunkSize".
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _STEP_BASE_H_
+#define _STEP_BASE_H_
+
+#include "../Solver_Base.h"
+#include "../../material/MaterialFactory.h"
+#include "../../body/ParticleReorder.h"
+#include "../../grid/ParticleToGrid.h"
+#include "../../parallel/DomainDecomposition.h"
+
+class Step_Base : public Solver_Base
+{
+public:
+    Step_Base();
+    virtual ~Step_Base();
+
+    //!> The body is a particle store of one material
+    //!> The time is reset, sound speeds of the particles are initialized by the material and the first
+    //!>    time step by them, controlled by the "TimeStepControl" of "GetContext()"
+    bool Initialize(ParticleStore* store, MaterialFactory* material, SparseGrid* grid, ShapeFunction* shape,
+        ParticleToGrid* transfer, const Array3D& gravity);
+
+    //!> Reorder the particles by "ParticleReorder::Update" at the start of each step, nullptr to disable
+    inline void SetReorder(ParticleReorder* reorder) {_reorder = reorder;}
+
+    //!> Run the particle passes, the grid node loops and the shape function update on the threads of
+    //!>    "pool", nullptr for the calling thread. Particle passes use the schedule of the pool, on ranges
+    //!>    balanced by the particle costs for passes with the stress update
+    //!> The transfer runs on the pool given to "ParticleToGrid::Initialize"
+    inline void SetThreadPool(ThreadPool* pool) {_pool = pool;}
+
+    //!> Run the body on the subdomain of this rank, nullptr for a single process. Called before "Initialize"
+    //!> Particles migrate at the start of each step, node values are reduced after each transfer and the
+    //!>    time step is the minimum of all ranks
+    inline void SetDomain(DomainDecomposition* domain) {_domain = domain;}
+
+    //!> Advance one time step, the locality of reordering is written to "log"
+    virtual bool Solve(ostream& log) = 0;
+
+    virtual MPM::MPMScheme GetScheme() = 0;
+
+    //!> Memory of the particles, the grid and the shape function cache
+    void WriteMemory(ostream& os);
+protected:
+    //!> Operations of a particle pass, combined by bitwise or
+    enum ParticlePass
+    {
+        Acceleration = 1,       //!< particle velocity by the node acceleration (force/mass)
+        Position = 2,           //!< particle position by the node velocity
+        Stress = 4,             //!< velocity gradient, strain/vorticity increments, volume, density and stress
+        RemappedGradient = 8    //!< velocity gradient by the remapped node momentum/mass instead of the node velocity
+    };
+
+    //!> Reorder the particles, rebuild the grid for the stencil of the shape function and update the
+    //!>    shape function cache, which is used by all transfers and passes of the step
+    bool _BeginStep(ostream& log);
+
+    //!> Erase eroded particles, advance the time and the time step by the critical time step
+    //!> Return false if the time step is less than the minimum
+    bool _EndStep(MPM_FLOAT critical_dt);
+
+    //!> Transfer "quantity" to the grid, and reduce the node values over the subdomains
+    bool _TransferToGrid(int quantity = ParticleToGrid::All);
+
+    //!> One pass over the active particles, shape functions are evaluated at the positions before the pass
+    //!> Return the critical time step of the stress update, the maximum value if "Stress" is not included
+    template<int Pass>
+    MPM_FLOAT _ParticlePass();
+
+    //!> Pass of stencil width W
+    template<int Pass, int W>
+    MPM_FLOAT _ParticlePassWidth();
+
+    //!> Pass over the particles [begin, end), return the critical time step of the range
+    template<int Pass, int W>
+    MPM_FLOAT _ParticleRange(MPM_STATS begin, MPM_STATS end);
+protected:
+    ParticleStore* _store;
+    MaterialFactory* _material;
+    SparseGrid* _grid;
+    ShapeFunction* _shape;
+    ParticleToGrid* _transfer;
+    ParticleReorder* _reorder;
+    ThreadPool* _pool;
+    DomainDecomposition* _domain;
+    Array3D _gravity;
+    int _step;
+    vector<MPM_FLOAT> _thread_critical_dt;  //!< critical time step of the ranges of each thread in a pass
+
+    //!> Profiler entries
+    int _profile_grid;
+    int _profile_pass;
+
+public:
+    inline int GetStep() {return _step;}
+};
+
+#endif
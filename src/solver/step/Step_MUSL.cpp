@@ -0,0 +1,51 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of class "Step_MUSL"
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "Step_MUSL.h"
+#include "../../utility/Profiler.h"
+
+Step_MUSL::Step_MUSL()
+{
+}
+
+Step_MUSL::~Step_MUSL()
+{
+}
+
+bool Step_MUSL::Solve(ostream& log)
+{
+    if (!_BeginStep(log))
+        return false;
+    if (!_TransferToGrid())
+        return false;
+    {
+        ProfileScope profile(_profile_grid, _grid->GetNodeNumber());
+        _grid->IntegrateMomentum(_context.GetDTn_I(), _pool);
+    }
+    _ParticlePass<Acceleration>();
+
+    //!> The node velocity is kept for the particle position, the remapped momentum gives the velocity gradient
+    _grid->ResetMomentum(_pool);
+    if (!_TransferToGrid(ParticleToGrid::Momentum))
+        return false;
+
+    MPM_FLOAT critical_dt = _ParticlePass<Position | Stress | RemappedGradient>();
+    return _EndStep(critical_dt);
+}
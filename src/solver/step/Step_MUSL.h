@@ -0,0 +1,42 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Modified update-stress-last step. After the node
+        momentum is integrated, the particle velocity is updated
+        and its momentum is mapped to the grid again. The stress
+        is updated by the remapped node velocity, in the same
+        pass as the particle position by the node velocity
+        before the remapping.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _STEP_MUSL_H_
+#define _STEP_MUSL_H_
+
+#include "Step_Base.h"
+
+class Step_MUSL : public Step_Base
+{
+public:
+    Step_MUSL();
+    ~Step_MUSL();
+
+    bool Solve(ostream& log);
+
+    inline MPM::MPMScheme GetScheme() {return MPM::MUSL;}
+};
+
+#endif
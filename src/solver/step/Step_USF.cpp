@@ -0,0 +1,52 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of class "Step_USF"
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "Step_USF.h"
+#include "../../utility/Profiler.h"
+
+Step_USF::Step_USF()
+{
+}
+
+Step_USF::~Step_USF()
+{
+}
+
+bool Step_USF::Solve(ostream& log)
+{
+    if (!_BeginStep(log))
+        return false;
+    if (!_TransferToGrid(ParticleToGrid::Mass | ParticleToGrid::Momentum))
+        return false;
+    {
+        ProfileScope profile(_profile_grid, _grid->GetNodeNumber());
+        _grid->UpdateVelocity(_pool);
+    }
+    MPM_FLOAT critical_dt = _ParticlePass<Stress>();
+
+    if (!_TransferToGrid(ParticleToGrid::Force))
+        return false;
+    {
+        ProfileScope profile(_profile_grid, _grid->GetNodeNumber());
+        _grid->IntegrateMomentum(_context.GetDTn_I(), _pool);
+    }
+    _ParticlePass<Acceleration | Position>();
+    return _EndStep(critical_dt);
+}
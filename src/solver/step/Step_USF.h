@@ -0,0 +1,42 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Update-stress-first step. The stress is updated by
+        the node velocity of the mapped momentum before the
+        internal force is mapped with the new stress, then the
+        particle velocity and position are updated by the
+        integrated node momentum. The stress update needs its
+        own pass because the force depends on its result.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _STEP_USF_H_
+#define _STEP_USF_H_
+
+#include "Step_Base.h"
+
+class Step_USF : public Step_Base
+{
+public:
+    Step_USF();
+    ~Step_USF();
+
+    bool Solve(ostream& log);
+
+    inline MPM::MPMScheme GetScheme() {return MPM::USF;}
+};
+
+#endif
@@ -0,0 +1,45 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of class "Step_USL"
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "Step_USL.h"
+#include "../../utility/Profiler.h"
+
+Step_USL::Step_USL()
+{
+}
+
+Step_USL::~Step_USL()
+{
+}
+
+bool Step_USL::Solve(ostream& log)
+{
+    if (!_BeginStep(log))
+        return false;
+    if (!_TransferToGrid())
+        return false;
+    {
+        ProfileScope profile(_profile_grid, _grid->GetNodeNumber());
+        _grid->IntegrateMomentum(_context.GetDTn_I(), _pool);
+    }
+
+    MPM_FLOAT critical_dt = _ParticlePass<Acceleration | Position | Stress>();
+    return _EndStep(critical_dt);
+}
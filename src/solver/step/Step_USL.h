@@ -0,0 +1,40 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Update-stress-last step. Particle values are mapped
+        to the grid, the node momentum is integrated, and one
+        fused pass updates the particle velocity, the stress by
+        the new node velocity and the particle position.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _STEP_USL_H_
+#define _STEP_USL_H_
+
+#include "Step_Base.h"
+
+class Step_USL : public Step_Base
+{
+public:
+    Step_USL();
+    ~Step_USL();
+
+    bool Solve(ostream& log);
+
+    inline MPM::MPMScheme GetScheme() {return MPM::USL;}
+};
+
+#endif
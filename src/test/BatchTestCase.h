@@ -0,0 +1,81 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Population and comparisons shared by the tests of
+        the batch kernels, StrengthBatchTest and EOSBatchTest.
+        The population straddles the chunks of the batch
+        update, and covers compression and expansion, energy
+        and pressure of both signs, failed particles, several
+        temperatures and detonation times.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _BATCHTESTCASE_H_
+#define _BATCHTESTCASE_H_
+
+#include "../body/ExtraPropertyArena.h"
+#include "../material/DataTransfer.h"
+#include <cstring>
+
+//!> Two chunks and a partial one, the last chunk is not a multiple of the vector width either
+const MPM_STATS TestParticleNumber = 2*MPM::ParticleChunkSize + 13;
+const MPM_FLOAT TestVolume = 1.0e-9;
+
+//!> Relative volume from 0.7 to 2.5, internal energy and pressure of both signs, every 11th particle failed
+//!> Light times of the detonation front through the population around 0.5e-6, temperatures from room
+//!>    temperature up by 600 K, and the initial yield stress of "transfer"
+inline bool TestPopulate(vector<PhysicalProperty>& pp, ExtraPropertyArena& arena, MPM_FLOAT density,
+    MPM_FLOAT energy_scale, const DataTransfer& transfer)
+{
+    if (!arena.Allocate(pp.data(), pp.size()))
+        return false;
+    for (MPM_STATS i = 0; i < (MPM_STATS)pp.size(); i++)
+    {
+        pp[i].SetMass(density*TestVolume);
+        pp[i].SetVolume(TestVolume*(0.7 + 1.8*(i%37)/36.0));
+        pp[i].UpdateDensity();
+        pp[i].SetInternalEnergy(energy_scale*TestVolume*((i%13) - 3)/9.0);
+        pp[i].SetMeanStress(1.0e8*((i%7) - 4));
+        if (i%11 == 0)
+            pp[i].Failed();
+        if (pp[i].HasExtraParticleProperty(MPM::LT))
+            pp[i][MPM::LT] = 1.0e-6*(i%101)/100.0;
+        if (pp[i].HasExtraParticleProperty(MPM::kelvin))
+            pp[i][MPM::kelvin] = transfer.roomt + 100.0*(i%7);
+        if (pp[i].HasExtraParticleProperty(MPM::sigma_y))
+            pp[i][MPM::sigma_y] = transfer.sigma_y;
+    }
+    return true;
+}
+
+template<class T>
+inline bool BitwiseEqual(const T& a, const T& b)
+{
+    return memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+//!> Whether two results are equal, bitwise for "tolerance" 0
+inline bool TestEqual(MPM_FLOAT a, MPM_FLOAT b, MPM_FLOAT tolerance, MPM_FLOAT& difference)
+{
+    if (tolerance == 0.0)
+        return BitwiseEqual(a, b);
+    MPM_FLOAT scale = max(fabs(a), fabs(b));
+    MPM_FLOAT relative = scale > 0.0 ? fabs(a - b)/scale : 0.0;
+    difference = max(difference, relative);
+    return relative <= tolerance;
+}
+
+#endif
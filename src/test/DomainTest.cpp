@@ -0,0 +1,106 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Test of the domain decomposition. Two elastic cubes
+        moving towards and past each other, stretched and
+        sheared, are run by the USL scheme on processes connected by
+        "Transport_Socket" in the division given by the
+        arguments, and by a single process. The particles of
+        all ranks are gathered to rank 0 by their IDs and must
+        be the same particles, with positions, velocities and
+        stresses equal to the single process up to the order
+        of the sums of node values ("ReduceNodes"). Particles
+        must have migrated between the ranks.
+    Usage: MPM3D_DomainTest [DX DY DZ]
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "../benchmark/DomainCase.h"
+#include "../parallel/Transport_Socket.h"
+
+//!> Sums of node values in another order on each rank, over the steps
+const MPM_FLOAT TestTolerance = 1.0e4*MPM_EPSILON;
+const int TestEdge = 8;
+const int TestSteps = 40;
+
+int main(int argc, char* argv[])
+{
+    int division[3] = {2, 1, 1};
+    for (int k = 0; k < 3 && argc > 3; k++)
+        division[k] = atoi(argv[1 + k]);
+    if (division[0] <= 0 || division[1] <= 0 || division[2] <= 0)
+    {
+        cout << "Usage: " << argv[0] << " [DX DY DZ]" << endl;
+        return 1;
+    }
+
+    //!> Processes are forked before anything else, only rank 0 prints
+    Transport_Socket transport;
+    if (!transport.Initialize(division[0]*division[1]*division[2]))
+    {
+#ifdef _WIN32
+        cout << "Transport_Socket is not available, skipped" << endl;
+        return 0;
+#else
+        return 1;
+#endif
+    }
+    vector<MPM_FLOAT> state, all;
+    MPM_STATS migrated = 0;
+    uint64_t time_ns = 0;
+    if (!DomainCase_Simulate(&transport, division, TestEdge, TestSteps, false, state, migrated, time_ns) ||
+        !DomainCase_Gather(&transport, state, all))
+        return 1;
+    MPM_FLOAT total_migrated = (MPM_FLOAT)migrated;
+    MPM_FLOAT particle_number = (MPM_FLOAT)state.size()/(1 + DomainCase_StateNumber);
+    if (!transport.AllReduceSum(total_migrated) || !transport.AllReduceSum(particle_number))
+        return 1;
+    if (transport.GetRank() != 0)
+        return transport.Finalize() ? 0 : 1;
+
+    vector<MPM_FLOAT> reference_state, reference, reversed_state, reversed;
+    MPM_STATS single_migrated = 0;
+    const int single[3] = {1, 1, 1};
+    if (!DomainCase_Simulate(nullptr, single, TestEdge, TestSteps, false, reference_state, single_migrated, time_ns))
+        return 1;
+    if (!DomainCase_Simulate(nullptr, single, TestEdge, TestSteps, true, reversed_state, single_migrated, time_ns))
+        return 1;
+    DomainCase_SortByID(reference_state, reference);
+    DomainCase_SortByID(reversed_state, reversed);
+    bool passed = transport.Finalize();
+
+    string name = to_string(division[0]) + "x" + to_string(division[1]) + "x" + to_string(division[2]);
+    if (all.size() != reference.size() || (size_t)particle_number != reference.size()/DomainCase_StateNumber)
+    {
+        cout << "*** Error *** " << name << ": " << (MPM_STATS)particle_number << " particles, "
+             << reference.size()/DomainCase_StateNumber << " in the single process" << endl;
+        return 1;
+    }
+    MPM_FLOAT difference = DomainCase_Difference(all, reference);
+    bool matched = difference <= TestTolerance;
+    cout << (matched ? "" : "*** Error *** ") << name << ": relative difference to the single process "
+         << difference << ", in reverse order " << DomainCase_Difference(reversed, reference) << ", migrated "
+         << (MPM_STATS)total_migrated << endl;
+    passed = matched && passed;
+
+    //!> The cubes move across the cuts of every direction
+    if (division[0]*division[1]*division[2] > 1 && total_migrated == 0)
+    {
+        cout << "*** Error *** " << name << ": no particle migrated" << endl;
+        passed = false;
+    }
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,144 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Test of the EOS batch kernels. A population in
+        compression and expansion, some of it failed and some
+        of it detonated, is evaluated by chunks of
+        "SoundSpeedSquareBatch_EOS" and "UpdatePressureBatch"
+        with a partial last chunk, and particle by particle by
+        "SoundSpeedSquare_EOS" and "UpdatePressure". Gruneisen,
+        SimGruneisen and Polynomial must be bitwise identical.
+        JWL and HighExpBurn use "VectorExp" of a few ulp, so
+        they are compared with a relative tolerance.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "../material/MaterialKernel.h"
+#include "../material/eos/EOS_Gruneisen.h"
+#include "../material/eos/EOS_SimpleGruneisen.h"
+#include "../material/eos/EOS_Polynomial.h"
+#include "../material/eos/EOS_JWL.h"
+#include "../material/eos/EOS_HighExpBurn.h"
+#include "../solver/SimulationContext.h"
+#include "BatchTestCase.h"
+
+//!> "VectorExp" of JWL and HighExpBurn differs from "exp" by a few ulp, amplified by the differences of
+//!>    the exponential terms
+const MPM_FLOAT TestExpTolerance = 64.0*MPM_EPSILON;
+
+template<class Model>
+static bool TestModel(string name, map<string, MPM_FLOAT> eos_para, MPM_FLOAT density, MPM_FLOAT energy_scale,
+    MPM_FLOAT tolerance)
+{
+    Model eos;
+    if (!eos.Initialize(eos_para, density))
+        return false;
+
+    vector<MPM::ExtraParticleProperty> extra_list;
+    DataTransfer transfer;
+    if (!eos.AddExtraParticleProperty_EOS(extra_list, transfer))
+        return false;
+
+    vector<PhysicalProperty> pp(TestParticleNumber);
+    ExtraPropertyArena arena;
+    if (!arena.Initialize(TestParticleNumber, extra_list) ||
+        !TestPopulate(pp, arena, density, energy_scale, transfer))
+        return false;
+
+    SimulationContext context;
+    context.SetTimeStep(1.0e-8);
+    context.SetCurrentTime(0.5e-6);
+    transfer.context = &context;
+
+    StressChunk chunk;
+    chunk.eos_batch.context = &context;
+    MPM_FLOAT difference = 0.0;
+    for (MPM_STATS begin = 0; begin < TestParticleNumber; begin += MPM::ParticleChunkSize)
+    {
+        MPM_STATS number = min(MPM::ParticleChunkSize, TestParticleNumber - begin);
+        chunk.PackEOSBatch(&pp[begin], number);
+        for (MPM_STATS i = 0; i < number; i++)
+        {
+            chunk.delta_vol_half[i] = 0.01*TestVolume*(((begin + i)%5) - 2);
+            chunk.delta_ie[i] = 1.0e-3*energy_scale*TestVolume*(((begin + i)%3) - 1);
+        }
+        if (!eos.SoundSpeedSquareBatch_EOS(chunk.eos_batch) || !eos.UpdatePressureBatch(chunk.eos_batch))
+        {
+            cout << "*** Error *** " << name << " has no batch kernel" << endl;
+            return false;
+        }
+
+        for (MPM_STATS i = 0; i < number; i++)
+        {
+            PhysicalProperty& p = pp[begin + i];
+            MPM_FLOAT sound_speed_square = eos.SoundSpeedSquare_EOS(&p, transfer);
+            eos.UpdatePressure(&p, chunk.delta_vol_half[i], chunk.delta_ie[i], transfer);
+
+            string field;
+            if (!TestEqual(sound_speed_square, chunk.eos_sound_speed_square[i], tolerance, difference))
+                field = "squared sound speed";
+            else if (!TestEqual(p.GetMeanStress(), chunk.mean_stress[i], tolerance, difference))
+                field = "mean stress";
+            if (!field.empty())
+            {
+                cout << "*** Error *** " << name << ": " << field << " of particle " << begin + i << " differs" << endl;
+                return false;
+            }
+        }
+    }
+
+    if (tolerance == 0.0)
+        cout << name << ": identical" << endl;
+    else
+        cout << name << ": maximum relative difference " << difference << " within " << tolerance << endl;
+    return true;
+}
+
+int main()
+{
+    map<string, MPM_FLOAT> gruneisen;
+    gruneisen["C0"] = 4570.0;
+    gruneisen["S1"] = 1.49;
+    gruneisen["gamma0"] = 1.93;
+
+    map<string, MPM_FLOAT> polynomial;
+    polynomial["c1"] = 2.2e9;
+    polynomial["c2"] = 9.54e9;
+    polynomial["c3"] = 1.457e10;
+    polynomial["c4"] = 0.28;
+    polynomial["c5"] = 0.28;
+
+    map<string, MPM_FLOAT> jwl;
+    jwl["A"] = 3.712e11;
+    jwl["B"] = 3.231e9;
+    jwl["R1"] = 4.15;
+    jwl["R2"] = 0.95;
+    jwl["w"] = 0.3;
+    jwl["E0"] = 7.0e9;
+
+    map<string, MPM_FLOAT> high_exp_burn = jwl;
+    high_exp_burn["D"] = 6930.0;
+    high_exp_burn["PCJ"] = 2.1e10;
+    high_exp_burn["h"] = 0.01;
+
+    bool passed = true;
+    passed = TestModel<EOS_Gruneisen>("Gruneisen", gruneisen, 7830.0, 1.0e9, 0.0) && passed;
+    passed = TestModel<EOS_SimpleGruneisen>("SimGruneisen", gruneisen, 7830.0, 1.0e9, 0.0) && passed;
+    passed = TestModel<EOS_Polynomial>("Polynomial", polynomial, 1000.0, 1.0e8, 0.0) && passed;
+    passed = TestModel<EOS_JWL>("JWL", jwl, 1630.0, 7.0e9, TestExpTolerance) && passed;
+    passed = TestModel<EOS_HighExpBurn>("HighExpBurn", high_exp_burn, 1630.0, 7.0e9, TestExpTolerance) && passed;
+    return passed ? 0 : 1;
+}
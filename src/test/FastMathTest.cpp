@@ -0,0 +1,139 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Test of the error bounds stated in "FastMath.h".
+        FastLog is sampled over all normal numbers and close to
+        1, FastExp over its whole range and FastPow over the
+        inputs of the Johnson-Cook models and a wider range,
+        each against the standard library, for the double and
+        the float versions. The errors of "FastMath_SampleError"
+        are checked with the bounds of MPM_FLOAT.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "../utility/mathfunction/FastMath.h"
+#include <cmath>
+#include <random>
+
+//!> Maximum relative errors stated in "FastMath.h"
+const double FastLogBound = 2.1e-9;
+const double FastExpBound = 7.5e-9;
+const double FastPowBound = 7.5e-9;     //!< times (1 + |y*log(x)|)
+const double FastLogFloatBound = 2.5e-7;
+const double FastExpFloatBound = 1.2e-7;
+const double FastPowFloatBound = 2.0e-7;    //!< times (1 + |y*log(x)|)
+
+//!> Bounds of "FastMath_SampleError", log, exp and pow of the hardening and damage laws
+#ifdef _MPM_DOUBLE
+const double TestSampleBound[3] = {FastLogBound, FastExpBound, 1.0e-7};
+#else
+const double TestSampleBound[3] = {FastLogFloatBound, FastExpFloatBound, 4.0e-6};
+#endif
+
+const int TestSampleNumber = 1000000;
+
+static bool TestBound(string name, double error, double bound)
+{
+    bool passed = error <= bound;
+    cout << (passed ? "" : "*** Error *** ") << name << ": maximum relative error " << error
+         << (passed ? " within " : " beyond ") << bound << endl;
+    return passed;
+}
+
+int main()
+{
+    mt19937_64 generator(20261016);
+    uniform_real_distribution<double> unit(0.0, 1.0);
+
+    double log_error = 0.0, exp_error = 0.0, pow_error = 0.0, pow_wide_error = 0.0;
+    for (int i = 0; i < TestSampleNumber; i++)
+    {
+        double s = unit(generator), t = unit(generator);
+
+        //!> Normal numbers by exponent, and close to 1 where log(x) is small
+        double x = i%3 == 0 ? ldexp(1.0 + t, -1022 + (int)(2046.0*s)) : 1.0 + 0.2*(s - 0.5)*pow(10.0, -6.0*t);
+        double reference = log(x);
+        if (reference != 0.0)
+            log_error = max(log_error, fabs(FastLog(x) - reference)/fabs(reference));
+
+        x = -708.0 + 1417.0*s;
+        reference = exp(x);
+        exp_error = max(exp_error, fabs(FastExp(x) - reference)/reference);
+
+        //!> Plastic strain and dimensionless temperature with the exponents of the hardening laws
+        x = pow(10.0, -6.0 + 7.0*s);
+        double y = -1.0 + 3.0*t;
+        reference = pow(x, y);
+        pow_error = max(pow_error, fabs(FastPow(x, y) - reference)/reference/(1.0 + fabs(y*log(x))));
+
+        x = pow(10.0, -100.0 + 200.0*s);
+        y = -3.0 + 6.0*t;
+        reference = pow(x, y);
+        pow_wide_error = max(pow_wide_error, fabs(FastPow(x, y) - reference)/reference/(1.0 + fabs(y*log(x))));
+    }
+
+    bool passed = true;
+    passed = TestBound("FastLog", log_error, FastLogBound) && passed;
+    passed = TestBound("FastExp", exp_error, FastExpBound) && passed;
+    passed = TestBound("FastPow/(1 + |y*log(x)|)", pow_error, FastPowBound) && passed;
+    passed = TestBound("FastPow/(1 + |y*log(x)|), 1e-100 < x < 1e100", pow_wide_error, FastPowBound) && passed;
+
+    //!> The same for float, against the standard library in double
+    log_error = exp_error = pow_error = pow_wide_error = 0.0;
+    for (int i = 0; i < TestSampleNumber; i++)
+    {
+        double s = unit(generator), t = unit(generator);
+
+        float x = i%3 == 0 ? ldexpf(1.0f + (float)t, -126 + (int)(253.0*s)) :
+            (float)(1.0 + 0.2*(s - 0.5)*pow(10.0, -6.0*t));
+        double reference = log((double)x);
+        if (reference != 0.0)
+            log_error = max(log_error, fabs(FastLog(x) - reference)/fabs(reference));
+
+        x = (float)(-87.0 + 175.0*s);
+        reference = exp((double)x);
+        exp_error = max(exp_error, fabs(FastExp(x) - reference)/reference);
+
+        x = (float)pow(10.0, -6.0 + 7.0*s);
+        float y = (float)(-1.0 + 3.0*t);
+        reference = pow((double)x, (double)y);
+        pow_error = max(pow_error, fabs(FastPow(x, y) - reference)/reference/(1.0 + fabs(y*log((double)x))));
+
+        x = (float)pow(10.0, -12.0 + 24.0*s);
+        y = (float)(-3.0 + 6.0*t);
+        reference = pow((double)x, (double)y);
+        pow_wide_error = max(pow_wide_error,
+            fabs(FastPow(x, y) - reference)/reference/(1.0 + fabs(y*log((double)x))));
+    }
+    passed = TestBound("float FastLog", log_error, FastLogFloatBound) && passed;
+    passed = TestBound("float FastExp", exp_error, FastExpFloatBound) && passed;
+    passed = TestBound("float FastPow/(1 + |y*log(x)|)", pow_error, FastPowFloatBound) && passed;
+    passed = TestBound("float FastPow/(1 + |y*log(x)|), 1e-12 < x < 1e12", pow_wide_error, FastPowFloatBound) &&
+        passed;
+
+    if (FastPow(0.0, 0.26) != 0.0 || FastPow(-1.0, 1.03) != 0.0 || FastPow(0.0f, 0.26f) != 0.0f ||
+        FastPow(-1.0f, 1.03f) != 0.0f)
+    {
+        cout << "*** Error *** FastPow of x <= 0 is not 0" << endl;
+        passed = false;
+    }
+
+    FastMathError sample_error = FastMath_SampleError();
+    passed = TestBound("FastMath_SampleError log", sample_error.log, TestSampleBound[0]) && passed;
+    passed = TestBound("FastMath_SampleError exp", sample_error.exp, TestSampleBound[1]) && passed;
+    passed = TestBound("FastMath_SampleError pow", sample_error.pow, TestSampleBound[2]) && passed;
+    return passed ? 0 : 1;
+}
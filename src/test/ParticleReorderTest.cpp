@@ -0,0 +1,256 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Test of ParticleReorder. "MortonIndex" is compared
+        with interleaving bit by bit. Particles in shuffled
+        cells, several in each cell, must be sorted by the
+        Morton index of their cells keeping the order within
+        a cell, with every field and extra property moved with
+        the particle, and the locality must improve. "Update"
+        must reorder only at its interval or when the checked
+        locality degrades beyond the tolerance.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "../body/ParticleReorder.h"
+#include <random>
+#include <sstream>
+
+const MPM_FLOAT TestCellSize = 0.5;
+//!> Cells in each direction, the keys use 3 bytes so that the radix sort takes several passes
+const uint32_t TestCellNumber = 300;
+
+//!> Morton index by interleaving one bit at a time
+static uint64_t TestMortonIndex(uint32_t ix, uint32_t iy, uint32_t iz)
+{
+    uint64_t index = 0;
+    for (int b = 0; b < 21; b++)
+    {
+        index |= (uint64_t)((ix >> b) & 1) << (3*b);
+        index |= (uint64_t)((iy >> b) & 1) << (3*b + 1);
+        index |= (uint64_t)((iz >> b) & 1) << (3*b + 2);
+    }
+    return index;
+}
+
+//!> All floating point arrays of the store except the positions
+static vector<MPM_FLOAT*> TestArrays(ParticleStore& store)
+{
+    vector<MPM_FLOAT*> arrays;
+    for (int k = 0; k < 3; k++)
+        arrays.push_back(store.GetVelocity(k));
+    arrays.push_back(store.GetMass());
+    arrays.push_back(store.GetVolume());
+    arrays.push_back(store.GetDensity());
+    arrays.push_back(store.GetMeanStress());
+    for (int k = 0; k < 6; k++)
+        arrays.push_back(store.GetDeviatoricStress(k));
+    arrays.push_back(store.GetEquivalentStress());
+    arrays.push_back(store.GetBulkViscosity());
+    arrays.push_back(store.GetInternalEnergy());
+    arrays.push_back(store.GetSoundSpeed());
+    arrays.push_back(store.GetCost());
+    arrays.push_back(store.GetExtraProperty(MPM::epeff));
+    arrays.push_back(store.GetExtraProperty(MPM::kelvin));
+    return arrays;
+}
+
+//!> Particle i in the cell "cells[i]", at the centre of one of 8 sub-cells, other fields are functions of the ID
+static void TestFill(ParticleStore& store, const vector< array<uint32_t, 3> >& cells)
+{
+    vector<MPM_FLOAT*> arrays = TestArrays(store);
+    for (MPM_STATS i = 0; i < store.GetParticleNumber(); i++)
+    {
+        store.GetParticleID()[i] = i;
+        for (int k = 0; k < 3; k++)
+            store.GetPosition(k)[i] = (cells[i][k] + 0.25 + 0.5*((i >> k) & 1))*TestCellSize;
+        for (size_t k = 0; k < arrays.size(); k++)
+            arrays[k][i] = 100.0*i + k;
+        store.GetFailure()[i] = i%5 == 0;
+    }
+}
+
+//!> Particles are sorted by the Morton index of their cells, and every field belongs to the ID
+//!> Particles in one cell are in the order of their IDs if "stable", i.e. sorted from the order of the IDs
+static bool TestSorted(ParticleStore& store, const vector< array<uint32_t, 3> >& cells, bool stable)
+{
+    vector<MPM_FLOAT*> arrays = TestArrays(store);
+    uint64_t last_key = 0;
+    MPM_STATS last_id = 0;
+    for (MPM_STATS i = 0; i < store.GetParticleNumber(); i++)
+    {
+        MPM_STATS id = store.GetParticleID()[i];
+        const array<uint32_t, 3>& cell = cells[id];
+        uint64_t key = TestMortonIndex(cell[0], cell[1], cell[2]);
+        if (i > 0 && (key < last_key || (stable && key == last_key && id < last_id)))
+        {
+            cout << "*** Error *** Reorder: particle " << i << " (ID " << id << ") is out of order" << endl;
+            return false;
+        }
+        last_key = key;
+        last_id = id;
+
+        bool matched = store.GetFailure()[i] == (id%5 == 0);
+        for (int k = 0; k < 3; k++)
+            matched = matched && store.GetPosition(k)[i] == (cell[k] + 0.25 + 0.5*((id >> k) & 1))*TestCellSize;
+        for (size_t k = 0; k < arrays.size(); k++)
+            matched = matched && arrays[k][i] == 100.0*id + k;
+        if (!matched)
+        {
+            cout << "*** Error *** Reorder: the fields of particle " << i << " do not belong to ID " << id << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+//!> Shuffle the particles of the store
+static bool TestShuffle(ParticleStore& store, mt19937& generator)
+{
+    vector<MPM_STATS> order(store.GetActiveNumber());
+    for (MPM_STATS i = 0; i < (MPM_STATS)order.size(); i++)
+        order[i] = i;
+    shuffle(order.begin(), order.end(), generator);
+    return store.Permute(order.data(), (MPM_STATS)order.size());
+}
+
+//!> "Update" at "step" reorders the particles if and only if "expected"
+static bool TestUpdate(string name, ParticleReorder& reorder, ParticleStore& store, int step, bool expected)
+{
+    ostringstream log;
+    MPM_STATS reorder_number = reorder.GetReorderNumber();
+    bool reordered = reorder.Update(store, step, log);
+    if (reordered == expected && reorder.GetReorderNumber() == reorder_number + (expected ? 1 : 0))
+        return true;
+    cout << "*** Error *** " << name << ": step " << step << (reordered ? " reordered" : " not reordered")
+         << ", locality " << reorder.GetLocality() << endl;
+    return false;
+}
+
+int main()
+{
+    bool passed = true;
+    mt19937 generator(20261016);
+
+    //!> Morton index of single bits, the largest cell and random cells
+    struct {uint32_t ix, iy, iz; uint64_t index;} known[] = {{0, 0, 0, 0}, {1, 0, 0, 1}, {0, 1, 0, 2},
+        {0, 0, 1, 4}, {1, 1, 1, 7}, {2, 0, 0, 8}, {3, 5, 6, 0x1AB}, {0x1FFFFF, 0x1FFFFF, 0x1FFFFF, 0x7FFFFFFFFFFFFFFFULL}};
+    for (auto& k : known)
+    {
+        if (ParticleReorder::MortonIndex(k.ix, k.iy, k.iz) != k.index)
+        {
+            cout << "*** Error *** MortonIndex(" << k.ix << ", " << k.iy << ", " << k.iz << ") is "
+                 << ParticleReorder::MortonIndex(k.ix, k.iy, k.iz) << ", " << k.index << " expected" << endl;
+            passed = false;
+        }
+    }
+    uniform_int_distribution<uint32_t> coordinate(0, 0x1FFFFF);
+    for (int i = 0; i < 10000; i++)
+    {
+        uint32_t ix = coordinate(generator), iy = coordinate(generator), iz = coordinate(generator);
+        if (ParticleReorder::MortonIndex(ix, iy, iz) != TestMortonIndex(ix, iy, iz))
+        {
+            cout << "*** Error *** MortonIndex(" << ix << ", " << iy << ", " << iz << ") differs from bit interleaving"
+                 << endl;
+            passed = false;
+            break;
+        }
+    }
+
+    //!> Locality of four particles along x: cells 0, 5, 1, 6 have no neighbouring pair, sorted 0, 1, 5, 6 have two
+    vector<MPM::ExtraParticleProperty> extra_property = {MPM::epeff, MPM::kelvin};
+    Array3D origin = {0.0, 0.0, 0.0};
+    ParticleReorder reorder;
+    if (!reorder.Initialize(origin, TestCellSize, 0, 0, 0.0))
+        return 1;
+    {
+        vector< array<uint32_t, 3> > cells = {{{0, 0, 0}}, {{5, 0, 0}}, {{1, 0, 0}}, {{6, 0, 0}}};
+        ParticleStore store;
+        if (!store.Initialize(4, extra_property))
+            return 1;
+        TestFill(store, cells);
+        MPM_FLOAT before = reorder.Locality(store);
+        if (!reorder.Reorder(store))
+            return 1;
+        MPM_FLOAT after = reorder.Locality(store);
+        if (fabs(before - 1.0) > MPM_EPSILON || fabs(after - 1.0/3.0) > MPM_EPSILON || !TestSorted(store, cells, true))
+        {
+            cout << "*** Error *** Locality: " << before << " and " << after << " after reorder, 1 and 1/3 expected"
+                 << endl;
+            passed = false;
+        }
+    }
+
+    //!> Shuffled cells with 8 particles each, and 24 particles in one cell
+    const MPM_STATS cell_number = 2000;
+    vector< array<uint32_t, 3> > cells;
+    uniform_int_distribution<uint32_t> cell_index(0, TestCellNumber - 1);
+    for (MPM_STATS c = 0; c < cell_number; c++)
+    {
+        array<uint32_t, 3> cell = {{cell_index(generator), cell_index(generator), cell_index(generator)}};
+        for (int n = 0; n < (c == 0 ? 24 : 8); n++)
+            cells.push_back(cell);
+    }
+    shuffle(cells.begin(), cells.end(), generator);
+
+    ParticleStore store;
+    if (!store.Initialize((MPM_STATS)cells.size(), extra_property))
+        return 1;
+    TestFill(store, cells);
+    MPM_FLOAT before = reorder.Locality(store);
+    if (!reorder.Reorder(store))
+        return 1;
+    MPM_FLOAT after = reorder.Locality(store);
+    passed = TestSorted(store, cells, true) && passed;
+    if (after >= before)
+    {
+        cout << "*** Error *** Locality: " << before << " before and " << after << " after reorder" << endl;
+        passed = false;
+    }
+    cout << "Reorder: " << store.GetParticleNumber() << " particles sorted, locality " << before << " before and "
+         << after << " after" << endl;
+
+    //!> Checked every 2 steps: reorder when the locality exceeds the value after the last reorder by 0.1
+    ParticleReorder checked;
+    if (!checked.Initialize(origin, TestCellSize, 0, 2, 0.1) || !TestShuffle(store, generator))
+        return 1;
+    passed = TestUpdate("check interval", checked, store, 1, false) && passed;
+    passed = TestUpdate("check interval", checked, store, 2, true) && passed;
+    passed = TestUpdate("check interval", checked, store, 3, false) && passed;
+    passed = TestUpdate("check interval", checked, store, 4, false) && passed;
+    if (!TestShuffle(store, generator))
+        return 1;
+    passed = TestUpdate("check interval", checked, store, 5, false) && passed;
+    passed = TestUpdate("check interval", checked, store, 6, true) && passed;
+    passed = TestSorted(store, cells, false) && passed;
+
+    //!> Every 3 steps without checks, shuffled or not
+    ParticleReorder periodic;
+    if (!periodic.Initialize(origin, TestCellSize, 3, 0, 0.0) || !TestShuffle(store, generator))
+        return 1;
+    for (int step = 1; step <= 7; step++)
+        passed = TestUpdate("interval", periodic, store, step, step%3 == 0) && passed;
+    passed = TestSorted(store, cells, false) && passed;
+
+    //!> Invalid parameters
+    if (periodic.Initialize(origin, 0.0, 3, 0, 0.0) || periodic.Initialize(origin, TestCellSize, -1, 0, 0.0) ||
+        periodic.Initialize(origin, TestCellSize, 0, 2, -0.1))
+    {
+        cout << "*** Error *** invalid reordering parameters are accepted" << endl;
+        passed = false;
+    }
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,197 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Test of the reordering of ParticleStore. Every field
+        of a particle is a function of its ID, so that a field
+        left behind by "CompactEroded", "Migrate" or
+        "Pack"/"Unpack" is found. The particle IDs after each
+        operation are compared with the expected sequence: the
+        active particles in their order, then the eroded ones
+        in their order, arrivals behind the staying ones.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "../body/ParticleStore.h"
+#include <algorithm>
+
+//!> All floating point arrays of the store
+static vector<MPM_FLOAT*> TestArrays(ParticleStore& store)
+{
+    vector<MPM_FLOAT*> arrays;
+    for (int k = 0; k < 3; k++)
+    {
+        arrays.push_back(store.GetPosition(k));
+        arrays.push_back(store.GetVelocity(k));
+    }
+    arrays.push_back(store.GetMass());
+    arrays.push_back(store.GetVolume());
+    arrays.push_back(store.GetDensity());
+    arrays.push_back(store.GetMeanStress());
+    for (int k = 0; k < 6; k++)
+        arrays.push_back(store.GetDeviatoricStress(k));
+    arrays.push_back(store.GetEquivalentStress());
+    arrays.push_back(store.GetBulkViscosity());
+    arrays.push_back(store.GetInternalEnergy());
+    arrays.push_back(store.GetSoundSpeed());
+    arrays.push_back(store.GetCost());
+    arrays.push_back(store.GetExtraProperty(MPM::epeff));
+    arrays.push_back(store.GetExtraProperty(MPM::kelvin));
+    return arrays;
+}
+
+//!> Fields of the particles of a store, with IDs from "first_id"
+static void TestFill(ParticleStore& store, MPM_STATS first_id)
+{
+    vector<MPM_FLOAT*> arrays = TestArrays(store);
+    for (MPM_STATS i = 0; i < store.GetParticleNumber(); i++)
+    {
+        MPM_STATS id = first_id + i;
+        store.GetParticleID()[i] = id;
+        for (size_t k = 0; k < arrays.size(); k++)
+            arrays[k][i] = 100.0*id + k;
+        store.GetFailure()[i] = id%5 == 0;
+    }
+}
+
+//!> The particle IDs of the store are "expected", its active number "active", and all fields move with the IDs
+static bool TestCheck(string operation, ParticleStore& store, const vector<MPM_STATS>& expected, MPM_STATS active)
+{
+    if (store.GetParticleNumber() != (MPM_STATS)expected.size() || store.GetActiveNumber() != active)
+    {
+        cout << "*** Error *** " << operation << ": " << store.GetParticleNumber() << " particles and "
+             << store.GetActiveNumber() << " active ones, " << expected.size() << " and " << active
+             << " expected" << endl;
+        return false;
+    }
+
+    vector<MPM_FLOAT*> arrays = TestArrays(store);
+    for (MPM_STATS i = 0; i < store.GetParticleNumber(); i++)
+    {
+        MPM_STATS id = store.GetParticleID()[i];
+        bool matched = id == expected[i] && store.GetFailure()[i] == (id%5 == 0) &&
+            store.GetEroded()[i] == (i >= active);
+        for (size_t k = 0; k < arrays.size(); k++)
+            matched = matched && arrays[k][i] == 100.0*id + k;
+        if (!matched)
+        {
+            cout << "*** Error *** " << operation << ": particle " << i << " is " << id << ", " << expected[i]
+                 << " expected, or its fields do not belong to it" << endl;
+            return false;
+        }
+    }
+    cout << operation << ": " << store.GetParticleNumber() << " particles in order" << endl;
+    return true;
+}
+
+//!> Erode the active particles with "id%divisor == remainder"
+static void TestErode(ParticleStore& store, MPM_STATS divisor, MPM_STATS remainder)
+{
+    for (MPM_STATS i = 0; i < store.GetActiveNumber(); i++)
+        if (store.GetParticleID()[i]%divisor == remainder)
+            store.GetEroded()[i] = true;
+}
+
+//!> Expected order of "CompactEroded", the particles of "ids" with "id%divisor == remainder" move behind
+//!>    the other active ones
+static void TestCompactOrder(vector<MPM_STATS>& ids, MPM_STATS& active, MPM_STATS divisor, MPM_STATS remainder)
+{
+    auto end = stable_partition(ids.begin(), ids.begin() + active,
+        [&](MPM_STATS id) {return id%divisor != remainder;});
+    active = end - ids.begin();
+}
+
+int main()
+{
+    const MPM_STATS particle_number = 1000;
+    vector<MPM::ExtraParticleProperty> extra_property = {MPM::epeff, MPM::kelvin};
+    ParticleStore store;
+    if (!store.Initialize(particle_number, extra_property))
+        return 1;
+    TestFill(store, 0);
+
+    vector<MPM_STATS> expected(particle_number);
+    for (MPM_STATS i = 0; i < particle_number; i++)
+        expected[i] = i;
+    MPM_STATS active = particle_number;
+    bool passed = true;
+
+    //!> Compaction keeps both parts in order, and is repeated with the eroded particles already behind
+    TestErode(store, 7, 3);
+    TestCompactOrder(expected, active, 7, 3);
+    MPM_STATS moved = store.CompactEroded();
+    passed = TestCheck("CompactEroded", store, expected, active) && passed;
+    if (moved != particle_number - active || store.CompactEroded() != 0)
+    {
+        cout << "*** Error *** CompactEroded: wrong number of particles moved" << endl;
+        passed = false;
+    }
+
+    TestErode(store, 11, 4);
+    TestCompactOrder(expected, active, 11, 4);
+    store.CompactEroded();
+    passed = TestCheck("CompactEroded again", store, expected, active) && passed;
+
+    //!> Every 3rd active particle leaves, and the particles of another store arrive
+    ParticleStore other;
+    const MPM_STATS arrival_number = 150;
+    if (!other.Initialize(arrival_number, extra_property))
+        return 1;
+    TestFill(other, 10000);
+    size_t bytes = other.GetPackedBytes();
+    if (bytes != store.GetPackedBytes())
+    {
+        cout << "*** Error *** Stores with the same extra properties have different packed bytes" << endl;
+        return 1;
+    }
+    vector<char> arrival(bytes*arrival_number);
+    for (MPM_STATS i = 0; i < arrival_number; i++)
+        other.Pack(i, arrival.data() + i*bytes);
+
+    vector<MPM_STATS> leaving, migrated;
+    for (MPM_STATS i = 0; i < active; i++)
+    {
+        if (i%3 == 1)
+            leaving.push_back(i);
+        else
+            migrated.push_back(expected[i]);
+    }
+    for (MPM_STATS i = 0; i < arrival_number; i++)
+        migrated.push_back(10000 + i);
+    MPM_STATS migrated_active = migrated.size();
+    migrated.insert(migrated.end(), expected.begin() + active, expected.end());
+
+    passed = store.Migrate(leaving, arrival.data(), arrival_number) && passed;
+    passed = TestCheck("Migrate", store, migrated, migrated_active) && passed;
+
+    //!> Departure only, and compaction of the migrated store
+    leaving.clear();
+    for (MPM_STATS i = 0; i < migrated_active; i += 10)
+        leaving.push_back(i);
+    expected.clear();
+    for (MPM_STATS i = 0; i < (MPM_STATS)migrated.size(); i++)
+        if (i >= migrated_active || i%10 != 0)
+            expected.push_back(migrated[i]);
+    active = migrated_active - leaving.size();
+    passed = store.Migrate(leaving, nullptr, 0) && passed;
+    passed = TestCheck("Migrate without arrival", store, expected, active) && passed;
+
+    TestErode(store, 13, 0);
+    TestCompactOrder(expected, active, 13, 0);
+    store.CompactEroded();
+    passed = TestCheck("CompactEroded after Migrate", store, expected, active) && passed;
+
+    return passed ? 0 : 1;
+}
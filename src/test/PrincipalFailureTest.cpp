@@ -0,0 +1,216 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Test of the principal value failure check.
+        "SymmetricEigenvalues" is compared with a Jacobi
+        eigen-solve in long double on rotated tensors with
+        well-separated, repeated and near-repeated eigenvalues,
+        and the eigenvalues must lie in the invariant bounds.
+        "PrincipalFailureBatch" must fail exactly the particles
+        failed by the eigenvalues of every particle, for
+        tensors near and far from the limits.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "../material/failure/Failure_BatchKernel.h"
+#include "../utility/MathFunctionList.h"
+#include <random>
+
+const int TestTensorNumber = 2000;
+//!> Errors relative to the largest eigenvalue magnitude: well-separated eigenvalues are solved to a few
+//!>    hundred round-offs, near repeated ones as accurately as the trigonometric solution, about sqrt(epsilon)
+const MPM_FLOAT TestSeparatedTolerance = 512.0*MPM_EPSILON;
+const MPM_FLOAT TestRepeatedTolerance = 16.0*sqrt(MPM_EPSILON);
+
+//!> Eigenvalues of a symmetric tensor (xx, yy, zz, yz, xz, xy) by cyclic Jacobi rotations, in descending order
+static void TestJacobi(const MPM_FLOAT (&tensor)[6], long double (&lambda)[3])
+{
+    long double a[3][3] = {{tensor[0], tensor[5], tensor[4]}, {tensor[5], tensor[1], tensor[3]},
+        {tensor[4], tensor[3], tensor[2]}};
+    for (int sweep = 0; sweep < 50; sweep++)
+    {
+        long double off = a[0][1]*a[0][1] + a[0][2]*a[0][2] + a[1][2]*a[1][2];
+        if (off == 0.0L)
+            break;
+        for (int p = 0; p < 2; p++)
+            for (int q = p + 1; q < 3; q++)
+            {
+                if (a[p][q] == 0.0L)
+                    continue;
+                long double theta = (a[q][q] - a[p][p])/(2.0L*a[p][q]);
+                long double t = (theta >= 0.0L ? 1.0L : -1.0L)/(fabsl(theta) + sqrtl(theta*theta + 1.0L));
+                long double c = 1.0L/sqrtl(t*t + 1.0L), s = t*c;
+                for (int k = 0; k < 3; k++)
+                {
+                    long double akp = a[k][p], akq = a[k][q];
+                    a[k][p] = c*akp - s*akq;
+                    a[k][q] = s*akp + c*akq;
+                }
+                for (int k = 0; k < 3; k++)
+                {
+                    long double apk = a[p][k], aqk = a[q][k];
+                    a[p][k] = c*apk - s*aqk;
+                    a[q][k] = s*apk + c*aqk;
+                }
+            }
+    }
+    for (int k = 0; k < 3; k++)
+        lambda[k] = a[k][k];
+    sort(lambda, lambda + 3, greater<long double>());
+}
+
+//!> Tensor R*diag(lambda)*R^T with the rotation R of a random unit quaternion
+static void TestTensor(const long double (&lambda)[3], mt19937& generator, MPM_FLOAT (&tensor)[6])
+{
+    normal_distribution<double> normal(0.0, 1.0);
+    long double q[4], norm = 0.0L;
+    for (int k = 0; k < 4; k++)
+    {
+        q[k] = normal(generator);
+        norm += q[k]*q[k];
+    }
+    norm = sqrtl(norm);
+    long double w = q[0]/norm, x = q[1]/norm, y = q[2]/norm, z = q[3]/norm;
+    long double r[3][3] = {{1 - 2*(y*y + z*z), 2*(x*y - z*w), 2*(x*z + y*w)},
+        {2*(x*y + z*w), 1 - 2*(x*x + z*z), 2*(y*z - x*w)},
+        {2*(x*z - y*w), 2*(y*z + x*w), 1 - 2*(x*x + y*y)}};
+    long double a[3][3];
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            a[i][j] = r[i][0]*lambda[0]*r[j][0] + r[i][1]*lambda[1]*r[j][1] + r[i][2]*lambda[2]*r[j][2];
+    tensor[0] = (MPM_FLOAT)a[0][0];
+    tensor[1] = (MPM_FLOAT)a[1][1];
+    tensor[2] = (MPM_FLOAT)a[2][2];
+    tensor[3] = (MPM_FLOAT)a[1][2];
+    tensor[4] = (MPM_FLOAT)a[0][2];
+    tensor[5] = (MPM_FLOAT)a[0][1];
+}
+
+//!> "SymmetricEigenvalues" against the Jacobi solution of the rounded tensors with the eigenvalues
+//!>    "scale*(base + spread*random)" in each direction
+static bool TestEigenvalues(string name, const long double (&base)[3], long double spread, MPM_FLOAT tolerance,
+    mt19937& generator)
+{
+    uniform_real_distribution<double> uniform(-1.0, 1.0);
+    MPM_FLOAT error = 0.0;
+    bool bounded = true;
+    for (int n = 0; n < TestTensorNumber; n++)
+    {
+        long double scale = pow(10.0, 6.0*uniform(generator));
+        long double lambda[3];
+        for (int k = 0; k < 3; k++)
+            lambda[k] = scale*(base[k] + spread*uniform(generator));
+        MPM_FLOAT tensor[6];
+        TestTensor(lambda, generator, tensor);
+
+        long double reference[3];
+        TestJacobi(tensor, reference);
+        MPM_FLOAT value[3], lower, upper;
+        SymmetricEigenvalues(tensor[0], tensor[1], tensor[2], tensor[3], tensor[4], tensor[5],
+            value[0], value[1], value[2]);
+        SymmetricEigenvalueBounds(tensor[0], tensor[1], tensor[2], tensor[3], tensor[4], tensor[5], lower, upper);
+        long double magnitude = max(fabsl(reference[0]), fabsl(reference[2]));
+        for (int k = 0; k < 3; k++)
+            error = max(error, (MPM_FLOAT)(fabsl(value[k] - reference[k])/magnitude));
+        //!> Repeated eigenvalues may be out of order by round-off
+        MPM_FLOAT error_bound = (MPM_FLOAT)(tolerance*magnitude);
+        bounded = bounded && value[0] >= value[1] - error_bound && value[1] >= value[2] - error_bound &&
+            value[0] <= upper && value[2] >= lower &&
+            reference[0] <= upper + error_bound && reference[2] >= lower - error_bound;
+    }
+
+    bool passed = error <= tolerance && bounded;
+    cout << (passed ? "" : "*** Error *** ") << name << ": relative eigenvalue error " << error
+         << (passed ? " within " : " beyond ") << tolerance
+         << (bounded ? ", ordered and bounded" : ", out of order or bounds") << endl;
+    return passed;
+}
+
+//!> "PrincipalFailureBatch" against "PrincipalLimitExceeded" on the eigenvalues of every tensor, with
+//!>    eigenvalues in [-range, range] around limits of about 1, so that part of the tensors are far below
+static bool TestBatch(string name, MPM_FLOAT min_limit, MPM_FLOAT max_limit, MPM_FLOAT shear_limit,
+    mt19937& generator)
+{
+    uniform_real_distribution<double> uniform(-1.0, 1.0);
+    vector<MPM_FLOAT> tensor[6];
+    const MPM_STATS number = 8*MPM::ParticleChunkSize;
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        //!> Ranges from far below to beyond the limits, and tensors close to the hydrostatic state
+        long double range = i%4 == 0 ? 0.2 : (i%4 == 1 ? 0.6 : 1.4);
+        long double mean = 1.2*uniform(generator), lambda[3];
+        for (int k = 0; k < 3; k++)
+            lambda[k] = i%16 == 3 ? mean + 1.0e-7*k : range*uniform(generator);
+        MPM_FLOAT packed[6];
+        TestTensor(lambda, generator, packed);
+        for (int k = 0; k < 6; k++)
+            tensor[k].push_back(packed[k]);
+    }
+
+    MPM_STATS mismatch = 0, failed = 0, expected_failed = 0;
+    bool failure[MPM::ParticleChunkSize];
+    for (MPM_STATS begin = 0; begin < number; begin += MPM::ParticleChunkSize)
+    {
+        Failure_Batch batch;
+        batch.number = MPM::ParticleChunkSize;
+        for (int k = 0; k < 6; k++)
+            batch.tensor[k] = tensor[k].data() + begin;
+        batch.failure = failure;
+        PrincipalFailureBatch(batch, min_limit, max_limit, shear_limit);
+
+        for (MPM_STATS i = 0; i < MPM::ParticleChunkSize; i++)
+        {
+            MPM_FLOAT lambda_max, lambda_mid, lambda_min;
+            SymmetricEigenvalues(batch.tensor[0][i], batch.tensor[1][i], batch.tensor[2][i], batch.tensor[3][i],
+                batch.tensor[4][i], batch.tensor[5][i], lambda_max, lambda_mid, lambda_min);
+            bool expected = PrincipalLimitExceeded(lambda_min, lambda_max, min_limit, max_limit, shear_limit);
+            mismatch += failure[i] != expected;
+            failed += failure[i];
+            expected_failed += expected;
+        }
+    }
+
+    bool passed = mismatch == 0 && expected_failed > 0 && expected_failed < number;
+    cout << (passed ? "" : "*** Error *** ") << name << ": " << failed << " of " << number
+         << " particles failed by the batch, " << expected_failed << " by the eigenvalues, " << mismatch
+         << " mismatches" << endl;
+    return passed;
+}
+
+int main()
+{
+    bool passed = true;
+    mt19937 generator(20261016);
+
+    const long double separated[3] = {3.0L, 1.0L, -2.0L};
+    const long double repeated_max[3] = {2.0L, 2.0L, -1.0L};
+    const long double repeated_min[3] = {1.0L, -0.5L, -0.5L};
+    const long double hydrostatic[3] = {1.0L, 1.0L, 1.0L};
+    const long double near_repeated[3] = {2.0L, 2.0L + 1.0e-5L, -1.0L};
+    const long double near_hydrostatic[3] = {1.0L, 1.0L + 1.0e-5L, 1.0L - 1.0e-5L};
+    passed = TestEigenvalues("separated", separated, 0.3L, TestSeparatedTolerance, generator) && passed;
+    passed = TestEigenvalues("repeated largest", repeated_max, 0.0L, TestRepeatedTolerance, generator) && passed;
+    passed = TestEigenvalues("repeated smallest", repeated_min, 0.0L, TestRepeatedTolerance, generator) && passed;
+    passed = TestEigenvalues("hydrostatic", hydrostatic, 0.0L, TestRepeatedTolerance, generator) && passed;
+    passed = TestEigenvalues("near repeated", near_repeated, 0.0L, TestRepeatedTolerance, generator) && passed;
+    passed = TestEigenvalues("near hydrostatic", near_hydrostatic, 0.0L, TestRepeatedTolerance, generator) && passed;
+
+    passed = TestBatch("all limits", -1.0, 1.0, 0.8, generator) && passed;
+    passed = TestBatch("tension limit", 0.0, 0.9, 0.0, generator) && passed;
+    passed = TestBatch("compression limit", -0.9, 0.0, 0.0, generator) && passed;
+    passed = TestBatch("shear limit", 0.0, 0.0, 0.5, generator) && passed;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,209 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Test of the shape function cache. For every type,
+        particles in cells on both sides of grid block
+        boundaries, also at negative indices, and at the
+        fractions of a cell where the stencil moves, are
+        cached by "ShapeFunction::Update". The weights of each
+        particle must sum to 1 and the gradients to 0, and the
+        gradients must match the central differences of the
+        weights of the same nodes at shifted positions.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "../grid/ShapeFunction.h"
+
+const MPM_FLOAT TestCellSize = 0.5;
+//!> Sums of up to 64 products of the 1D values
+const MPM_FLOAT TestUnityTolerance = 64.0*MPM_EPSILON;
+//!> Shift of the central differences in cell sizes, the error is of order "TestShift^2" for smooth weights
+const MPM_FLOAT TestShift = cbrt(MPM_EPSILON);
+const MPM_FLOAT TestGradientTolerance = 100.0*TestShift*TestShift;
+
+//!> Cells at block boundaries (blocks of MPM::GridBlockEdge nodes) and on both sides of 0
+const int TestCells[] = {-5, -4, -1, 0, MPM::GridBlockEdge - 1, MPM::GridBlockEdge, 2*MPM::GridBlockEdge - 1};
+const int TestCellNumber = sizeof(TestCells)/sizeof(TestCells[0]);
+
+//!> Fractions of a cell at the nodes and the half cell, where the stencils of the types move
+const double TestUnityFractions[] = {0.0, MPM_EPSILON, 0.5 - MPM_EPSILON, 0.5, 0.5 + MPM_EPSILON,
+    1.0 - 4.0*MPM_EPSILON, 0.125, 0.3, 0.7};
+//!> Near the same fractions but 10 shifts away, so that the shifted positions keep the stencil and the
+//!>    weights are smooth between them
+const double TestGradientFractions[] = {10.0*TestShift, 0.5 - 10.0*TestShift, 0.5 + 10.0*TestShift,
+    1.0 - 10.0*TestShift, 0.125, 0.3, 0.7};
+
+//!> Particle positions of cell "TestCells[(s + 2k)%TestCellNumber]" and fraction "fractions[(3s + k)%number]"
+//!>    in each direction k of sample s
+static void TestPositions(const double* fractions, int fraction_number, int sample_number,
+    vector<Array3D>& positions)
+{
+    positions.resize(sample_number);
+    for (int s = 0; s < sample_number; s++)
+        for (int k = 0; k < 3; k++)
+            positions[s][k] = (TestCells[(s + 2*k)%TestCellNumber] + fractions[(3*s + k)%fraction_number])*
+                TestCellSize;
+}
+
+//!> Cache the shape functions of particles at "positions"
+static bool TestUpdate(ShapeFunction& shape, SparseGrid& grid, ParticleStore& store, const vector<Array3D>& positions)
+{
+    vector<MPM::ExtraParticleProperty> extra_property;
+    if (!store.Initialize((MPM_STATS)positions.size(), extra_property))
+        return false;
+    for (MPM_STATS p = 0; p < (MPM_STATS)positions.size(); p++)
+        for (int k = 0; k < 3; k++)
+            store.GetPosition(k)[p] = positions[p][k];
+    return grid.Rebuild(store, shape.GetStencilLow(), shape.GetStencilHigh()) && shape.Update(store, grid);
+}
+
+//!> 3D weight and gradient of stencil node "n" of particle "p"
+static void TestWeight(ShapeFunction& shape, MPM_STATS p, int n, MPM_FLOAT& weight, MPM_FLOAT (&gradient)[3])
+{
+    const int W = shape.GetWidth();
+    const MPM_FLOAT* row = shape.GetWeight(p);
+    int ox = n%W, oy = n/W%W, oz = n/W/W;
+    weight = row[ox]*row[W + oy]*row[2*W + oz];
+    gradient[0] = row[3*W + ox]*row[W + oy]*row[2*W + oz];
+    gradient[1] = row[ox]*row[4*W + oy]*row[2*W + oz];
+    gradient[2] = row[ox]*row[W + oy]*row[5*W + oz];
+}
+
+//!> Weight of grid node "node" for particle "p", 0 if it is not in the stencil
+static MPM_FLOAT TestNodeWeight(ShapeFunction& shape, MPM_STATS p, MPM_STATS node)
+{
+    const int W = shape.GetWidth();
+    const MPM_STATS* nodes = shape.GetNode(p);
+    for (int n = 0; n < W*W*W; n++)
+    {
+        if (nodes[n] == node)
+        {
+            MPM_FLOAT weight, gradient[3];
+            TestWeight(shape, p, n, weight, gradient);
+            return weight;
+        }
+    }
+    return 0.0;
+}
+
+//!> Partition of unity at the positions near the stencil boundaries
+static bool TestUnity(MPM::ShapeFunctionType type)
+{
+    string name = ShapeFunction::TypeName(type);
+    ShapeFunction shape;
+    SparseGrid grid;
+    ParticleStore store;
+    Array3D origin = {0.0, 0.0, 0.0};
+    vector<Array3D> positions;
+    const int fraction_number = sizeof(TestUnityFractions)/sizeof(TestUnityFractions[0]);
+    TestPositions(TestUnityFractions, fraction_number, 3*TestCellNumber*fraction_number, positions);
+    if (!shape.Initialize(type) || !grid.Initialize(origin, TestCellSize) || !TestUpdate(shape, grid, store, positions))
+    {
+        cout << "*** Error *** " << name << ": shape functions are not updated" << endl;
+        return false;
+    }
+
+    const int W = shape.GetWidth();
+    MPM_FLOAT unity_error = 0.0, gradient_error = 0.0;
+    for (MPM_STATS p = 0; p < store.GetActiveNumber(); p++)
+    {
+        MPM_FLOAT sum = 0.0, gradient_sum[3] = {0.0, 0.0, 0.0};
+        for (int n = 0; n < W*W*W; n++)
+        {
+            MPM_FLOAT weight, gradient[3];
+            TestWeight(shape, p, n, weight, gradient);
+            sum += weight;
+            for (int k = 0; k < 3; k++)
+                gradient_sum[k] += gradient[k];
+        }
+        unity_error = max(unity_error, (MPM_FLOAT)fabs(sum - 1.0));
+        for (int k = 0; k < 3; k++)
+            gradient_error = max(gradient_error, fabs(gradient_sum[k])*TestCellSize);
+    }
+
+    bool passed = unity_error <= TestUnityTolerance && gradient_error <= TestUnityTolerance;
+    cout << (passed ? "" : "*** Error *** ") << name << ": |sum(N) - 1| " << unity_error << ", |sum(grad N)|*h "
+         << gradient_error << (passed ? " within " : " beyond ") << TestUnityTolerance << endl;
+    return passed;
+}
+
+//!> Gradients against the central differences of the weights of the same nodes
+static bool TestGradient(MPM::ShapeFunctionType type)
+{
+    string name = ShapeFunction::TypeName(type);
+    ShapeFunction shape;
+    SparseGrid grid;
+    ParticleStore store;
+    Array3D origin = {0.0, 0.0, 0.0};
+    vector<Array3D> samples;
+    const int fraction_number = sizeof(TestGradientFractions)/sizeof(TestGradientFractions[0]);
+    TestPositions(TestGradientFractions, fraction_number, 3*TestCellNumber*fraction_number, samples);
+
+    //!> Each sample is followed by its positions shifted by -h and +h in x, y and z
+    vector<Array3D> positions;
+    for (const Array3D& sample : samples)
+    {
+        positions.push_back(sample);
+        for (int k = 0; k < 3; k++)
+            for (MPM_FLOAT sign : {-1.0, 1.0})
+            {
+                Array3D shifted = sample;
+                shifted[k] += sign*TestShift*TestCellSize;
+                positions.push_back(shifted);
+            }
+    }
+    if (!shape.Initialize(type) || !grid.Initialize(origin, TestCellSize) || !TestUpdate(shape, grid, store, positions))
+    {
+        cout << "*** Error *** " << name << ": shape functions are not updated" << endl;
+        return false;
+    }
+
+    const int W = shape.GetWidth();
+    MPM_FLOAT error = 0.0;
+    for (MPM_STATS p = 0; p < store.GetActiveNumber(); p += 7)
+    {
+        const MPM_STATS* nodes = shape.GetNode(p);
+        for (int n = 0; n < W*W*W; n++)
+        {
+            MPM_FLOAT weight, gradient[3];
+            TestWeight(shape, p, n, weight, gradient);
+            for (int k = 0; k < 3; k++)
+            {
+                MPM_STATS minus = p + 1 + 2*k, plus = p + 2 + 2*k;
+                MPM_FLOAT distance = store.GetPosition(k)[plus] - store.GetPosition(k)[minus];
+                MPM_FLOAT difference = (TestNodeWeight(shape, plus, nodes[n]) -
+                    TestNodeWeight(shape, minus, nodes[n]))/distance;
+                error = max(error, fabs(difference - gradient[k])*TestCellSize);
+            }
+        }
+    }
+
+    bool passed = error <= TestGradientTolerance;
+    cout << (passed ? "" : "*** Error *** ") << name << ": |grad N - central difference|*h " << error
+         << (passed ? " within " : " beyond ") << TestGradientTolerance << endl;
+    return passed;
+}
+
+int main()
+{
+    bool passed = true;
+    for (MPM::ShapeFunctionType type : {MPM::LinearShape, MPM::GIMPShape, MPM::QuadraticBSpline, MPM::CubicBSpline})
+    {
+        passed = TestUnity(type) && passed;
+        passed = TestGradient(type) && passed;
+    }
+    return passed ? 0 : 1;
+}
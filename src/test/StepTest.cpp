@@ -0,0 +1,262 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Test of the step drivers. A small elastic cube,
+        moving, stretched and sheared, is run by USL, MUSL and
+        USF with every shape function, without gravity. The
+        node mass must equal the particle mass, and the
+        momentum of the particles and of the nodes must be
+        kept. Each scheme is also run with its fused particle
+        pass split into one pass per operation in the same
+        order, and the particles must be bitwise identical.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "../solver/step/Step_USL.h"
+#include "../solver/step/Step_MUSL.h"
+#include "../solver/step/Step_USF.h"
+#include <cstring>
+
+const int TestEdge = 3;
+const int TestSteps = 20;
+const MPM_FLOAT TestCellSize = 1.0e-2;
+//!> Sums over the particles and nodes of each step, relative to the sum of |momentum|
+const MPM_FLOAT TestTolerance = 1.0e3*MPM_EPSILON;
+
+//!> Steps of the schemes with one particle pass per operation, in the order of the fused passes
+class TestStep_USL : public Step_USL
+{
+public:
+    bool Solve(ostream& log)
+    {
+        if (!_BeginStep(log) || !_TransferToGrid())
+            return false;
+        _grid->IntegrateMomentum(_context.GetDTn_I(), _pool);
+        _ParticlePass<Acceleration>();
+        _ParticlePass<Position>();
+        return _EndStep(_ParticlePass<Stress>());
+    }
+};
+
+class TestStep_MUSL : public Step_MUSL
+{
+public:
+    bool Solve(ostream& log)
+    {
+        if (!_BeginStep(log) || !_TransferToGrid())
+            return false;
+        _grid->IntegrateMomentum(_context.GetDTn_I(), _pool);
+        _ParticlePass<Acceleration>();
+        _grid->ResetMomentum(_pool);
+        if (!_TransferToGrid(ParticleToGrid::Momentum))
+            return false;
+        _ParticlePass<Position>();
+        return _EndStep(_ParticlePass<Stress | RemappedGradient>());
+    }
+};
+
+class TestStep_USF : public Step_USF
+{
+public:
+    bool Solve(ostream& log)
+    {
+        if (!_BeginStep(log) || !_TransferToGrid(ParticleToGrid::Mass | ParticleToGrid::Momentum))
+            return false;
+        _grid->UpdateVelocity(_pool);
+        MPM_FLOAT critical_dt = _ParticlePass<Stress>();
+        if (!_TransferToGrid(ParticleToGrid::Force))
+            return false;
+        _grid->IntegrateMomentum(_context.GetDTn_I(), _pool);
+        _ParticlePass<Acceleration>();
+        _ParticlePass<Position>();
+        return _EndStep(critical_dt);
+    }
+};
+
+//!> Body, material and grid of one run
+struct TestBody
+{
+    MaterialFactory material;
+    ParticleStore store;
+    SparseGrid grid;
+    ShapeFunction shape;
+    ParticleToGrid transfer;
+};
+
+//!> Elastic cube of TestEdge cells with 8 particles in each, at 100 m/s along (1, 1, 1), stretched along x,
+//!>    sheared in y along z and rotated about z
+static bool TestInitialize(TestBody& body, MPM::ShapeFunctionType type, Step_Base& step)
+{
+    string strength_name = "IsoElastic", eos_name = "";
+    map<string, MPM_FLOAT> strength_para = {{"Young", 2e11}, {"Poisson", 0.3}}, eos_para;
+    map<string, MPM_FLOAT> extra_para = {{"ReferenceDensity", 7830.0}};
+    vector<string> failure_name;
+    vector< map<string, MPM_FLOAT> > failure_para;
+    if (!body.material.Initialize(strength_name, strength_para, eos_name, eos_para, failure_name, failure_para,
+        extra_para))
+        return false;
+    vector<MPM::ExtraParticleProperty> extra_property;
+    DataTransfer transfer;
+    if (!body.material.AddExtraParticleProperty(extra_property, transfer))
+        return false;
+
+    const MPM_FLOAT density = 7830.0;
+    const MPM_FLOAT center = 0.5*TestEdge*TestCellSize;
+    MPM_STATS number = 8*TestEdge*TestEdge*TestEdge;
+    if (!body.store.Initialize(number, extra_property))
+        return false;
+    for (MPM_STATS p = 0; p < number; p++)
+    {
+        MPM_STATS cell = p/8;
+        int index[3] = {(int)(cell%TestEdge), (int)(cell/TestEdge%TestEdge), (int)(cell/TestEdge/TestEdge)};
+        MPM_FLOAT x[3];
+        for (int k = 0; k < 3; k++)
+        {
+            x[k] = (index[k] + 0.25 + 0.5*((p >> k) & 1))*TestCellSize;
+            body.store.GetPosition(k)[p] = x[k];
+        }
+        body.store.GetVelocity(0)[p] = 100.0 + 2000.0*(x[0] - center) - 1000.0*(x[1] - center);
+        body.store.GetVelocity(1)[p] = 100.0 + 5000.0*(x[2] - center) + 1000.0*(x[0] - center);
+        body.store.GetVelocity(2)[p] = 100.0;
+        body.store.GetVolume()[p] = TestCellSize*TestCellSize*TestCellSize/8.0;
+        body.store.GetMass()[p] = density*body.store.GetVolume()[p];
+        body.store.GetDensity()[p] = density;
+        body.store.GetParticleID()[p] = p;
+    }
+
+    Array3D origin = {0.0, 0.0, 0.0};
+    Array3D gravity = {0.0, 0.0, 0.0};
+    return body.grid.Initialize(origin, TestCellSize) && body.shape.Initialize(type) &&
+        body.transfer.Initialize(ParticleToGrid::Serial, nullptr) &&
+        step.Initialize(&body.store, &body.material, &body.grid, &body.shape, &body.transfer, gravity);
+}
+
+//!> Momentum of the particles in "momentum", the sum of |momentum| is returned
+static MPM_FLOAT TestParticleMomentum(ParticleStore& store, MPM_FLOAT (&momentum)[3])
+{
+    MPM_FLOAT scale = 0.0;
+    for (int k = 0; k < 3; k++)
+    {
+        momentum[k] = 0.0;
+        for (MPM_STATS p = 0; p < store.GetActiveNumber(); p++)
+        {
+            momentum[k] += store.GetMass()[p]*store.GetVelocity(k)[p];
+            scale += fabs(store.GetMass()[p]*store.GetVelocity(k)[p]);
+        }
+    }
+    return scale;
+}
+
+//!> All floating point arrays of the store
+static vector<MPM_FLOAT*> TestArrays(ParticleStore& store)
+{
+    vector<MPM_FLOAT*> arrays;
+    for (int k = 0; k < 3; k++)
+    {
+        arrays.push_back(store.GetPosition(k));
+        arrays.push_back(store.GetVelocity(k));
+    }
+    arrays.push_back(store.GetVolume());
+    arrays.push_back(store.GetDensity());
+    arrays.push_back(store.GetMeanStress());
+    for (int k = 0; k < 6; k++)
+        arrays.push_back(store.GetDeviatoricStress(k));
+    arrays.push_back(store.GetEquivalentStress());
+    arrays.push_back(store.GetBulkViscosity());
+    arrays.push_back(store.GetInternalEnergy());
+    arrays.push_back(store.GetSoundSpeed());
+    return arrays;
+}
+
+//!> Run the scheme by "Fused" and "Unfused" from the same cube, check the conservation of the fused run and
+//!>    compare both runs after each step
+template<class Fused, class Unfused>
+static bool TestScheme(string scheme, MPM::ShapeFunctionType type)
+{
+    string name = scheme + ", " + ShapeFunction::TypeName(type);
+    Fused fused;
+    Unfused unfused;
+    TestBody fused_body, unfused_body;
+    if (!TestInitialize(fused_body, type, fused) || !TestInitialize(unfused_body, type, unfused))
+    {
+        cout << "*** Error *** " << name << ": initialization failed" << endl;
+        return false;
+    }
+
+    ParticleStore& store = fused_body.store;
+    SparseGrid& grid = fused_body.grid;
+    MPM_FLOAT particle_mass = 0.0;
+    for (MPM_STATS p = 0; p < store.GetActiveNumber(); p++)
+        particle_mass += store.GetMass()[p];
+    MPM_FLOAT initial[3];
+    MPM_FLOAT scale = TestParticleMomentum(store, initial);
+
+    MPM_FLOAT mass_error = 0.0, momentum_error = 0.0, node_momentum_error = 0.0;
+    for (int s = 0; s < TestSteps; s++)
+    {
+        if (!fused.Solve(cout) || !unfused.Solve(cout))
+        {
+            cout << "*** Error *** " << name << ": step " << s << " failed" << endl;
+            return false;
+        }
+
+        //!> The nodes keep the mass and the momentum of the last transfer, which is the particle momentum
+        //!>    before or after the step, the same without external force
+        MPM_FLOAT momentum[3], node_mass = 0.0;
+        TestParticleMomentum(store, momentum);
+        for (MPM_STATS n = 0; n < grid.GetNodeNumber(); n++)
+            node_mass += grid.GetMass()[n];
+        mass_error = max(mass_error, fabs(node_mass - particle_mass)/particle_mass);
+        for (int k = 0; k < 3; k++)
+        {
+            MPM_FLOAT node_momentum = 0.0;
+            for (MPM_STATS n = 0; n < grid.GetNodeNumber(); n++)
+                node_momentum += grid.GetMomentum(k)[n];
+            momentum_error = max(momentum_error, fabs(momentum[k] - initial[k])/scale);
+            node_momentum_error = max(node_momentum_error, fabs(node_momentum - initial[k])/scale);
+        }
+
+        vector<MPM_FLOAT*> fused_arrays = TestArrays(store), unfused_arrays = TestArrays(unfused_body.store);
+        bool identical = store.GetActiveNumber() == unfused_body.store.GetActiveNumber() &&
+            fused.GetContext().GetDTn_I() == unfused.GetContext().GetDTn_I();
+        for (size_t k = 0; k < fused_arrays.size() && identical; k++)
+            identical = memcmp(fused_arrays[k], unfused_arrays[k], store.GetActiveNumber()*sizeof(MPM_FLOAT)) == 0;
+        if (!identical)
+        {
+            cout << "*** Error *** " << name << ": the fused and the unfused passes differ at step " << s << endl;
+            return false;
+        }
+    }
+
+    bool passed = mass_error <= TestTolerance && momentum_error <= TestTolerance &&
+        node_momentum_error <= TestTolerance;
+    cout << (passed ? "" : "*** Error *** ") << name << ": relative error of node mass " << mass_error
+         << ", particle momentum " << momentum_error << ", node momentum " << node_momentum_error
+         << (passed ? " within " : " beyond ") << TestTolerance << ", fused and unfused passes identical" << endl;
+    return passed;
+}
+
+int main()
+{
+    bool passed = true;
+    for (MPM::ShapeFunctionType type : {MPM::LinearShape, MPM::GIMPShape, MPM::QuadraticBSpline, MPM::CubicBSpline})
+    {
+        passed = TestScheme<Step_USL, TestStep_USL>("USL", type) && passed;
+        passed = TestScheme<Step_MUSL, TestStep_MUSL>("MUSL", type) && passed;
+        passed = TestScheme<Step_USF, TestStep_USF>("USF", type) && passed;
+    }
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,189 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Test of the strength batch kernels. Two identical
+        populations are loaded step by step, one particle by
+        "UpdateDeviatoricStress" and one by chunks of
+        "UpdateDeviatoricStressBatch" with a partial last
+        chunk. Every output of every particle must be bitwise
+        identical after each step, and both yielding and
+        non-yielding particles must occur.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "../material/MaterialKernel.h"
+#include "../material/strength/Strength_ElaPlastic.h"
+#include "../material/strength/Strength_IsoHarden.h"
+#include "../material/strength/Strength_JohnsonCook.h"
+#include "../material/strength/Strength_SimpleJohnsonCook.h"
+#include "../solver/SimulationContext.h"
+#include "BatchTestCase.h"
+
+const int TestStepNumber = 8;
+const MPM_FLOAT TestDensity = 7830.0;
+const MPM_FLOAT TestEnergyScale = 1.0e9;
+
+//!> Strain increment of a step, the particles with i%5 == 0 stay unloaded and never yield
+static void TestStrain(MPM_STATS i, SymTensor& de)
+{
+    MPM_FLOAT scale = 2.0e-3*(i%5)/4.0;
+    de[0] = scale;
+    de[1] = -0.3*scale;
+    de[2] = -0.3*scale;
+    de[3] = 0.1*scale*((i%3) - 1);
+    de[4] = 0.05*scale;
+    de[5] = -0.2*scale;
+}
+
+//!> Compare the particle and its transfer record of both paths, print the first difference
+static bool TestCompare(string name, int step, MPM_STATS i, PhysicalProperty& scalar, DataTransfer& scalar_transfer,
+    PhysicalProperty& batch, DataTransfer& batch_transfer)
+{
+    string field;
+    if (!BitwiseEqual(scalar.GetDeviatoricStress(), batch.GetDeviatoricStress()))
+        field = "deviatoric stress";
+    else if (!BitwiseEqual(scalar.GetEquivalentStress(), batch.GetEquivalentStress()))
+        field = "equivalent stress";
+    else if (scalar.is_Failed() != batch.is_Failed())
+        field = "failure";
+    else if (scalar.HasExtraParticleProperty(MPM::epeff) && !BitwiseEqual(scalar[MPM::epeff], batch[MPM::epeff]))
+        field = "epeff";
+    else if (scalar.HasExtraParticleProperty(MPM::sigma_y) && !BitwiseEqual(scalar[MPM::sigma_y], batch[MPM::sigma_y]))
+        field = "sigma_y";
+    else if (scalar_transfer.yield != batch_transfer.yield)
+        field = "yield";
+    else if (!BitwiseEqual(scalar_transfer.depeff, batch_transfer.depeff))
+        field = "depeff";
+    else if (!BitwiseEqual(scalar_transfer.lsrate, batch_transfer.lsrate))
+        field = "lsrate";
+    else if (!BitwiseEqual(scalar_transfer.tstar, batch_transfer.tstar))
+        field = "tstar";
+    else
+        return true;
+
+    cout << "*** Error *** " << name << ": " << field << " of particle " << i << " differs at step " << step << endl;
+    return false;
+}
+
+//!> Load both populations with the model and compare them after each step
+template<class Model>
+static bool TestModel(string name, map<string, MPM_FLOAT> strength_para, bool fast_math)
+{
+    Model strength;
+    if (!strength.Initialize(strength_para, TestDensity))
+        return false;
+    strength.SetFastMath(fast_math);
+    if (!strength.HasBatchKernel())
+    {
+        cout << "*** Error *** " << name << " has no batch kernel" << endl;
+        return false;
+    }
+
+    vector<MPM::ExtraParticleProperty> extra_list;
+    DataTransfer transfer;
+    if (!strength.AddExtraParticleProperty_Strength(extra_list, transfer))
+        return false;
+
+    vector<PhysicalProperty> scalar(TestParticleNumber), batch(TestParticleNumber);
+    ExtraPropertyArena scalar_arena, batch_arena;
+    if (!scalar_arena.Initialize(TestParticleNumber, extra_list) || !batch_arena.Initialize(TestParticleNumber, extra_list))
+        return false;
+    if (!TestPopulate(scalar, scalar_arena, TestDensity, TestEnergyScale, transfer) ||
+        !TestPopulate(batch, batch_arena, TestDensity, TestEnergyScale, transfer))
+        return false;
+
+    SimulationContext context;
+    context.SetTimeStep(1.0e-8);
+    vector<SymTensor> delta_strain(TestParticleNumber);
+    for (MPM_STATS i = 0; i < TestParticleNumber; i++)
+        TestStrain(i, delta_strain[i]);
+    SymTensor delta_vortex;
+    delta_vortex.fill(0.0);
+
+    MPM_STATS yield_number = 0, elastic_number = 0;
+    vector<DataTransfer> scalar_transfer(TestParticleNumber);
+    StressChunk chunk;
+    for (int step = 1; step <= TestStepNumber; step++)
+    {
+        for (MPM_STATS i = 0; i < TestParticleNumber; i++)
+        {
+            scalar_transfer[i].Reset();
+            scalar_transfer[i].context = &context;
+            strength.UpdateDeviatoricStress(&scalar[i], delta_strain[i], delta_vortex, scalar_transfer[i]);
+        }
+
+        for (MPM_STATS begin = 0; begin < TestParticleNumber; begin += MPM::ParticleChunkSize)
+        {
+            MPM_STATS number = min(MPM::ParticleChunkSize, TestParticleNumber - begin);
+            chunk.PackStrengthBatch(&batch[begin], &delta_strain[begin], number);
+            chunk.strength_batch.context = &context;
+            strength.UpdateDeviatoricStressBatch(chunk.strength_batch);
+            chunk.UnpackStrengthBatch(&batch[begin], number);
+
+            for (MPM_STATS i = 0; i < number; i++)
+            {
+                if (!TestCompare(name, step, begin + i, scalar[begin + i], scalar_transfer[begin + i],
+                    batch[begin + i], chunk.transfer[i]))
+                    return false;
+                if (chunk.transfer[i].yield)
+                    yield_number++;
+                else
+                    elastic_number++;
+            }
+        }
+    }
+
+    if (yield_number == 0 || elastic_number == 0)
+    {
+        cout << "*** Error *** " << name << ": " << yield_number << " yielding and " << elastic_number
+             << " non-yielding updates, both are required" << endl;
+        return false;
+    }
+    cout << name << ": " << yield_number << " yielding and " << elastic_number << " non-yielding updates identical"
+         << endl;
+    return true;
+}
+
+int main()
+{
+    map<string, MPM_FLOAT> ela_plastic;
+    ela_plastic["Young"] = 2.0e11;
+    ela_plastic["Poisson"] = 0.3;
+    ela_plastic["Yield0"] = 7.92e8;
+
+    map<string, MPM_FLOAT> iso_harden = ela_plastic;
+    iso_harden["TangMod"] = 2.0e9;
+
+    map<string, MPM_FLOAT> simple_johnson_cook = ela_plastic;
+    simple_johnson_cook["B"] = 5.1e8;
+    simple_johnson_cook["n"] = 0.26;
+    simple_johnson_cook["C"] = 0.014;
+
+    map<string, MPM_FLOAT> johnson_cook = simple_johnson_cook;
+    johnson_cook["m"] = 1.03;
+    johnson_cook["melt"] = 1793.0;
+    johnson_cook["SpecHeat"] = 477.0;
+    johnson_cook["roomt"] = 294.0;
+
+    bool passed = true;
+    passed = TestModel<Strength_ElaPlastic>("ElaPlastic", ela_plastic, false) && passed;
+    passed = TestModel<Strength_IsoHarden>("IsoHarden", iso_harden, false) && passed;
+    passed = TestModel<Strength_SimpleJohnsonCook>("SimJohnsonCook", simple_johnson_cook, false) && passed;
+    passed = TestModel<Strength_JohnsonCook>("JohnsonCook", johnson_cook, false) && passed;
+    passed = TestModel<Strength_SimpleJohnsonCook>("SimJohnsonCook(FastMath)", simple_johnson_cook, true) && passed;
+    passed = TestModel<Strength_JohnsonCook>("JohnsonCook(FastMath)", johnson_cook, true) && passed;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,207 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Test of the schedules of ThreadPool. Every iteration
+        of "ParallelFor" must be visited exactly once, by
+        chunks inside the range with a valid thread id, for
+        every schedule, chunk size, range and thread number,
+        with a skewed cost so that Stealing loops steal, and
+        for loops started inside a loop. The ranges of
+        "ParallelForBalanced" must cover the loop and cost no
+        more than their equal share plus the largest cost.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "../utility/ThreadPool.h"
+
+//!> Some work, iterations in the last quarter of the range cost 16 times more
+static double TestWork(MPM_STATS i, MPM_STATS begin, MPM_STATS end)
+{
+    int repeat = i >= end - (end - begin)/4 ? 16 : 1;
+    double sum = 0.0;
+    for (int r = 0; r < 4*repeat; r++)
+        sum += sqrt((double)(i + r));
+    return sum;
+}
+
+//!> Run "loop(begin, end, body)" and check the visits of [begin, end)
+template<class Loop>
+static bool TestVisits(string name, ThreadPool& pool, MPM_STATS begin, MPM_STATS end, Loop loop)
+{
+    MPM_STATS number = max((MPM_STATS)0, end - begin);
+    vector< atomic<int> > visit(number);
+    for (auto& v : visit)
+        v = 0;
+    atomic<int> invalid(0);
+    atomic<double> work(0.0);
+
+    loop(begin, end, [&](MPM_STATS first, MPM_STATS last, int thread_id)
+    {
+        if (first >= last || first < begin || last > end || thread_id < 0 || thread_id >= pool.GetThreadNumber())
+        {
+            invalid++;
+            return;
+        }
+        double sum = 0.0;
+        for (MPM_STATS i = first; i < last; i++)
+        {
+            visit[i - begin]++;
+            sum += TestWork(i, begin, end);
+        }
+        double expected = work.load();
+        while (!work.compare_exchange_weak(expected, expected + sum));
+    });
+
+    MPM_STATS missed = 0, repeated = 0;
+    for (auto& v : visit)
+    {
+        if (v == 0)
+            missed++;
+        else if (v > 1)
+            repeated++;
+    }
+    if (invalid > 0 || missed > 0 || repeated > 0)
+    {
+        cout << "*** Error *** " << name << " [" << begin << ", " << end << "): " << invalid << " invalid chunks, "
+             << missed << " iterations missed, " << repeated << " visited more than once" << endl;
+        return false;
+    }
+    return true;
+}
+
+//!> Costs of the iterations of "ParallelForBalanced"
+enum TestCost
+{
+    Zero,
+    Uniform,
+    Skewed,
+    Spike
+};
+
+static MPM_FLOAT TestCostOf(TestCost type, MPM_STATS i, MPM_STATS number)
+{
+    switch (type)
+    {
+    case Zero:
+        return 0.0;
+    case Uniform:
+        return 1.0;
+    case Skewed:
+        return i >= number - number/4 ? 64.0 : 1.0 + 0.1*(i%3);
+    case Spike:
+        return i == number/3 ? 1.0e6 : 0.5;
+    }
+    return 0.0;
+}
+
+//!> Visits of "ParallelForBalanced", and the cost of each range against the equal share of its schedule
+static bool TestBalanced(string name, ThreadPool& pool, MPM_STATS number, TestCost type)
+{
+    vector<MPM_FLOAT> cost(number);
+    MPM_FLOAT total = 0.0, largest = 0.0;
+    for (MPM_STATS i = 0; i < number; i++)
+    {
+        cost[i] = TestCostOf(type, i, number);
+        total += cost[i];
+        largest = max(largest, cost[i]);
+    }
+
+    int thread_number = pool.GetThreadNumber();
+    MPM_STATS range_number = min(number, (MPM_STATS)(pool.GetSchedule() == ThreadPool::Static ? 
+        thread_number : 16*thread_number));
+    MPM_FLOAT share = thread_number == 1 ? total : total/max(range_number, (MPM_STATS)1);
+    atomic<int> unbalanced(0);
+    bool passed = TestVisits(name, pool, 0, number, [&](MPM_STATS begin, MPM_STATS end, auto body)
+    {
+        pool.ParallelForBalanced(begin, end, cost.data(), [&](MPM_STATS first, MPM_STATS last, int thread_id)
+        {
+            MPM_FLOAT sum = 0.0;
+            for (MPM_STATS i = max(first, begin); i < min(last, end); i++)
+                sum += cost[i];
+            if (total > 0.0 && sum > (share + largest)*(1.0 + 1.0e-12))
+                unbalanced++;
+            body(first, last, thread_id);
+        });
+    });
+    if (unbalanced > 0)
+    {
+        cout << "*** Error *** " << name << ", " << number << " iterations: " << unbalanced
+             << " ranges cost more than " << share << " + " << largest << endl;
+        return false;
+    }
+    return passed;
+}
+
+static bool TestPool(int thread_number, ThreadPool::Backend backend)
+{
+    ThreadPool pool;
+    if (!pool.Initialize(thread_number, backend))
+        return false;
+
+    const MPM_STATS ranges[][2] = {{0, 0}, {5, 3}, {17, 18}, {17, 22}, {0, 1000}, {-300, 4097}, {17, 20017}};
+    bool passed = true;
+    for (ThreadPool::Schedule schedule : {ThreadPool::Static, ThreadPool::Dynamic, ThreadPool::Guided,
+        ThreadPool::Stealing})
+        for (MPM_STATS chunk : {0, 1, 7, 1000})
+        {
+            string name = ThreadPool::BackendName(backend) + ", " + to_string(thread_number) + " threads, " +
+                ThreadPool::ScheduleName(schedule) + ", chunk " + to_string(chunk);
+            for (auto& range : ranges)
+            {
+                //!> Repeated, a lost or doubled chunk of Stealing depends on the timing of the threads
+                for (int repeat = 0; repeat < 3; repeat++)
+                    passed = TestVisits(name, pool, range[0], range[1], [&](MPM_STATS begin, MPM_STATS end,
+                        auto body) {pool.ParallelFor(begin, end, schedule, chunk, body);}) && passed;
+            }
+
+            //!> A loop inside a loop runs on the calling thread and still visits all of its iterations
+            passed = TestVisits(name + ", nested", pool, 0, 64, [&](MPM_STATS begin, MPM_STATS end, auto body)
+            {
+                pool.ParallelFor(begin, end, schedule, 1, [&](MPM_STATS first, MPM_STATS last, int thread_id)
+                {
+                    for (MPM_STATS i = first; i < last; i++)
+                        pool.ParallelFor(i, i + 1, schedule, chunk, body);
+                });
+            }) && passed;
+        }
+
+    for (ThreadPool::Schedule schedule : {ThreadPool::Static, ThreadPool::Dynamic, ThreadPool::Guided,
+        ThreadPool::Stealing})
+    {
+        pool.SetSchedule(schedule);
+        string name = ThreadPool::BackendName(backend) + ", " + to_string(thread_number) + " threads, " +
+            ThreadPool::ScheduleName(schedule) + ", balanced";
+        for (MPM_STATS number : {0, 1, 5, 1000, 20017})
+            for (TestCost type : {Zero, Uniform, Skewed, Spike})
+                passed = TestBalanced(name, pool, number, type) && passed;
+    }
+    cout << ThreadPool::BackendName(backend) << ", " << thread_number << " threads: "
+         << (passed ? "passed" : "failed") << endl;
+    return passed;
+}
+
+int main()
+{
+    bool passed = true;
+    for (int thread_number : {1, 2, 3, 4, 8})
+    {
+        passed = TestPool(thread_number, ThreadPool::Pool) && passed;
+#ifdef _MPM_OPENMP
+        passed = TestPool(thread_number, ThreadPool::OpenMP) && passed;
+#endif
+    }
+    return passed ? 0 : 1;
+}
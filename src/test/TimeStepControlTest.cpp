@@ -0,0 +1,147 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Test of the adaptive time step of SimulationContext.
+        A sequence of critical time steps is applied by
+        "UpdateTimeStep", and each new time step must be the
+        CFL scaled critical step, capped by "max_growth" of
+        the previous step and by "max_dt". A step below
+        "min_dt" must be rejected without changing the time
+        steps, and invalid controls must be rejected.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "../solver/SimulationContext.h"
+
+const MPM_FLOAT TestTolerance = 4.0*MPM_EPSILON;
+
+static bool TestClose(MPM_FLOAT value, MPM_FLOAT expected)
+{
+    return fabs(value - expected) <= TestTolerance*fabs(expected);
+}
+
+//!> Time steps of "context" after a step from "dtn" to "dtn1"
+static bool TestSteps(string name, SimulationContext& context, MPM_FLOAT dtn, MPM_FLOAT dtn1, MPM_FLOAT time)
+{
+    if (TestClose(context.GetDTn(), dtn) && TestClose(context.GetDTn_I(), dtn1) &&
+        TestClose(context.GetDTn_I_Half(), 0.5*dtn1) && TestClose(context.GetDTx(), 0.5*(dtn + dtn1)) &&
+        TestClose(context.GetCurrentTime(), time))
+        return true;
+    cout << "*** Error *** " << name << ": time steps " << context.GetDTn() << ", " << context.GetDTn_I()
+         << " at time " << context.GetCurrentTime() << ", " << dtn << ", " << dtn1 << " at time " << time
+         << " expected" << endl;
+    return false;
+}
+
+int main()
+{
+    bool passed = true;
+
+    //!> Controls out of their ranges
+    SimulationContext context;
+    TimeStepControl invalid[4];
+    invalid[0].cfl = 0.0;
+    invalid[1].cfl = 1.5;
+    invalid[2].max_growth = 0.9;
+    invalid[3].min_dt = 2.0e-6;
+    invalid[3].max_dt = 1.0e-6;
+    for (int i = 0; i < 4; i++)
+    {
+        if (context.SetTimeStepControl(invalid[i]))
+        {
+            cout << "*** Error *** invalid time step control " << i << " is accepted" << endl;
+            passed = false;
+        }
+    }
+
+    TimeStepControl control;
+    control.cfl = 0.5;
+    control.max_growth = 1.2;
+    control.min_dt = 1.0e-9;
+    control.max_dt = 1.0e-5;
+    if (!context.SetTimeStepControl(control))
+        return 1;
+    context.ResetTime();
+    MPM_FLOAT time = 0.0;
+
+    //!> The first step is not capped by the growth
+    if (!context.UpdateTimeStep(1.0e-6))
+        return 1;
+    passed = TestSteps("first step", context, 0.0, 5.0e-7, time) && passed;
+    context.AdvanceTime();
+    time += 5.0e-7;
+
+    //!> A critical step far above grows the step by "max_growth" each step until "max_dt"
+    MPM_FLOAT dt = 5.0e-7;
+    int growth_steps = 0;
+    while (dt < control.max_dt)
+    {
+        if (!context.UpdateTimeStep(1.0e-3))
+            return 1;
+        MPM_FLOAT expected = min(control.max_growth*dt, control.max_dt);
+        passed = TestSteps("growth step " + to_string(growth_steps), context, dt, expected, time) && passed;
+        context.AdvanceTime();
+        time += expected;
+        dt = expected;
+        growth_steps++;
+        if (growth_steps > 100)
+            return 1;
+    }
+    //!> 5e-7*1.2^16 < 1e-5 < 5e-7*1.2^17
+    if (growth_steps != 17)
+    {
+        cout << "*** Error *** max_dt is reached after " << growth_steps << " steps, 17 expected" << endl;
+        passed = false;
+    }
+    if (!context.UpdateTimeStep(1.0))
+        return 1;
+    passed = TestSteps("max_dt", context, control.max_dt, control.max_dt, time) && passed;
+    context.AdvanceTime();
+    time += control.max_dt;
+
+    //!> A smaller critical step is followed at once
+    if (!context.UpdateTimeStep(4.0e-6))
+        return 1;
+    passed = TestSteps("drop", context, control.max_dt, 2.0e-6, time) && passed;
+    context.AdvanceTime();
+    time += 2.0e-6;
+
+    //!> Below "min_dt" the step is rejected and the time steps are kept
+    if (context.UpdateTimeStep(1.0e-9))
+    {
+        cout << "*** Error *** a time step below min_dt is accepted" << endl;
+        passed = false;
+    }
+    passed = TestSteps("min_dt", context, control.max_dt, 2.0e-6, time) && passed;
+
+    //!> Exactly "min_dt" is accepted
+    if (!context.UpdateTimeStep(2.0e-9))
+    {
+        cout << "*** Error *** a time step of min_dt is rejected" << endl;
+        passed = false;
+    }
+    passed = TestSteps("at min_dt", context, 2.0e-6, control.min_dt, time) && passed;
+
+    //!> A new run starts without the growth cap
+    context.ResetTime();
+    if (!context.UpdateTimeStep(1.0e-3))
+        return 1;
+    passed = TestSteps("after reset", context, 0.0, control.max_dt, 0.0) && passed;
+
+    if (passed)
+        cout << "Time step control: cfl, max_growth, min_dt and max_dt followed" << endl;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,157 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Test of the parallel modes of ParticleToGrid. Two
+        cubes of particles with random velocity and stress,
+        one of them across the origin so that stencils span
+        negative block indices, are scattered with every shape
+        function. The node values of the Atomic and Colored
+        modes on 4 threads with every schedule must equal the
+        Serial ones up to the order of the additions, and the
+        node masses must sum to the particle mass.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "../grid/ParticleToGrid.h"
+#include <random>
+
+//!> Node values are sums of up to a few hundred particle terms in another order, the forces of the random
+//!>    stresses partly cancel
+const MPM_FLOAT TestConditioning = 256.0;
+const MPM_FLOAT TestTolerance = TestConditioning*MPM_EPSILON;
+
+//!> Largest difference of node values to the reference, relative to the largest reference value of the same
+//!>    quantity, so that the mass is not hidden by the scale of the force
+static MPM_FLOAT RelativeDifference(const vector<MPM_FLOAT>& value, const vector<MPM_FLOAT>& reference)
+{
+    MPM_FLOAT result = 0.0;
+    size_t node_number = value.size()/7;
+    for (int k = 0; k < 7; k++)
+    {
+        MPM_FLOAT difference = 0.0, scale = 0.0;
+        for (size_t i = k*node_number; i < (k + 1)*node_number; i++)
+        {
+            difference = max(difference, fabs(value[i] - reference[i]));
+            scale = max(scale, fabs(reference[i]));
+        }
+        result = max(result, scale > 0.0 ? difference/scale : difference);
+    }
+    return result;
+}
+
+//!> Mass, momentum and force of all nodes in one array
+static void CollectNodeValues(SparseGrid& grid, vector<MPM_FLOAT>& value)
+{
+    MPM_STATS node_number = grid.GetNodeNumber();
+    value.resize(7*(size_t)node_number);
+    MPM_FLOAT* arrays[7] = {grid.GetMass(), grid.GetMomentum(0), grid.GetMomentum(1), grid.GetMomentum(2),
+        grid.GetForce(0), grid.GetForce(1), grid.GetForce(2)};
+    for (int k = 0; k < 7; k++)
+        copy(arrays[k], arrays[k] + node_number, value.begin() + (size_t)k*node_number);
+}
+
+int main()
+{
+    const MPM_STATS particle_number = 20000;
+    const MPM_FLOAT cell_size = 1e-3;
+    const MPM_FLOAT density = 7800.0;
+    const int cell_edge = 11;
+    vector<MPM::ExtraParticleProperty> extra_property;
+    ParticleStore store;
+    if (!store.Initialize(particle_number, extra_property))
+        return 1;
+
+    mt19937_64 generator(20261016);
+    uniform_real_distribution<MPM_FLOAT> unit(0.0, 1.0);
+    //!> Total masses are summed in long double so that the sum over all particles adds no round-off of its own
+    long double total_mass = 0.0;
+    for (MPM_STATS p = 0; p < particle_number; p++)
+    {
+        MPM_FLOAT offset = p%2 == 0 ? -5.5*cell_size : 20.0*cell_size;
+        for (int k = 0; k < 3; k++)
+        {
+            store.GetPosition(k)[p] = offset + cell_edge*cell_size*unit(generator);
+            store.GetVelocity(k)[p] = 100.0*(unit(generator) - 0.5);
+        }
+        store.GetVolume()[p] = cell_size*cell_size*cell_size/8.0;
+        store.GetMass()[p] = density*store.GetVolume()[p];
+        store.GetMeanStress()[p] = 1e8*(unit(generator) - 0.5);
+        store.GetBulkViscosity()[p] = 0.0;
+        for (int k = 0; k < 6; k++)
+            store.GetDeviatoricStress(k)[p] = 1e8*(unit(generator) - 0.5);
+        total_mass += store.GetMass()[p];
+    }
+
+    SparseGrid grid;
+    Array3D origin = {0.0, 0.0, 0.0};
+    Array3D gravity = {0.0, 0.0, -9.8};
+    if (!grid.Initialize(origin, cell_size))
+        return 1;
+
+    ThreadPool pool;
+    if (!pool.Initialize(4))
+        return 1;
+
+    bool passed = true;
+    vector<MPM_FLOAT> reference, value;
+    for (MPM::ShapeFunctionType type : {MPM::LinearShape, MPM::GIMPShape, MPM::QuadraticBSpline, MPM::CubicBSpline})
+    {
+        ShapeFunction shape;
+        if (!shape.Initialize(type) || !grid.Rebuild(store, shape.GetStencilLow(), shape.GetStencilHigh()) ||
+            !shape.Update(store, grid, &pool))
+            return 1;
+
+        ParticleToGrid serial;
+        if (!serial.Initialize(ParticleToGrid::Serial, nullptr))
+            return 1;
+        grid.ResetNodes();
+        if (!serial.Transfer(store, grid, shape, gravity))
+            return 1;
+        CollectNodeValues(grid, reference);
+
+        long double node_mass = 0.0;
+        for (MPM_STATS n = 0; n < grid.GetNodeNumber(); n++)
+            node_mass += grid.GetMass()[n];
+        if (fabs(node_mass - total_mass) > TestTolerance*total_mass)
+        {
+            cout << "*** Error *** " << ShapeFunction::TypeName(type) << ": node mass " << node_mass
+                 << " differs from particle mass " << total_mass << endl;
+            passed = false;
+        }
+
+        for (ParticleToGrid::TransferMode mode : {ParticleToGrid::Atomic, ParticleToGrid::Colored})
+            for (ThreadPool::Schedule schedule : {ThreadPool::Static, ThreadPool::Dynamic, ThreadPool::Guided,
+                ThreadPool::Stealing})
+            {
+                pool.SetSchedule(schedule);
+                ParticleToGrid transfer;
+                if (!transfer.Initialize(mode, &pool))
+                    return 1;
+                grid.ResetNodes();
+                if (!transfer.Transfer(store, grid, shape, gravity))
+                    return 1;
+                CollectNodeValues(grid, value);
+
+                MPM_FLOAT difference = RelativeDifference(value, reference);
+                bool matched = difference <= TestTolerance;
+                cout << (matched ? "" : "*** Error *** ") << ShapeFunction::TypeName(type) << ", "
+                     << ParticleToGrid::ModeName(mode) << ", " << ThreadPool::ScheduleName(schedule)
+                     << ": relative difference to Serial " << difference << endl;
+                passed = matched && passed;
+            }
+    }
+    return passed ? 0 : 1;
+}
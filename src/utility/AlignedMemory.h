@@ -0,0 +1,78 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Aligned memory allocation for arrays streamed by
+        vectorized kernels
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _ALIGNEDMEMORY_H_
+#define _ALIGNEDMEMORY_H_
+
+#include "../main/MPM3D_MACRO.h"
+#include <cstdlib>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace MPM{
+    //!> Alignment in bytes (cache line, also the width of AVX-512 registers)
+    const size_t MemoryAlignment = 64;
+    //!> Arrays are padded to a multiple of this number of elements
+    const MPM_STATS ArrayPadding = 16;
+}
+
+//!> Number of elements rounded up to the array padding
+inline MPM_STATS PaddedLength(MPM_STATS number)
+{
+    return (number + MPM::ArrayPadding - 1)/MPM::ArrayPadding*MPM::ArrayPadding;
+}
+
+//!> Allocate an aligned array of "number" elements initialized with zero, nullptr if failed
+template<class T>
+inline T* AlignedAllocate(MPM_STATS number)
+{
+    size_t bytes = sizeof(T)*(size_t)PaddedLength(number);
+    if (bytes == 0)
+        return nullptr;
+
+    void* memory = nullptr;
+#ifdef _WIN32
+    memory = _aligned_malloc(bytes, MPM::MemoryAlignment);
+#else
+    if (posix_memalign(&memory, MPM::MemoryAlignment, bytes) != 0)
+        memory = nullptr;
+#endif
+    if (memory)
+        fill((char*)memory, (char*)memory + bytes, 0);
+    return (T*)memory;
+}
+
+//!> Release the array allocated by "AlignedAllocate"
+template<class T>
+inline void AlignedFree(T*& memory)
+{
+    if (!memory)
+        return;
+#ifdef _WIN32
+    _aligned_free(memory);
+#else
+    free(memory);
+#endif
+    memory = nullptr;
+}
+
+#endif
@@ -1 +1,4 @@
-#include "mathfunction/CubicFunctionRoots.h"
\ No newline at end of file
+#include "mathfunction/CubicFunctionRoots.h"
+#include "mathfunction/VectorExp.h"
+#include "mathfunction/FastMath.h"
+#include "mathfunction/SymmetricEigenvalues.h"
\ No newline at end of file
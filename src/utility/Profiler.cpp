@@ -0,0 +1,145 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of class "Profiler"
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "Profiler.h"
+#include <mutex>
+#include <iomanip>
+
+atomic<bool> Profiler::_enabled(false);
+int Profiler::_entry_number = 0;
+string Profiler::_names[MPM::ProfileEntrySum];
+atomic<uint64_t> Profiler::_time_ns[MPM::ProfileEntrySum];
+atomic<uint64_t> Profiler::_calls[MPM::ProfileEntrySum];
+atomic<uint64_t> Profiler::_items[MPM::ProfileEntrySum];
+atomic<uint64_t> Profiler::_bytes[MPM::ProfileEntrySum];
+
+static mutex profiler_register_mutex;
+
+int Profiler::Register(const string& name)
+{
+    lock_guard<mutex> lock(profiler_register_mutex);
+    for (int i = 0; i < _entry_number; i++)
+        if (_names[i] == name)
+            return i;
+
+    if (_entry_number >= MPM::ProfileEntrySum)
+    {
+        cout << "*** Warning *** Too many profiler entries, " << name << " is not profiled!" << endl;
+        return -1;
+    }
+
+    int index = _entry_number;
+    _names[index] = name;
+    _time_ns[index].store(0, memory_order_relaxed);
+    _calls[index].store(0, memory_order_relaxed);
+    _items[index].store(0, memory_order_relaxed);
+    _bytes[index].store(0, memory_order_relaxed);
+    _entry_number++;
+    return index;
+}
+
+void Profiler::Reset()
+{
+    lock_guard<mutex> lock(profiler_register_mutex);
+    for (int i = 0; i < _entry_number; i++)
+    {
+        _time_ns[i].store(0, memory_order_relaxed);
+        _calls[i].store(0, memory_order_relaxed);
+        _items[i].store(0, memory_order_relaxed);
+        _bytes[i].store(0, memory_order_relaxed);
+    }
+}
+
+void Profiler::WriteSummary(ostream& os)
+{
+    lock_guard<mutex> lock(profiler_register_mutex);
+    uint64_t total_ns = 0;
+    for (int i = 0; i < _entry_number; i++)
+        if (_names[i].find('/') == string::npos)
+            total_ns += _time_ns[i].load(memory_order_relaxed);
+
+    //!> Sorted by name, so that the phases of a group are listed together
+    vector<int> order(_entry_number);
+    for (int i = 0; i < _entry_number; i++)
+        order[i] = i;
+    sort(order.begin(), order.end(), [](int a, int b) {return _names[a] < _names[b];});
+
+    ios_base::fmtflags flags = os.flags();
+    streamsize precision = os.precision();
+    os << "==================================== Profile Summary ====================================" << endl;
+    os << left << setw(40) << "Entry" << right << setw(10) << "Calls" << setw(12) << "Time(ms)"
+       << setw(8) << "%" << setw(12) << "ns/call" << setw(12) << "ns/item" << setw(10) << "GB/s" << endl;
+    os << fixed;
+    for (int i : order)
+    {
+        uint64_t time_ns = _time_ns[i].load(memory_order_relaxed);
+        uint64_t calls = _calls[i].load(memory_order_relaxed);
+        uint64_t items = _items[i].load(memory_order_relaxed);
+        uint64_t bytes = _bytes[i].load(memory_order_relaxed);
+        if (calls == 0)
+            continue;
+
+        os << left << setw(40) << _names[i] << right << setw(10) << calls
+           << setw(12) << setprecision(3) << time_ns*1e-6
+           << setw(8) << setprecision(1) << (total_ns ? 100.0*time_ns/total_ns : 0.0)
+           << setw(12) << setprecision(1) << (double)time_ns/calls
+           << setw(12) << setprecision(2) << (items ? (double)time_ns/items : 0.0)
+           << setw(10) << setprecision(2) << (time_ns ? (double)bytes/time_ns : 0.0) << endl;
+    }
+    os << "=========================================================================================" << endl;
+    os.flags(flags);
+    os.precision(precision);
+}
+
+void Profiler::WriteJSON(ostream& os)
+{
+    lock_guard<mutex> lock(profiler_register_mutex);
+    os << "{\n  \"entries\": [";
+    for (int i = 0; i < _entry_number; i++)
+    {
+        //!> Names are registered in the code, only quotes and backslashes need escaping
+        string name;
+        for (char c : _names[i])
+        {
+            if (c == '"' || c == '\\')
+                name += '\\';
+            name += c;
+        }
+
+        os << (i ? ",\n" : "\n") << "    {\"name\": \"" << name << "\""
+           << ", \"calls\": " << _calls[i].load(memory_order_relaxed)
+           << ", \"time_ns\": " << _time_ns[i].load(memory_order_relaxed)
+           << ", \"items\": " << _items[i].load(memory_order_relaxed)
+           << ", \"bytes\": " << _bytes[i].load(memory_order_relaxed) << "}";
+    }
+    os << "\n  ]\n}" << endl;
+}
+
+bool Profiler::WriteJSON(const string& filename)
+{
+    ofstream os(filename);
+    if (!os)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** Error *** Failed to open profile file " + filename);
+        return false;
+    }
+    WriteJSON(os);
+    return true;
+}
@@ -0,0 +1,127 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Registry of timers and counters for the phases of a
+        time step. An entry is registered once by name, and
+        accumulates elapsed nanoseconds, calls, particles and
+        bytes touched from any thread. When disabled, a scope
+        costs one load of a flag and no clock is read.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+#include "../main/MPM3D_MACRO.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace MPM{
+    //!> Maximum number of profiler entries
+    const int ProfileEntrySum = 128;
+}
+
+class Profiler
+{
+public:
+    //!> Return the index of the entry "name", registered if not found, -1 if the registry is full
+    //!> Names are grouped by the part before '/', e.g. "Strength/JohnsonCook"
+    static int Register(const string& name);
+
+    inline static void SetEnabled(bool enabled) {_enabled.store(enabled, memory_order_relaxed);}
+    inline static bool IsEnabled() {return _enabled.load(memory_order_relaxed);}
+
+    //!> Monotonic clock in nanoseconds
+    inline static uint64_t Now()
+    {
+        return (uint64_t)chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    //!> Accumulate to entry "index", safe to be called by several threads
+    inline static void Add(int index, uint64_t time_ns, uint64_t calls, uint64_t items, uint64_t bytes)
+    {
+        if (index < 0)
+            return;
+        _time_ns[index].fetch_add(time_ns, memory_order_relaxed);
+        _calls[index].fetch_add(calls, memory_order_relaxed);
+        _items[index].fetch_add(items, memory_order_relaxed);
+        _bytes[index].fetch_add(bytes, memory_order_relaxed);
+    }
+
+    //!> Clear the counters of all entries, the registered names are kept
+    static void Reset();
+
+    //!> Table of all entries with calls, time, share of the total time, ns per call/item and bandwidth
+    //!> The share is against the sum of the top-level entries, i.e. names without '/'
+    static void WriteSummary(ostream& os);
+
+    //!> Machine-readable dump of all entries, {"entries": [{"name": ..., "calls": ..., ...}, ...]}
+    static void WriteJSON(ostream& os);
+    static bool WriteJSON(const string& filename);
+private:
+    static atomic<bool> _enabled;
+    static int _entry_number;
+    static string _names[MPM::ProfileEntrySum];
+    static atomic<uint64_t> _time_ns[MPM::ProfileEntrySum];
+    static atomic<uint64_t> _calls[MPM::ProfileEntrySum];
+    static atomic<uint64_t> _items[MPM::ProfileEntrySum];      //!< particles or other work units
+    static atomic<uint64_t> _bytes[MPM::ProfileEntrySum];
+};
+
+//!> Time the enclosing scope to a profiler entry, nothing is done when the profiler is disabled
+class ProfileScope
+{
+public:
+    inline ProfileScope(int index, uint64_t items = 0, uint64_t bytes = 0)
+    {
+        _index = index;
+        _items = items;
+        _bytes = bytes;
+        _start = Profiler::IsEnabled() ? Profiler::Now() : 0;
+    }
+
+    inline ~ProfileScope()
+    {
+        if (_start)
+            Profiler::Add(_index, Profiler::Now() - _start, 1, _items, _bytes);
+    }
+
+    //!> End the current entry and time the rest of the scope to entry "index", for consecutive phases
+    inline void Next(int index, uint64_t items = 0, uint64_t bytes = 0)
+    {
+        if (_start)
+        {
+            uint64_t now = Profiler::Now();
+            Profiler::Add(_index, now - _start, 1, _items, _bytes);
+            _start = now;
+        }
+        _index = index;
+        _items = items;
+        _bytes = bytes;
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+private:
+    int _index;
+    uint64_t _items;
+    uint64_t _bytes;
+    uint64_t _start;    //!< 0 if the profiler is disabled when the scope begins
+};
+
+#endif
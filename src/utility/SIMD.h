@@ -0,0 +1,74 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Macros for vectorized batch kernels. A kernel marked
+        with "MPM_TARGET_CLONES" is compiled for AVX-512, AVX2
+        and the default instruction set, and the version for
+        the running CPU is selected at load time. Loops in such
+        kernels are written branch-free so that the compiler
+        processes 4/8/16 particles per instruction.
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _SIMD_H_
+#define _SIMD_H_
+
+#include "../main/MPM3D_MACRO.h"
+
+//!> Function multi-versioning needs GCC and ifunc support of Linux
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+    #define MPM_TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+    #define MPM_SIMD_DISPATCH
+#else
+    #define MPM_TARGET_CLONES
+#endif
+
+//!> Pointer without aliasing, needed by compiler to vectorize the loops
+#if defined(_MSC_VER)
+    #define MPM_RESTRICT __restrict
+#else
+    #define MPM_RESTRICT __restrict__
+#endif
+
+//!> Loop without dependency between iterations, the arrays of a batch never overlap
+#if defined(__clang__)
+    #define MPM_IVDEP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+    #define MPM_IVDEP _Pragma("GCC ivdep")
+#elif defined(_MSC_VER)
+    #define MPM_IVDEP __pragma(loop(ivdep))
+#else
+    #define MPM_IVDEP
+#endif
+
+//!> Byte view of a bool array, GCC does not vectorize loops loading "bool" with floating-point data
+inline const unsigned char* MaskView(const bool* mask) {return reinterpret_cast<const unsigned char*>(mask);}
+inline unsigned char* MaskView(bool* mask) {return reinterpret_cast<unsigned char*>(mask);}
+
+//!> Instruction set used by "MPM_TARGET_CLONES" kernels on the running CPU
+inline string SIMD_InstructionSet()
+{
+#ifdef MPM_SIMD_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return "AVX-512";
+    if (__builtin_cpu_supports("avx2"))
+        return "AVX2";
+#endif
+    return "Default";
+}
+
+#endif
@@ -0,0 +1,223 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Implementation of class "ThreadPool"
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#include "ThreadPool.h"
+#ifdef _MPM_OPENMP
+#include <omp.h>
+#endif
+
+thread_local ThreadPool* ThreadPool::_current = nullptr;
+thread_local int ThreadPool::_thread_id = 0;
+
+ThreadPool::ThreadPool()
+{
+    _backend = Pool;
+    _thread_number = 1;
+    _schedule = Static;
+    _chunk = 0;
+    _job = nullptr;
+    _generation = 0;
+    _running = 0;
+    _stop = false;
+    _profile_steal = Profiler::Register("ThreadPool/Steal");
+    _profile_idle = Profiler::Register("ThreadPool/Idle");
+}
+
+ThreadPool::~ThreadPool()
+{
+    _Stop();
+}
+
+bool ThreadPool::Initialize(int thread_number, Backend backend)
+{
+    if (thread_number < 0)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** INPUT ERROR *** thread number should not be negative.");
+        return false;
+    }
+#ifndef _MPM_OPENMP
+    if (backend == OpenMP)
+    {
+        MPM3D_ErrorMessage(__FILE__, __LINE__, "*** INPUT ERROR *** OpenMP backend requires MPM3D_USE_OPENMP.");
+        return false;
+    }
+#endif
+
+    _Stop();
+    _backend = backend;
+    _thread_number = thread_number > 0 ? thread_number : max(1, (int)thread::hardware_concurrency());
+    _steal_ranges = vector<StealRange>(_thread_number);
+
+    if (_backend == Pool)
+    {
+        _stop = false;
+        for (int t = 1; t < _thread_number; t++)
+            _workers.emplace_back(&ThreadPool::_Worker, this, t, _generation);
+    }
+#ifdef _MPM_OPENMP
+    else
+    {
+        //!> Bodies of "Run" may wait for each other, so the regions should have all threads
+        omp_set_dynamic(0);
+    }
+#endif
+    return true;
+}
+
+ThreadPool::Backend ThreadPool::DefaultBackend()
+{
+#ifdef _MPM_OPENMP
+    return OpenMP;
+#else
+    return Pool;
+#endif
+}
+
+bool ThreadPool::ParseSchedule(const string& name, Schedule& schedule)
+{
+    for (Schedule s : {Static, Dynamic, Guided, Stealing})
+    {
+        if (name == ScheduleName(s))
+        {
+            schedule = s;
+            return true;
+        }
+    }
+    return false;
+}
+
+string ThreadPool::ScheduleName(Schedule schedule)
+{
+    switch (schedule)
+    {
+    case Static:
+        return "Static";
+    case Dynamic:
+        return "Dynamic";
+    case Guided:
+        return "Guided";
+    case Stealing:
+        return "Stealing";
+    }
+    return "";
+}
+
+bool ThreadPool::ParseBackend(const string& name, Backend& backend)
+{
+    for (Backend b : {Pool, OpenMP})
+    {
+        if (name == BackendName(b))
+        {
+            backend = b;
+            return true;
+        }
+    }
+    return false;
+}
+
+string ThreadPool::BackendName(Backend backend)
+{
+    switch (backend)
+    {
+    case Pool:
+        return "Pool";
+    case OpenMP:
+        return "OpenMP";
+    }
+    return "";
+}
+
+void ThreadPool::Run(const function<void(int)>& body)
+{
+    if (_current || _thread_number == 1)
+    {
+        for (int t = 0; t < _thread_number; t++)
+            body(t);
+        return;
+    }
+
+    lock_guard<mutex> run_lock(_run_mutex);
+#ifdef _MPM_OPENMP
+    if (_backend == OpenMP)
+    {
+        #pragma omp parallel num_threads(_thread_number)
+        {
+            _current = this;
+            _thread_id = omp_get_thread_num();
+            body(_thread_id);
+            _current = nullptr;
+        }
+        return;
+    }
+#endif
+
+    {
+        lock_guard<mutex> lock(_mutex);
+        _job = &body;
+        _running = _thread_number - 1;
+        _generation++;
+    }
+    _start.notify_all();
+
+    _current = this;
+    _thread_id = 0;
+    body(0);
+    _current = nullptr;
+
+    unique_lock<mutex> lock(_mutex);
+    _finish.wait(lock, [&] {return _running == 0;});
+    _job = nullptr;
+}
+
+void ThreadPool::_Stop()
+{
+    {
+        lock_guard<mutex> lock(_mutex);
+        _stop = true;
+    }
+    _start.notify_all();
+    for (auto& worker : _workers)
+        worker.join();
+    _workers.clear();
+}
+
+void ThreadPool::_Worker(int thread_id, uint64_t generation)
+{
+    _current = this;
+    _thread_id = thread_id;
+    while (true)
+    {
+        const function<void(int)>* job;
+        {
+            unique_lock<mutex> lock(_mutex);
+            _start.wait(lock, [&] {return _stop || _generation != generation;});
+            if (_stop)
+                return;
+            generation = _generation;
+            job = _job;
+        }
+
+        (*job)(thread_id);
+
+        lock_guard<mutex> lock(_mutex);
+        if (--_running == 0)
+            _finish.notify_one();
+    }
+}
@@ -0,0 +1,370 @@
+/*==============================================================
+                            OpenMPM3D
+    C-plus-plus code for 3-Dimensional Material Point Method
+================================================================
+    Copyright (C) 2022 - 
+
+    Computational Dynamics Group
+    Department of Engineering Mechanics
+    School of Aerospace Engineering
+    Tsinghua Univeristy
+    Beijing 100084, P. R. China
+
+    Corresponding Author: Xiong Zhang
+    E-mail: xzhang@tsinghua.edu.cn
+================================================================
+    Info: Parallel execution layer of the particle and grid
+        loops. Loops over an index range are split into chunks
+        by one of three schedules:
+        Static  - one contiguous range per thread, or chunks
+                  of a given size dealt round-robin
+        Dynamic - chunks of a given size taken from a shared
+                  counter
+        Guided  - chunks of remaining/(2*threads) taken from a
+                  shared counter, not smaller than a given size
+        Stealing- one contiguous range per thread, taken in chunks
+                  of a given size from its front; a thread out of
+                  work steals half of the rest of another range
+                  from its back, for loops of uneven cost
+        and run by one of two backends:
+        Pool    - persistent std::thread workers, woken for
+                  each loop, the calling thread is thread 0
+        OpenMP  - "omp parallel" regions, only if built with
+                  MPM3D_USE_OPENMP
+        Loops started inside a loop run on the calling thread,
+        with its thread id if it is a loop of the same pool,
+        with thread id 0 otherwise.
+        Steals and the idle time of Stealing loops are counted
+        by the profiler entries "ThreadPool/Steal" and
+        "ThreadPool/Idle".
+    Code-writter: Ruopu Zhou
+    Date: 2026.10.16
+==============================================================*/
+
+#ifndef _THREADPOOL_H_
+#define _THREADPOOL_H_
+
+#include "../main/MPM3D_MACRO.h"
+#include "Profiler.h"
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+class ThreadPool
+{
+public:
+    enum Schedule
+    {
+        Static,
+        Dynamic,
+        Guided,
+        Stealing
+    };
+
+    enum Backend
+    {
+        Pool,
+        OpenMP
+    };
+
+    ThreadPool();
+    ~ThreadPool();
+
+    //!> "thread_number" 0 for the hardware concurrency, the workers of a previous call are stopped
+    //!> Return false for a negative number or the OpenMP backend without MPM3D_USE_OPENMP
+    bool Initialize(int thread_number, Backend backend = DefaultBackend());
+
+    //!> OpenMP if built with MPM3D_USE_OPENMP, Pool otherwise
+    static Backend DefaultBackend();
+
+    //!> Schedule of name "Static", "Dynamic", "Guided" or "Stealing", return false for other names
+    static bool ParseSchedule(const string& name, Schedule& schedule);
+    static string ScheduleName(Schedule schedule);
+
+    //!> Backend of name "Pool" or "OpenMP", return false for other names
+    static bool ParseBackend(const string& name, Backend& backend);
+    static string BackendName(Backend backend);
+
+    //!> Schedule of "ParallelFor" without an explicit one, "chunk" 0 for the default chunk size
+    inline void SetSchedule(Schedule schedule, MPM_STATS chunk = 0) {_schedule = schedule; _chunk = chunk;}
+
+    //!> Run "body(thread_id)" once on every thread of the pool and wait for all of them
+    //!> Bodies may wait for each other, e.g. by a barrier of "GetThreadNumber()" threads, except in a
+    //!>    nested call, where they run one after another on the calling thread
+    void Run(const function<void(int)>& body);
+
+    //!> Run "body(chunk_begin, chunk_end, thread_id)" on the chunks of [begin, end) by "schedule"
+    //!> "chunk" is the chunk size of Dynamic, Stealing and static round-robin, the smallest size of Guided,
+    //!>    0 for one range per thread (Static) or 1/16 of the range of a thread (others)
+    template<class Body>
+    void ParallelFor(MPM_STATS begin, MPM_STATS end, Schedule schedule, MPM_STATS chunk, Body body);
+
+    //!> "ParallelFor" with the schedule of "SetSchedule"
+    template<class Body>
+    inline void ParallelFor(MPM_STATS begin, MPM_STATS end, Body body)
+    {
+        ParallelFor(begin, end, _schedule, _chunk, body);
+    }
+
+    //!> "ParallelFor" with the schedule of "SetSchedule" on ranges of about equal sum of "cost", the cost of 
+    //!>    iteration i is cost[i], not negative. There is one range per thread for Static and 16 per thread 
+    //!>    for the other schedules, which take the ranges one by one. Ranges are split by number if all costs are 0
+    template<class Body>
+    void ParallelForBalanced(MPM_STATS begin, MPM_STATS end, const MPM_FLOAT* cost, Body body);
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+private:
+    //!> Stop and join the workers
+    void _Stop();
+
+    //!> Loop of worker "thread_id", runs the job of each generation
+    void _Worker(int thread_id, uint64_t generation);
+
+    //!> Part of thread "thread_id" in a Stealing loop over [0, number) shifted by "begin"
+    //!> "remaining" counts the iterations not finished by any thread, the part returns at 0
+    template<class Body>
+    void _RunStealing(MPM_STATS begin, MPM_STATS number, MPM_STATS chunk, int thread_id, 
+        atomic<MPM_STATS>& remaining, Body& body);
+private:
+    //!> Iterations [first, last) left to a thread in a Stealing loop, one cache line per thread
+    struct alignas(64) StealRange
+    {
+        mutex lock;
+        MPM_STATS first = 0;
+        MPM_STATS last = 0;
+    };
+
+    Backend _backend;
+    int _thread_number;
+    Schedule _schedule;
+    MPM_STATS _chunk;
+
+    vector<thread> _workers;
+    mutex _run_mutex;                   //!< one "Run" at a time if several threads share the pool
+    mutex _mutex;
+    condition_variable _start;
+    condition_variable _finish;
+    const function<void(int)>* _job;
+    uint64_t _generation;               //!< incremented for each job
+    int _running;                       //!< workers still running the job
+    bool _stop;
+
+    //!> Ranges of the threads in a Stealing loop, only used inside "Run", which is serialized by "_run_mutex"
+    //!> Every range is empty at the end of a loop, so that a range not yet set by its thread is not stolen
+    vector<StealRange> _steal_ranges;
+    int _profile_steal;                 //!< "ThreadPool/Steal", calls are steals, items the iterations stolen
+    int _profile_idle;                  //!< "ThreadPool/Idle", time of threads out of work in Stealing loops
+
+    static thread_local ThreadPool* _current;   //!< pool of the body run by the calling thread, nullptr if none
+    static thread_local int _thread_id;         //!< id of the calling thread in that pool
+
+public:
+    inline int GetThreadNumber() {return _thread_number;}
+    inline Backend GetBackend() {return _backend;}
+    inline Schedule GetSchedule() {return _schedule;}
+    inline MPM_STATS GetChunk() {return _chunk;}
+};
+
+template<class Body>
+void ThreadPool::ParallelFor(MPM_STATS begin, MPM_STATS end, Schedule schedule, MPM_STATS chunk, Body body)
+{
+    MPM_STATS number = end - begin;
+    if (number <= 0)
+        return;
+    if (_thread_number == 1 || _current)
+    {
+        body(begin, end, _current == this ? _thread_id : 0);
+        return;
+    }
+
+    const int thread_number = _thread_number;
+    if (chunk <= 0 && schedule != Static)
+        chunk = max((MPM_STATS)1, number/(16*thread_number));
+    //!> Next iteration of Dynamic and Guided, iterations not finished of Stealing
+    atomic<MPM_STATS> next(schedule == Stealing ? number : 0);
+
+    Run([&](int thread_id)
+    {
+        switch (schedule)
+        {
+        case Static:
+            if (chunk <= 0)
+            {
+                MPM_STATS first = (MPM_STATS)((int64_t)number*thread_id/thread_number);
+                MPM_STATS last = (MPM_STATS)((int64_t)number*(thread_id + 1)/thread_number);
+                if (first < last)
+                    body(begin + first, begin + last, thread_id);
+            }
+            else
+            {
+                for (MPM_STATS first = (MPM_STATS)thread_id*chunk; first < number; first += thread_number*chunk)
+                    body(begin + first, begin + min(number, first + chunk), thread_id);
+            }
+            break;
+        case Dynamic:
+            for (MPM_STATS first = next.fetch_add(chunk); first < number; first = next.fetch_add(chunk))
+                body(begin + first, begin + min(number, first + chunk), thread_id);
+            break;
+        case Guided:
+            for (MPM_STATS first = next.load(); first < number; first = next.load())
+            {
+                MPM_STATS size = min(number - first, max(chunk, (number - first)/(2*thread_number)));
+                if (next.compare_exchange_weak(first, first + size))
+                    body(begin + first, begin + first + size, thread_id);
+            }
+            break;
+        case Stealing:
+            _RunStealing(begin, number, chunk, thread_id, next, body);
+            break;
+        }
+    });
+}
+
+template<class Body>
+void ThreadPool::ParallelForBalanced(MPM_STATS begin, MPM_STATS end, const MPM_FLOAT* cost, Body body)
+{
+    MPM_STATS number = end - begin;
+    if (number <= 0)
+        return;
+    if (_thread_number == 1 || _current)
+    {
+        body(begin, end, _current == this ? _thread_id : 0);
+        return;
+    }
+
+    const int thread_number = _thread_number;
+    const MPM_STATS range_number = min(number, (MPM_STATS)(_schedule == Static ? thread_number : 16*thread_number));
+    vector<MPM_FLOAT> prefix(thread_number + 1, 0.0);
+    vector<MPM_STATS> bound(range_number + 1);
+
+    //!> Cost of the static range of each thread, prefix[t] is the cost before the range of thread t
+    ParallelFor(begin, end, Static, 0, [&](MPM_STATS first, MPM_STATS last, int thread_id)
+    {
+        MPM_FLOAT sum = 0.0;
+        for (MPM_STATS i = first; i < last; i++)
+            sum += cost[i];
+        prefix[thread_id + 1] = sum;
+    });
+    for (int t = 0; t < thread_number; t++)
+        prefix[t + 1] += prefix[t];
+    const MPM_FLOAT total = prefix[thread_number];
+    auto target = [&](MPM_STATS k) {return total*k/range_number;};
+
+    //!> Bound k is the first iteration with the cost before it not less than target(k), found by the thread
+    //!>    whose range reaches target(k). The sums are repeated in the same order, so that the sum at the end of
+    //!>    a range is exactly the prefix of the next one and every bound is found once
+    if (total > 0.0)
+    {
+        ParallelFor(begin, end, Static, 0, [&](MPM_STATS first, MPM_STATS last, int thread_id)
+        {
+            const MPM_FLOAT base = prefix[thread_id];
+            MPM_STATS k = max((MPM_STATS)1, (MPM_STATS)(base/total*range_number));
+            while (k > 1 && target(k - 1) > base)
+                k--;
+            while (k < range_number && target(k) <= base)
+                k++;
+
+            MPM_FLOAT sum = 0.0;
+            for (MPM_STATS i = first; i < last && k < range_number; i++)
+            {
+                sum += cost[i];
+                while (k < range_number && base + sum >= target(k))
+                    bound[k++] = i + 1;
+            }
+        });
+    }
+    else
+    {
+        for (MPM_STATS k = 1; k < range_number; k++)
+            bound[k] = begin + (MPM_STATS)((int64_t)number*k/range_number);
+    }
+    bound[0] = begin;
+    bound[range_number] = end;
+
+    ParallelFor(0, range_number, _schedule, _schedule == Static ? 0 : 1, 
+        [&](MPM_STATS first, MPM_STATS last, int thread_id)
+    {
+        for (MPM_STATS r = first; r < last; r++)
+            if (bound[r] < bound[r + 1])
+                body(bound[r], bound[r + 1], thread_id);
+    });
+}
+
+template<class Body>
+void ThreadPool::_RunStealing(MPM_STATS begin, MPM_STATS number, MPM_STATS chunk, int thread_id, 
+    atomic<MPM_STATS>& remaining, Body& body)
+{
+    const int thread_number = _thread_number;
+    StealRange& own = _steal_ranges[thread_id];
+    {
+        lock_guard<mutex> lock(own.lock);
+        own.first = (MPM_STATS)((int64_t)number*thread_id/thread_number);
+        own.last = (MPM_STATS)((int64_t)number*(thread_id + 1)/thread_number);
+    }
+
+    const bool profiled = Profiler::IsEnabled();
+    uint64_t steals = 0, stolen = 0, idle_ns = 0, idle_periods = 0;
+    while (true)
+    {
+        MPM_STATS first, last;
+        {
+            lock_guard<mutex> lock(own.lock);
+            first = own.first;
+            last = min(own.last, first + chunk);
+            own.first = last;
+        }
+        if (first < last)
+        {
+            body(begin + first, begin + last, thread_id);
+            remaining.fetch_sub(last - first, memory_order_acq_rel);
+            continue;
+        }
+
+        //!> Out of work, the victims are tried from the next thread on, a range being stolen from is 
+        //!>    split again by later thieves
+        uint64_t idle_start = profiled ? Profiler::Now() : 0;
+        bool found = false;
+        while (!found && remaining.load(memory_order_acquire) > 0)
+        {
+            for (int k = 1; k < thread_number && !found; k++)
+            {
+                StealRange& victim = _steal_ranges[(thread_id + k) % thread_number];
+                lock_guard<mutex> lock(victim.lock);
+                MPM_STATS size = (victim.last - victim.first + 1)/2;
+                if (size > 0)
+                {
+                    last = victim.last;
+                    first = last - size;
+                    victim.last = first;
+                    found = true;
+                }
+            }
+            if (!found)
+                this_thread::yield();
+        }
+        if (profiled)
+        {
+            idle_ns += Profiler::Now() - idle_start;
+            idle_periods++;
+        }
+        if (!found)
+            break;
+
+        steals++;
+        stolen += last - first;
+        lock_guard<mutex> lock(own.lock);
+        own.first = first;
+        own.last = last;
+    }
+
+    if (profiled)
+    {
+        Profiler::Add(_profile_steal, 0, steals, stolen, 0);
+        Profiler::Add(_profile_idle, idle_ns, idle_periods, 0, 0);
+    }
+}
+
+#endif
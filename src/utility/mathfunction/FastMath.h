@@ -0,0 +1,195 @@
+#ifndef _FAST_MATH_H_
+#define _FAST_MATH_H_
+
+#include "../../main/MPM3D_MACRO.h"
+#include <cstdint>
+#include <cstring>
+
+//!> Polynomial approximations of log/exp/pow for the opt-in "FastMath" material parameter
+//!> Double and float versions, so that MPM_FLOAT arguments are evaluated and rounded once in either build
+//!> Maximum relative errors measured by "FastMath_SampleError":
+//!>    double  FastLog  2.1e-9  for normal x > 0
+//!>            FastExp  7.5e-9  for -708 < x < 709
+//!>            FastPow  7.5e-9*(1 + |y*log(x)|), below 1e-7 for the hardening and damage laws
+//!>    float   FastLog  2.5e-7  for normal x > 0
+//!>            FastExp  1.2e-7  for -87 < x < 88
+//!>            FastPow  2.0e-7*(1 + |y*log(x)|), below 4e-6 for the hardening and damage laws
+//!> No library call and no branch, several times faster than "pow" of the standard library
+
+//!> log(x) = e*ln2 + log(m), x = m*2^e, sqrt(2)/2 <= m < sqrt(2)
+//!> log(m) = 2*atanh(f), f = (m - 1)/(m + 1), |f| < 0.1716, by odd series up to f^9
+inline double FastLog(double x)
+{
+    const double ln2_hi = 6.93147180369123816490e-01;
+    const double ln2_lo = 1.90821492927058770002e-10;
+
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+
+    //!> Biased exponent converted by the mantissa of 2^52, no 64-bit integer conversion before AVX-512DQ
+    uint64_t exponent_bits = (bits >> 52) | 0x4330000000000000ULL;
+    double e;
+    memcpy(&e, &exponent_bits, sizeof(e));
+    e = e - (4503599627370496.0 + 1023.0);
+
+    bits = (bits & 0x000FFFFFFFFFFFFFULL) | 0x3FF0000000000000ULL;
+    double m;
+    memcpy(&m, &bits, sizeof(m));
+
+    bool high = m > 1.41421356237309504880;
+    m = high ? 0.5*m : m;
+    e = high ? e + 1.0 : e;
+
+    double f = (m - 1.0)/(m + 1.0);
+    double f2 = f*f;
+    double p = 1.0/9.0;
+    p = p*f2 + 1.0/7.0;
+    p = p*f2 + 1.0/5.0;
+    p = p*f2 + 1.0/3.0;
+    p = p*f2 + 1.0;
+    return 2.0*f*p + (e*ln2_lo + e*ln2_hi);
+}
+
+//!> exp(x) = 2^k*exp(r) as "VectorExp", with Taylor series of degree 7
+inline double FastExp(double x)
+{
+    const double round_shift = 6755399441055744.0;     //!< 1.5*2^52
+    const double ln2_hi = 6.93147180369123816490e-01;
+    const double ln2_lo = 1.90821492927058770002e-10;
+
+    x = x < -708.0 ? -708.0 : x;
+    x = x > 709.0 ? 709.0 : x;
+
+    double shifted = x*1.44269504088896340736 + round_shift;
+    double k = shifted - round_shift;
+    double r = (x - k*ln2_hi) - k*ln2_lo;
+
+    double p = 1.0/5040.0;
+    p = p*r + 1.0/720.0;
+    p = p*r + 1.0/120.0;
+    p = p*r + 1.0/24.0;
+    p = p*r + 1.0/6.0;
+    p = p*r + 0.5;
+    p = p*r + 1.0;
+    p = p*r + 1.0;
+
+    uint64_t bits;
+    memcpy(&bits, &shifted, sizeof(bits));
+    bits = (bits + 1023) << 52;
+    double scale;
+    memcpy(&scale, &bits, sizeof(scale));
+    return p*scale;
+}
+
+//!> pow(x, y) for x > 0, and 0 for x <= 0 (which is pow(0, y) with y > 0)
+inline double FastPow(double x, double y)
+{
+    double result = FastExp(y*FastLog(x));
+    return x > 0.0 ? result : 0.0;
+}
+
+//!> As the double version with the float layout, the series up to f^7 are below the float round-off
+inline float FastLog(float x)
+{
+    const float ln2_hi = 0.693359375f;
+    const float ln2_lo = -2.12194440e-4f;
+
+    uint32_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+
+    uint32_t exponent_bits = (bits >> 23) | 0x4B000000U;
+    float e;
+    memcpy(&e, &exponent_bits, sizeof(e));
+    e = e - (8388608.0f + 127.0f);
+
+    bits = (bits & 0x007FFFFFU) | 0x3F800000U;
+    float m;
+    memcpy(&m, &bits, sizeof(m));
+
+    bool high = m > 1.41421356f;
+    m = high ? 0.5f*m : m;
+    e = high ? e + 1.0f : e;
+
+    float f = (m - 1.0f)/(m + 1.0f);
+    float f2 = f*f;
+    float p = 1.0f/7.0f;
+    p = p*f2 + 1.0f/5.0f;
+    p = p*f2 + 1.0f/3.0f;
+    p = p*f2 + 1.0f;
+    return 2.0f*f*p + (e*ln2_lo + e*ln2_hi);
+}
+
+//!> As the double version with the float layout, "ln2_hi" has 9 bits so that k*ln2_hi is exact
+inline float FastExp(float x)
+{
+    const float round_shift = 12582912.0f;      //!< 1.5*2^23
+    const float ln2_hi = 0.693359375f;
+    const float ln2_lo = -2.12194440e-4f;
+
+    x = x < -87.0f ? -87.0f : x;
+    x = x > 88.0f ? 88.0f : x;
+
+    float shifted = x*1.44269504f + round_shift;
+    float k = shifted - round_shift;
+    float r = (x - k*ln2_hi) - k*ln2_lo;
+
+    float p = 1.0f/5040.0f;
+    p = p*r + 1.0f/720.0f;
+    p = p*r + 1.0f/120.0f;
+    p = p*r + 1.0f/24.0f;
+    p = p*r + 1.0f/6.0f;
+    p = p*r + 0.5f;
+    p = p*r + 1.0f;
+    p = p*r + 1.0f;
+
+    uint32_t bits;
+    memcpy(&bits, &shifted, sizeof(bits));
+    bits = (bits + 127) << 23;
+    float scale;
+    memcpy(&scale, &bits, sizeof(scale));
+    return p*scale;
+}
+
+inline float FastPow(float x, float y)
+{
+    float result = FastExp(y*FastLog(x));
+    return x > 0.0f ? result : 0.0f;
+}
+
+//!> Maximum relative errors against the standard library
+struct FastMathError
+{
+    double log;
+    double exp;
+    double pow;
+};
+
+//!> Sample "number" MPM_FLOAT inputs of each function over the ranges met in the Johnson-Cook models,
+//!>    against the standard library in double
+//!>    log: 1e-8 < x < 1e8, exp: -50 < x < 50,
+//!>    pow: 1e-6 < x < 10 (plastic strain, dimensionless temperature), -1 < y < 2
+inline FastMathError FastMath_SampleError(int number = 100000)
+{
+    FastMathError error = {0.0, 0.0, 0.0};
+    for (int i = 0; i < number; i++)
+    {
+        double s = (i + 0.5)/number;
+        double t = (i*0.6180339887498949) - (int)(i*0.6180339887498949);   //!< golden ratio sequence
+
+        MPM_FLOAT x = (MPM_FLOAT)pow(10.0, -8.0 + 16.0*s);
+        double reference = log((double)x);
+        error.log = max(error.log, fabs(FastLog(x) - reference)/max(fabs(reference), 1e-300));
+
+        x = (MPM_FLOAT)(-50.0 + 100.0*s);
+        reference = exp((double)x);
+        error.exp = max(error.exp, fabs(FastExp(x) - reference)/reference);
+
+        x = (MPM_FLOAT)pow(10.0, -6.0 + 7.0*s);
+        MPM_FLOAT y = (MPM_FLOAT)(-1.0 + 3.0*t);
+        reference = pow((double)x, (double)y);
+        error.pow = max(error.pow, fabs(FastPow(x, y) - reference)/reference);
+    }
+    return error;
+}
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef _SYMMETRIC_EIGENVALUES_H_
+#define _SYMMETRIC_EIGENVALUES_H_
+
+#include "../../main/MPM3D_MACRO.h"
+
+//!> Eigenvalues of a symmetric 3x3 tensor (xx, yy, zz, yz, xz, xy), shear in tensor components
+//!> A = q*I + p*B, q = tr(A)/3, p = sqrt(tr((A - q*I)^2)/6), so the eigenvalues of B are the roots of
+//!>    b^3 - 3*b - 2*r = 0, r = det(B)/2 in [-1, 1], all in [-2, 2]
+//!> Neither branch nor library call except sqrt, so loops calling them can be vectorized
+
+//!> Mean value "q" and radius "p" of the eigenvalues, see above
+inline void SymmetricEigenvalueCenter(MPM_FLOAT xx, MPM_FLOAT yy, MPM_FLOAT zz,
+    MPM_FLOAT yz, MPM_FLOAT xz, MPM_FLOAT xy, MPM_FLOAT& q, MPM_FLOAT& p)
+{
+    q = (xx + yy + zz)/3.0;
+    MPM_FLOAT dxx = xx - q;
+    MPM_FLOAT dyy = yy - q;
+    MPM_FLOAT dzz = zz - q;
+    p = sqrt((dxx*dxx + dyy*dyy + dzz*dzz + 2.0*(yz*yz + xz*xz + xy*xy))/6.0);
+}
+
+//!> All eigenvalues are in [q - 2p, q + 2p], the half difference of two eigenvalues is not larger than 2p
+inline void SymmetricEigenvalueBounds(MPM_FLOAT xx, MPM_FLOAT yy, MPM_FLOAT zz,
+    MPM_FLOAT yz, MPM_FLOAT xz, MPM_FLOAT xy, MPM_FLOAT& lower, MPM_FLOAT& upper)
+{
+    MPM_FLOAT q, p;
+    SymmetricEigenvalueCenter(xx, yy, zz, yz, xz, xy, q, p);
+    lower = q - 2.0*p;
+    upper = q + 2.0*p;
+}
+
+//!> Eigenvalues in descending order, clamped to "SymmetricEigenvalueBounds" against round-off
+//!> The largest root b1 = 2*cos(acos(r)/3) = 2*(2*t^2 - 1), t = cos(acos(s)/3), s = sqrt((1 + r)/2),
+//!>    t is the root of 4*t^3 - 3*t = s in [0.866, 1], by a polynomial guess (error 5e-6) and 2 Newton steps.
+//!>    The other roots are (-b1 +- sqrt(12 - 3*b1^2))/2.
+//!> Errors are below 1e-12 of the largest component, growing to about sqrt(machine epsilon) near repeated
+//!>    eigenvalues as the trigonometric solution with acos/cos
+inline void SymmetricEigenvalues(MPM_FLOAT xx, MPM_FLOAT yy, MPM_FLOAT zz,
+    MPM_FLOAT yz, MPM_FLOAT xz, MPM_FLOAT xy, MPM_FLOAT& lambda_max, MPM_FLOAT& lambda_mid, MPM_FLOAT& lambda_min)
+{
+    MPM_FLOAT q, p;
+    SymmetricEigenvalueCenter(xx, yy, zz, yz, xz, xy, q, p);
+
+    MPM_FLOAT dxx = xx - q;
+    MPM_FLOAT dyy = yy - q;
+    MPM_FLOAT dzz = zz - q;
+    MPM_FLOAT det = dxx*dyy*dzz + 2.0*yz*xz*xy - dxx*yz*yz - dyy*xz*xz - dzz*xy*xy;
+    MPM_FLOAT p3 = p*p*p;
+    MPM_FLOAT r = p3 > 0.0 ? det/(2.0*p3) : 0.0;
+    r = r < -1.0 ? -1.0 : r;
+    r = r > 1.0 ? 1.0 : r;
+
+    MPM_FLOAT s = sqrt(0.5 + 0.5*r);
+    MPM_FLOAT t = -4.099405453273693e-03;
+    t = t*s + 1.7642364881077927e-02;
+    t = t*s - 4.6005261353226225e-02;
+    t = t*s + 1.6642901837952248e-01;
+    t = t*s + 8.660298533592855e-01;
+    t = t - (4.0*t*t*t - 3.0*t - s)/(12.0*t*t - 3.0);
+    t = t - (4.0*t*t*t - 3.0*t - s)/(12.0*t*t - 3.0);
+
+    MPM_FLOAT b1 = 2.0*(2.0*t*t - 1.0);
+    b1 = b1 > 2.0 ? 2.0 : b1;
+    MPM_FLOAT d = 12.0 - 3.0*b1*b1;
+    d = sqrt(d > 0.0 ? d : 0.0);
+
+    MPM_FLOAT lower = q - 2.0*p;
+    MPM_FLOAT upper = q + 2.0*p;
+    lambda_max = q + p*b1;
+    lambda_mid = q + 0.5*p*(d - b1);
+    lambda_min = q - 0.5*p*(d + b1);
+    lambda_max = lambda_max > upper ? upper : lambda_max;
+    lambda_min = lambda_min < lower ? lower : lambda_min;
+}
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef _VECTOR_EXP_H_
+#define _VECTOR_EXP_H_
+
+#include "../../main/MPM3D_MACRO.h"
+#include <cstdint>
+#include <cstring>
+
+//!> Exponential function without branch or library call, so that loops calling it can be vectorized
+//!> exp(x) = 2^k*exp(r), k = round(x/ln2), |r| <= ln2/2, exp(r) by Taylor series
+//!> Maximum relative error is about 2 ulp. Arguments are clamped to the range of normal numbers,
+//!>    so results below 1e-307 (1e-37 for float) are not flushed to zero.
+inline double VectorExp(double x)
+{
+    const double round_shift = 6755399441055744.0;     //!< 1.5*2^52
+    const double ln2_hi = 6.93147180369123816490e-01;
+    const double ln2_lo = 1.90821492927058770002e-10;
+
+    x = x < -708.0 ? -708.0 : x;
+    x = x > 709.0 ? 709.0 : x;
+
+    double shifted = x*1.44269504088896340736 + round_shift;
+    double k = shifted - round_shift;
+    double r = (x - k*ln2_hi) - k*ln2_lo;
+
+    double p = 1.0/6227020800.0;
+    p = p*r + 1.0/479001600.0;
+    p = p*r + 1.0/39916800.0;
+    p = p*r + 1.0/3628800.0;
+    p = p*r + 1.0/362880.0;
+    p = p*r + 1.0/40320.0;
+    p = p*r + 1.0/5040.0;
+    p = p*r + 1.0/720.0;
+    p = p*r + 1.0/120.0;
+    p = p*r + 1.0/24.0;
+    p = p*r + 1.0/6.0;
+    p = p*r + 0.5;
+    p = p*r + 1.0;
+    p = p*r + 1.0;
+
+    //!> The low bits of "shifted" hold k, move k + 1023 to the exponent field
+    uint64_t bits;
+    memcpy(&bits, &shifted, sizeof(bits));
+    bits = (bits + 1023) << 52;
+    double scale;
+    memcpy(&scale, &bits, sizeof(scale));
+    return p*scale;
+}
+
+inline float VectorExp(float x)
+{
+    const float round_shift = 12582912.0F;              //!< 1.5*2^23
+    const float ln2_hi = 6.93145752e-01F;
+    const float ln2_lo = 1.42860677e-06F;
+
+    x = x < -87.0F ? -87.0F : x;
+    x = x > 88.0F ? 88.0F : x;
+
+    float shifted = x*1.44269504F + round_shift;
+    float k = shifted - round_shift;
+    float r = (x - k*ln2_hi) - k*ln2_lo;
+
+    float p = 1.0F/5040.0F;
+    p = p*r + 1.0F/720.0F;
+    p = p*r + 1.0F/120.0F;
+    p = p*r + 1.0F/24.0F;
+    p = p*r + 1.0F/6.0F;
+    p = p*r + 0.5F;
+    p = p*r + 1.0F;
+    p = p*r + 1.0F;
+
+    uint32_t bits;
+    memcpy(&bits, &shifted, sizeof(bits));
+    bits = (bits + 127) << 23;
+    float scale;
+    memcpy(&scale, &bits, sizeof(scale));
+    return p*scale;
+}
+
+#endif